@@ -219,6 +219,25 @@ class stats( Gaffer.Application ) :
 					defaultValue = "",
 				),
 
+				IECore.BoolParameter(
+					name = "cacheMonitor",
+					description = "Turns on a cache monitor to provide statistics about "
+						"the effectiveness of the hash and compute caches, including "
+						"the node types responsible for the most cache misses.",
+					defaultValue = False,
+				),
+
+				IECore.FileNameParameter(
+					name = "trace",
+					description = "Filename used to save a timeline of all the processes "
+						"and cache events, in the Chrome trace event format. This can be "
+						"viewed in Perfetto (https://ui.perfetto.dev) to see how work was "
+						"distributed across threads.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json",
+				),
+
 				IECore.FileNameParameter(
 					name = "annotatedScript",
 					description = "Filename used to save a copy of the script containing "
@@ -324,6 +343,9 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__contextMonitor = None
 
+		self.__cacheMonitor = Gaffer.CacheMonitor() if args["cacheMonitor"].value else None
+		self.__traceMonitor = Gaffer.TraceMonitor() if args["trace"].value else None
+
 		if args["vtune"].value :
 			try:
 				self.__vtuneMonitor = Gaffer.VTuneMonitor()
@@ -384,14 +406,20 @@ class stats( Gaffer.Application ) :
 
 		self.__output.write( "\n" )
 
+		self.__writeCache( script, args )
+
 		self.__output.close()
 
+		if self.__traceMonitor is not None :
+			self.__traceMonitor.writeTrace( args["trace"].value )
+
 		if args["annotatedScript"].value :
 
 			if self.__performanceMonitor is not None :
 				Gaffer.MonitorAlgo.annotate( script, self.__performanceMonitor, Gaffer.MonitorAlgo.PerformanceMetric.TotalDuration )
 				Gaffer.MonitorAlgo.annotate( script, self.__performanceMonitor, Gaffer.MonitorAlgo.PerformanceMetric.HashCount )
 				Gaffer.MonitorAlgo.annotate( script, self.__performanceMonitor, Gaffer.MonitorAlgo.PerformanceMetric.ComputeCount )
+				Gaffer.MonitorAlgo.annotate( script, self.__performanceMonitor, Gaffer.MonitorAlgo.PerformanceMetric.CollaborativeWaitDuration )
 			if self.__contextMonitor is not None :
 				Gaffer.MonitorAlgo.annotate( script, self.__contextMonitor )
 
@@ -507,7 +535,7 @@ class stats( Gaffer.Application ) :
 		memory = _Memory.maxRSS()
 		# We don't expect serialisation to trigger any processes that the monitors would see,
 		# but we definitely want to know if they do.
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 			with _Timer() as timer :
 				script.serialise()
 
@@ -563,7 +591,7 @@ class stats( Gaffer.Application ) :
 			computeScene()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as sceneTimer :
 					computeScene()
@@ -605,7 +633,7 @@ class stats( Gaffer.Application ) :
 			computeImage()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as imageTimer :
 					computeImage()
@@ -641,7 +669,7 @@ class stats( Gaffer.Application ) :
 
 		memory = _Memory.maxRSS()
 		with _Timer() as taskTimer :
-			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 				with self.__context( script, args ) as context :
 					for frame in self.__frames( script, args ) :
 						context.setFrame( frame )
@@ -717,6 +745,49 @@ class stats( Gaffer.Application ) :
 
 			self.__writeItems( items )
 
+	def __writeCache( self, script, args ) :
+
+		if self.__cacheMonitor is None :
+			return
+
+		self.__output.write( "Cache :\n\n" )
+
+		def hitRate( hits, misses ) :
+			return "%.1f%%" % ( 100.0 * hits / ( hits + misses ) ) if hits + misses else "n/a"
+
+		stats = self.__cacheMonitor.combinedStatistics()
+		items = [
+			( "Hash cache hits", stats.hashCacheHits ),
+			( "Hash cache misses", stats.hashCacheMisses ),
+			( "Hash cache hit rate", hitRate( stats.hashCacheHits, stats.hashCacheMisses ) ),
+			( "Hash collaborative waits", stats.hashCollaborativeWaits ),
+			( "Hash cache evictions", Gaffer.ValuePlug.hashCacheEvictions() ),
+			( "", "" ),
+			( "Compute cache hits", stats.computeCacheHits ),
+			( "Compute cache misses", stats.computeCacheMisses ),
+			( "Compute cache hit rate", hitRate( stats.computeCacheHits, stats.computeCacheMisses ) ),
+			( "Compute persistent cache hits", stats.computePersistentCacheHits ),
+			( "Compute collaborative waits", stats.computeCollaborativeWaits ),
+			( "Compute cache stores", stats.computeCacheStores ),
+			( "Compute cache stored", _Memory( stats.computeCacheBytes ) ),
+			( "Compute cache evictions", Gaffer.ValuePlug.cacheEvictions() ),
+		]
+		self.__writeItems( items )
+
+		nodeTypeStats = sorted(
+			self.__cacheMonitor.nodeTypeStatistics().items(),
+			key = lambda x : x[1].computeCacheMisses + x[1].hashCacheMisses,
+			reverse = True
+		)
+		if nodeTypeStats :
+			self.__output.write( "\nMisses by node type (hash / compute) :\n\n" )
+			self.__writeItems( [
+				( t or "<none>", "%d / %d" % ( s.hashCacheMisses, s.computeCacheMisses ) )
+				for t, s in nodeTypeStats[:args["maxLinesPerMetric"].value]
+			] )
+
+		self.__output.write( "\n" )
+
 class _Timer( object ) :
 
 	def __enter__( self ) :
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "IECore/RefCounted.h"
+
+#include "boost/unordered_map.hpp"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <map>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which collects statistics about the effectiveness
+/// of the hash and compute caches, attributing cache hits, misses
+/// and collaborative waits to the plugs (and node types) responsible
+/// for them.
+///
+/// > Note : Evictions are not attributed to plugs or node types, because
+/// > cache entries are keyed purely by hash and do not record the plug
+/// > that produced them. Use `ValuePlug::cacheEvictions()` and
+/// > `ValuePlug::hashCacheEvictions()` for global eviction counts.
+class GAFFER_API CacheMonitor : public Monitor
+{
+
+	public :
+
+		CacheMonitor();
+		~CacheMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( CacheMonitor )
+
+		struct GAFFER_API Statistics
+		{
+
+			Statistics();
+
+			size_t hashCacheHits;
+			size_t hashCacheMisses;
+			/// Number of hashes that were waited for while being
+			/// computed by another thread.
+			size_t hashCollaborativeWaits;
+
+			size_t computeCacheHits;
+			size_t computeCacheMisses;
+			/// Number of computes that were waited for while being
+			/// computed by another thread.
+			size_t computeCollaborativeWaits;
+			/// Number of computed values stored in the cache, and
+			/// their total memory usage in bytes.
+			size_t computeCacheStores;
+			size_t computeCacheBytes;
+			/// Number of computes avoided by loading the value from
+			/// the persistent cache. These are counted separately from
+			/// `computeCacheHits`, since they are much more expensive.
+			size_t computePersistentCacheHits;
+
+			Statistics & operator += ( const Statistics &rhs );
+
+			bool operator == ( const Statistics &rhs );
+			bool operator != ( const Statistics &rhs );
+
+		};
+
+		using StatisticsMap = boost::unordered_map<ConstPlugPtr, Statistics>;
+		using NodeTypeStatisticsMap = std::map<std::string, Statistics>;
+
+		const StatisticsMap &allStatistics() const;
+		const Statistics &plugStatistics( const Plug *plug ) const;
+		const Statistics &combinedStatistics() const;
+		/// Statistics summed over all plugs belonging to nodes of
+		/// the same type, keyed by `Node::typeName()`. Plugs without
+		/// a node are keyed by an empty string.
+		const NodeTypeStatisticsMap &nodeTypeStatistics() const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+		void cacheEvent( const Plug *plug, const IECore::InternedString &processType, CacheEvent event, size_t cost ) override;
+
+	private :
+
+		// For performance reasons we accumulate our statistics into
+		// thread local storage while computations are running.
+		struct ThreadData
+		{
+			// Stores the per-plug statistics captured by this thread.
+			StatisticsMap statistics;
+		};
+
+		tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
+
+		// Then when we want to query it, we collate it into m_statistics.
+		void collate() const;
+		mutable StatisticsMap m_statistics;
+		mutable NodeTypeStatisticsMap m_nodeTypeStatistics;
+		mutable Statistics m_combinedStatistics;
+
+};
+
+IE_CORE_DECLAREPTR( CacheMonitor )
+
+} // namespace Gaffer
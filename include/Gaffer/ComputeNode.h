@@ -37,15 +37,16 @@
 
 #pragma once
 
+#include "Gaffer/Context.h"
 #include "Gaffer/DependencyNode.h"
 
 #include "IECore/MurmurHash.h"
 
+#include <vector>
+
 namespace Gaffer
 {
 
-IE_CORE_FORWARDDECLARE( Context )
-
 /// The ComputeNode class extends DependencyNode to define a mechanism via which
 /// computations can be performed. When an output ValuePlug::getValue() method is
 /// called the value will be computed using a combination of the hash() and compute()
@@ -62,6 +63,34 @@ class GAFFER_API ComputeNode : public DependencyNode
 
 		GAFFER_NODE_DECLARE_TYPE( Gaffer::ComputeNode, ComputeNodeTypeId, DependencyNode );
 
+		/// @name Prefetching
+		/// When prefetching is enabled, the upstream values declared by
+		/// `prefetch()` are computed speculatively in parallel with `compute()`,
+		/// so that they are already cached by the time `compute()` requests them.
+		/// This keeps idle cores busy when the critical path through the graph
+		/// is long. Prefetching is disabled by default, and may also be enabled
+		/// by setting the `GAFFER_PREFETCH` environment variable to `1`.
+		///
+		/// > Note : Values with the `Default` cache policy are computed
+		/// > collaboratively while they are being prefetched, so that
+		/// > `compute()` waits for an in-flight prefetch rather than computing
+		/// > the value a second time. Values with the `Uncached` policy are
+		/// > never prefetched.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		static void setPrefetchEnabled( bool enabled );
+		static bool getPrefetchEnabled();
+		//@}
+
+		/// An upstream value to be prefetched, consisting of a plug and the
+		/// context it should be evaluated in.
+		struct PrefetchRequest
+		{
+			const ValuePlug *plug;
+			ConstContextPtr context;
+		};
+		using PrefetchRequests = std::vector<PrefetchRequest>;
+
 	protected :
 
 		/// Called to compute the hashes for output Plugs. Must be implemented to call the base
@@ -84,6 +113,14 @@ class GAFFER_API ComputeNode : public DependencyNode
 		/// will spawn TBB tasks then one of the task-based policies _must_ be used.
 		virtual ValuePlug::CachePolicy computeCachePolicy( const ValuePlug *output ) const;
 
+		/// May be implemented by derived classes to declare upstream values that
+		/// `compute( output, context )` is certain to require. These are appended
+		/// to `requests`, and are computed speculatively when prefetching is enabled.
+		/// Only called for values not already in the cache. Implementations should
+		/// be cheap, and must not declare values which would not otherwise be
+		/// computed. The default implementation declares nothing.
+		virtual void prefetch( const ValuePlug *output, const Context *context, PrefetchRequests &requests ) const;
+
 	private :
 
 		friend class ValuePlug;
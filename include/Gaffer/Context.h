@@ -47,6 +47,7 @@
 #include "IECore/StringAlgo.h"
 
 #include "boost/container/flat_map.hpp"
+#include "boost/container/small_vector.hpp"
 
 namespace Gaffer
 {
@@ -367,8 +368,20 @@ class GAFFER_API Context : public IECore::RefCounted
 		const Value &internalGet( const IECore::InternedString &name ) const;
 		// Returns nullptr if variable doesn't exist.
 		const Value *internalGetIfExists( const IECore::InternedString &name ) const;
-
-		using Map = boost::container::flat_map<IECore::InternedString, Value>;
+		// Updates `m_hash` (if valid) to account for `oldValue` being replaced by
+		// `newValue`. Because the context hash is a sum of the variable hashes, this
+		// is O(1), allowing `hash()` to be called cheaply following each edit in an
+		// EditableScope.
+		void updateHash( const Value &oldValue, const Value &newValue );
+
+		// Variables are stored in a sorted vector with enough inline capacity
+		// for typical contexts, so that EditableScopes can copy and edit them
+		// without allocating memory.
+		static constexpr size_t g_inlineVariables = 16;
+		using Map = boost::container::flat_map<
+			IECore::InternedString, Value, std::less<IECore::InternedString>,
+			boost::container::small_vector<std::pair<IECore::InternedString, Value>, g_inlineVariables>
+		>;
 
 		Map m_map;
 		ChangedSignal *m_changedSignal;
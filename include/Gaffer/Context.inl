@@ -180,32 +180,45 @@ void Context::set( const IECore::InternedString &name, const T &value )
 
 inline void Context::internalSet( const IECore::InternedString &name, const Value &value )
 {
+	Value &v = m_map.try_emplace( name ).first->second;
 	if( !m_changedSignal )
 	{
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
-		m_hashValid = false;
+		updateHash( v, value );
+		v = value;
 	}
 	else
 	{
 		// Always assign to the value, because the caller might have updated
 		// `m_allocMap` already (removing the previous value).
-		Value &v = m_map[name];
 		const bool changed = v != value;
+		updateHash( v, value );
 		v = value;
 		if( changed )
 		{
 			// But avoid emitting `changedSignal` if the value hasn't
 			// actually changed. We want to avoid expensive re-evaluations
 			// that might otherwise be triggered in the UI.
-			m_hashValid = false;
 			(*m_changedSignal)( this, name );
 		}
 	}
 }
 
+inline void Context::updateHash( const Value &oldValue, const Value &newValue )
+{
+	if( m_hashValid )
+	{
+		// Unsigned arithmetic wraps, so subtracting the old value is
+		// the exact inverse of the summation performed by `hash()`.
+		m_hash = IECore::MurmurHash(
+			m_hash.h1() - oldValue.hash().h1() + newValue.hash().h1(),
+			m_hash.h2() - oldValue.hash().h2() + newValue.hash().h2()
+		);
+	}
+}
+
 inline void Context::internalSetWithOwner( const IECore::InternedString &name, const Value &value, IECore::ConstDataPtr &&owner )
 {
 	IECore::ConstDataPtr &currentOwner = m_allocMap[name];
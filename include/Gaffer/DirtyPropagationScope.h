@@ -57,6 +57,9 @@ namespace Gaffer
 /// // outputs of the node only once, at the exit
 /// // of the scope.
 /// ```
+///
+/// On exit, `Node::plugDirtiedSignal()` is emitted for each dirtied plug,
+/// followed by a single `Node::plugsDirtiedSignal()` for each affected node.
 class GAFFER_API DirtyPropagationScope : boost::noncopyable
 {
 
@@ -57,13 +57,14 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 	public :
 
 		DownstreamIterator( const Plug *plug )
-			:	m_root( plug ), m_pruned( false )
+			:	m_root( plug ), m_pruned( false ), m_errors( false )
 		{
 			m_stack.push_back(
 				Level(
 					plug
 				)
 			);
+			m_errors = m_stack.back().errors;
 		}
 
 		size_t depth() const
@@ -93,6 +94,15 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 			return m_stack.size() == 1 && m_stack[0].it == m_stack[0].end;
 		}
 
+		/// Returns true if a call to `DependencyNode::affects()` made so far
+		/// threw an exception or returned a non-leaf plug. Such errors are
+		/// reported and iteration continues, but the plugs visited may not be
+		/// the complete set of dependents.
+		bool errors() const
+		{
+			return m_errors;
+		}
+
 	private :
 
 		friend class boost::iterator_core_access;
@@ -103,7 +113,7 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 			public :
 
 				Level( const Plug *plug )
-					:	plugs( plug->outputs().begin(), plug->outputs().end() )
+					:	plugs( plug->outputs().begin(), plug->outputs().end() ), errors( false )
 				{
 					addDependentPlugs( plug );
 					addAncestorOutputs( plug );
@@ -126,12 +136,15 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 					plugs = rhs.plugs;
 					it = plugs.begin() + (rhs.it - rhs.plugs.begin());
 					end = plugs.end();
+					errors = rhs.errors;
 					return *this;
 				}
 
 				DependencyNode::AffectedPlugsContainer plugs;
 				DependencyNode::AffectedPlugsContainer::const_iterator it;
 				DependencyNode::AffectedPlugsContainer::const_iterator end;
+				// True if `addDependentPlugs()` encountered an error.
+				bool errors;
 
 			private :
 
@@ -172,6 +185,7 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 							node->fullName() + "::affects()",
 							e.what()
 						);
+						errors = true;
 					}
 					catch( ... )
 					{
@@ -180,18 +194,21 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 							node->fullName() + "::affects()",
 							"Unknown exception"
 						);
+						errors = true;
 					}
 
 					// Likewise we don't want client code to be exposed to
 					// dependencies which are disallowed.
-					plugs.erase(
-						std::remove_if(
-							plugs.begin() + firstDependentIndex,
-							plugs.end(),
-							isNonLeaf
-						),
-						plugs.end()
+					auto nonLeafBegin = std::remove_if(
+						plugs.begin() + firstDependentIndex,
+						plugs.end(),
+						isNonLeaf
 					);
+					if( nonLeafBegin != plugs.end() )
+					{
+						plugs.erase( nonLeafBegin, plugs.end() );
+						errors = true;
+					}
 				}
 
 				static bool isNonLeaf( const Plug *plug )
@@ -240,6 +257,7 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 		Levels m_stack;
 		const Plug *m_root;
 		bool m_pruned;
+		bool m_errors;
 
 		void increment()
 		{
@@ -248,6 +266,7 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 			{
 				// go downstream if we can
 				Level level( currentPlug );
+				m_errors = m_errors || level.errors;
 				if( !level.plugs.empty() )
 				{
 					m_stack.push_back( level );
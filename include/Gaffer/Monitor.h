@@ -84,6 +84,25 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		/// on this thread.
 		static const MonitorSet &current();
 
+		/// Describes an interaction between a process and the cache
+		/// used to store its results.
+		enum class CacheEvent
+		{
+			/// The result was found in the cache, so no process was run.
+			Hit,
+			/// The result was not in the cache, so a process will be run
+			/// or waited for.
+			Miss,
+			/// The result is being computed by another thread, which this
+			/// thread waited for instead of running its own process.
+			CollaborativeWait,
+			/// The result of a process was stored in the cache.
+			Store,
+			/// The result was not in the in-memory cache, but was loaded
+			/// from the persistent cache, so no process was run.
+			PersistentHit
+		};
+
 	protected :
 
 		Monitor();
@@ -95,6 +114,23 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		/// Implementations must be safe to call concurrently.
 		virtual void processFinished( const Process *process ) = 0;
 
+		/// Called when a process of type `processType` for `plug`
+		/// accesses its cache. For `Store` events, `cost` is the cost of
+		/// the stored result, measured in bytes for compute processes and
+		/// entries for hash processes. Implementations must be safe to call
+		/// concurrently. The default implementation does nothing.
+		virtual void cacheEvent( const Plug *plug, const IECore::InternedString &processType, CacheEvent event, size_t cost );
+
+		/// Called when a thread starts waiting for an in-flight process of
+		/// type `processType` for `plug`, which was launched by another thread.
+		/// While waiting, the thread may work on tasks spawned by the in-flight
+		/// process, in which case further processes will be started and finished
+		/// on this thread before `collaborativeWaitFinished()` is called.
+		/// Implementations must be safe to call concurrently. The default
+		/// implementations do nothing.
+		virtual void collaborativeWaitStarted( const Plug *plug, const IECore::InternedString &processType );
+		virtual void collaborativeWaitFinished( const Plug *plug, const IECore::InternedString &processType );
+
 		/// Must return true if forceMonitoring will ever return true from this Monitor
 		/// \todo : In order to efficently support a monitor that only forces monitoring during
 		/// compute processes, we would need to make this specific to processType - this will
@@ -61,9 +61,13 @@ enum PerformanceMetric
 	HashCount,
 	ComputeCount,
 	HashesPerCompute,
+	CollaborativeWaitCount,
+	CollaborativeWaitDuration,
+	CollaborativeIdleDuration,
+	CollaborativeWorkFraction,
 
 	First = TotalDuration,
-	Last = HashesPerCompute
+	Last = CollaborativeWorkFraction
 };
 
 GAFFER_API std::string formatStatistics( const PerformanceMonitor &monitor, size_t maxLinesPerMetric = 50 );
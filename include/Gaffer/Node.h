@@ -75,6 +75,7 @@ class GAFFER_API Node : public GraphComponent
 
 		using UnaryPlugSignal = Signals::Signal<void (Plug *), Signals::CatchingCombiner<void>>;
 		using BinaryPlugSignal = Signals::Signal<void (Plug *, Plug *), Signals::CatchingCombiner<void>>;
+		using PlugVectorSignal = Signals::Signal<void (const std::vector<Plug *> &), Signals::CatchingCombiner<void>>;
 
 		/// @name Plug signals
 		/// These signals are emitted on events relating to child Plugs
@@ -115,6 +116,12 @@ class GAFFER_API Node : public GraphComponent
 		/// onto an input plug of a plain Node (and potentially onwards if that plug
 		/// has its own output connections).
 		UnaryPlugSignal &plugDirtiedSignal();
+		/// Emitted once at the end of each dirty propagation, after `plugDirtiedSignal()`
+		/// has been emitted for every dirtied plug, with all the dirtied plugs belonging to
+		/// this node, in the same order. Observers which need only respond once per edit
+		/// should prefer this to `plugDirtiedSignal()`, as large graphs may dirty many plugs
+		/// on a single node. The same restrictions on rewiring the graph apply.
+		PlugVectorSignal &plugsDirtiedSignal();
 		//@}
 
 		/// It's common for users to want to create their own plugs on
@@ -195,6 +202,7 @@ class GAFFER_API Node : public GraphComponent
 		UnaryPlugSignal m_plugSetSignal;
 		UnaryPlugSignal m_plugInputChangedSignal;
 		UnaryPlugSignal m_plugDirtiedSignal;
+		PlugVectorSignal m_plugsDirtiedSignal;
 		ErrorSignal m_errorSignal;
 
 };
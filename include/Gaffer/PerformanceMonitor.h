@@ -71,7 +71,11 @@ class GAFFER_API PerformanceMonitor : public Monitor
 				size_t hashCount = 0,
 				size_t computeCount = 0,
 				boost::chrono::nanoseconds hashDuration = boost::chrono::nanoseconds( 0 ),
-				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 )
+				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 ),
+				size_t collaborativeWaitCount = 0,
+				size_t collaborativeWorkCount = 0,
+				boost::chrono::nanoseconds collaborativeWaitDuration = boost::chrono::nanoseconds( 0 ),
+				boost::chrono::nanoseconds collaborativeIdleDuration = boost::chrono::nanoseconds( 0 )
 			);
 
 			size_t hashCount;
@@ -79,6 +83,21 @@ class GAFFER_API PerformanceMonitor : public Monitor
 			boost::chrono::nanoseconds hashDuration;
 			boost::chrono::nanoseconds computeDuration;
 
+			/// Number of times a thread waited for an in-flight
+			/// process for the plug, launched by another thread.
+			size_t collaborativeWaitCount;
+			/// Number of those waits in which the waiting thread
+			/// performed work on behalf of the in-flight process,
+			/// rather than simply idling until it completed.
+			size_t collaborativeWorkCount;
+			/// Total time spent in collaborative waits.
+			boost::chrono::nanoseconds collaborativeWaitDuration;
+			/// The portion of `collaborativeWaitDuration` during
+			/// which the waiting threads were not running processes
+			/// of their own. This is excluded from the `hashDuration`
+			/// and `computeDuration` of the waiting processes.
+			boost::chrono::nanoseconds collaborativeIdleDuration;
+
 			Statistics & operator += ( const Statistics &rhs );
 
 			bool operator == ( const Statistics &rhs );
@@ -97,6 +116,8 @@ class GAFFER_API PerformanceMonitor : public Monitor
 
 		void processStarted( const Process *process ) override;
 		void processFinished( const Process *process ) override;
+		void collaborativeWaitStarted( const Plug *plug, const IECore::InternedString &processType ) override;
+		void collaborativeWaitFinished( const Plug *plug, const IECore::InternedString &processType ) override;
 
 	private :
 
@@ -113,6 +134,19 @@ class GAFFER_API PerformanceMonitor : public Monitor
 			DurationStack durationStack;
 			// The last time measurement we made.
 			boost::chrono::high_resolution_clock::time_point then;
+			// Number of processes started by this thread, used to
+			// determine if work was done during a collaborative wait.
+			size_t numProcessesStarted = 0;
+			// Stack of collaborative waits in progress on this thread.
+			// Waits may be nested if the thread works on tasks that
+			// themselves wait on another collaboration.
+			struct CollaborativeWait
+			{
+				Statistics *statistics;
+				boost::chrono::high_resolution_clock::time_point startTime;
+				size_t numProcessesStarted;
+			};
+			std::stack<CollaborativeWait> collaborativeWaitStack;
 		};
 
 		tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
@@ -271,6 +271,9 @@ class GAFFER_API Plug : public GraphComponent
 
 		static void pushDirtyPropagationScope();
 		static void popDirtyPropagationScope();
+		// Must be called whenever an edit may change the plugs
+		// visited by a DownstreamIterator.
+		static void invalidateDirtyPropagationCache();
 		// DirtyPropagationScope allowed friendship, as we use
 		// it to declare an exception-safe public interface to
 		// the two private methods above.
@@ -40,6 +40,8 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <optional>
 
 namespace IECorePreview
@@ -112,6 +114,24 @@ class LRUCache : private boost::noncopyable
 		LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback = RemovalCallback(), bool cacheErrors = true );
 		virtual ~LRUCache();
 
+		/// Determines which items are discarded when the cache exceeds
+		/// its maximum cost.
+		enum class EvictionPolicy
+		{
+			/// Discards the least recently used items first.
+			LRU,
+			/// Weighs the cost of recomputing each item against its cost
+			/// in the cache, so that items which are expensive to recompute
+			/// survive longer than items which are cheap to recompute. Only
+			/// has an effect for items stored via `set()` or `setIfUncached()`
+			/// with a non-zero `recomputeCost`. Not supported by the Serial
+			/// policy, which always uses LRU order.
+			CostAware
+		};
+
+		void setEvictionPolicy( EvictionPolicy evictionPolicy );
+		EvictionPolicy getEvictionPolicy() const;
+
 		/// Retrieves an item from the cache, computing it if necessary.
 		/// The item is returned by value, as it may be removed from the
 		/// cache at any time by operations on another thread, or may not
@@ -129,15 +149,18 @@ class LRUCache : private boost::noncopyable
 		/// Returns true for success and false on failure - failure can occur
 		/// if the cost exceeds the maximum cost for the cache. Note that even
 		/// when true is returned, the item may be removed from the cache by a
-		/// subsequent (or concurrent) operation.
-		bool set( const Key &key, const Value &value, Cost cost );
+		/// subsequent (or concurrent) operation. The optional `recomputeCost`
+		/// is used by the `CostAware` eviction policy, and should be measured
+		/// in units such that the ratio `recomputeCost / cost` is meaningful
+		/// (ValuePlug uses nanoseconds and bytes respectively).
+		bool set( const Key &key, const Value &value, Cost cost, Cost recomputeCost = 0 );
 		/// As above, but only if the item is not cached already. This avoids
 		/// calling a potentially expensive cost function in the case that the
 		/// item is cached already.
 		/// \todo Ideally we wouldn't need the cost calculation to be duplicated
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
-		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, Cost recomputeCost = 0 );
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
@@ -163,6 +186,11 @@ class LRUCache : private boost::noncopyable
 		/// Returns the current cost of all cached items.
 		Cost currentCost() const;
 
+		/// Returns the number of items that have been discarded
+		/// in order to keep the cache within its maximum cost. Items
+		/// removed by `erase()` or `clear()` are not counted.
+		size_t evictions() const;
+
 	private :
 
 		// Data
@@ -198,6 +226,7 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			uint8_t retention; // the number of chances given to this item by `Policy::pop()`
 
 			Status status() const;
 
@@ -209,13 +238,21 @@ class LRUCache : private boost::noncopyable
 
 		Cost m_maxCost;
 		bool m_cacheErrors;
+		std::atomic<EvictionPolicy> m_evictionPolicy;
+		std::atomic<size_t> m_evictions;
+
+		static constexpr int g_maxRetention = 16;
 
 		// Methods
 		// =======
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, Cost recomputeCost );
+
+		// Returns the `CacheEntry::retention` for an item, according
+		// to the current eviction policy.
+		uint8_t retention( Cost cost, Cost recomputeCost ) const;
 
 		// Removes any cached value and updates the current total
 		// cost.
@@ -49,7 +49,9 @@
 #include "tbb/spin_mutex.h"
 #include "tbb/spin_rw_mutex.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <tuple>
 #include <vector>
@@ -302,16 +304,20 @@ class Parallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : chances( 0 ) {}
+			Item( const Key &key ) : key( key ), chances( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), chances( 0 ) {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = tbb::spin_rw_mutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of passes of `pop()` that the item will survive
+			// before being evicted. This is a generalisation of the
+			// second-chance algorithm, where recently used items
+			// are given `CacheEntry::retention` chances rather than
+			// just one.
+			mutable std::atomic<uint8_t> chances;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -505,9 +511,10 @@ class Parallel
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
-			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// Items that are expensive to recompute may be given
+			// more than one chance. We don't need the handle to be
+			// writable to write here, because `chances` is atomic.
+			handle.m_item->chances.store( handle.m_item->cacheEntry.retention, std::memory_order_release );
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -553,7 +560,7 @@ class Parallel
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
 							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// the `chances` counter or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -563,7 +570,8 @@ class Parallel
 
 				if( itemLock.try_acquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const uint8_t chances = m_popIterator->chances.load( std::memory_order_acquire );
+					if( !chances )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -581,10 +589,10 @@ class Parallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently. Use up one of
+						// its chances, so we can pop it on a subsequent
+						// pass, unless another thread uses it again first.
+						m_popIterator->chances.store( chances - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -648,16 +656,20 @@ class TaskParallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : chances( 0 ) {}
+			Item( const Key &key ) : key( key ), chances( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), chances( 0 ) {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = TaskMutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of passes of `pop()` that the item will survive
+			// before being evicted. This is a generalisation of the
+			// second-chance algorithm, where recently used items
+			// are given `CacheEntry::retention` chances rather than
+			// just one.
+			mutable std::atomic<uint8_t> chances;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -890,9 +902,10 @@ class TaskParallel
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
-			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// Items that are expensive to recompute may be given
+			// more than one chance. We don't need the handle to be
+			// writable to write here, because `chances` is atomic.
+			handle.m_item->chances.store( handle.m_item->cacheEntry.retention, std::memory_order_release );
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -938,7 +951,7 @@ class TaskParallel
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
 							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// the `chances` counter or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -948,7 +961,8 @@ class TaskParallel
 
 				if( itemLock.tryAcquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const uint8_t chances = m_popIterator->chances.load( std::memory_order_acquire );
+					if( !chances )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -966,10 +980,10 @@ class TaskParallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently. Use up one of
+						// its chances, so we can pop it on a subsequent
+						// pass, unless another thread uses it again first.
+						m_popIterator->chances.store( chances - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -1012,7 +1026,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), retention( 1 )
 {
 }
 
@@ -1027,7 +1041,7 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors )
-	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
+	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors ), m_evictionPolicy( EvictionPolicy::LRU ), m_evictions( 0 )
 {
 }
 
@@ -1074,6 +1088,24 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Cost LRUCache<Key, Value, Poli
 	return m_policy.currentCost;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::setEvictionPolicy( EvictionPolicy evictionPolicy )
+{
+	m_evictionPolicy = evictionPolicy;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::EvictionPolicy LRUCache<Key, Value, Policy, GetterKey>::getEvictionPolicy() const
+{
+	return m_evictionPolicy;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+size_t LRUCache<Key, Value, Policy, GetterKey>::evictions() const
+{
+	return m_evictions.load( std::memory_order_relaxed );
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const IECore::Canceller *canceller )
 {
@@ -1107,7 +1139,7 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( cacheEntry.status() != Cached ); // this would indicate that another thread somehow
 		assert( cacheEntry.status() != Failed ); // loaded the same thing as us, which is not the intention.
 
-		setInternal( key, handle.writable(), value, cost );
+		setInternal( key, handle.writable(), value, cost, /* recomputeCost = */ 0 );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1154,12 +1186,12 @@ std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost, Cost recomputeCost )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::InsertWritable, /* canceller = */ nullptr );
 	assert( handle.isWritable() );
-	bool result = setInternal( key, handle.writable(), value, cost );
+	bool result = setInternal( key, handle.writable(), value, cost, recomputeCost );
 	m_policy.push( handle );
 	handle.release();
 	limitCost( m_maxCost );
@@ -1168,7 +1200,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
-bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, Cost recomputeCost )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1211,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		result = setInternal( key, handle.writable(), value, costFunction( value ), recomputeCost );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1221,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, Cost recomputeCost )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,12 +1232,33 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.retention = retention( cost, recomputeCost );
 
 	m_policy.currentCost += cost;
 
 	return true;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+uint8_t LRUCache<Key, Value, Policy, GetterKey>::retention( Cost cost, Cost recomputeCost ) const
+{
+	if( m_evictionPolicy == EvictionPolicy::LRU || recomputeCost <= cost )
+	{
+		return 1;
+	}
+
+	// This is an approximation of the GreedyDual-Size algorithm, which
+	// prioritises items according to the ratio of `recomputeCost` to
+	// `cost`. Rather than maintain a priority queue, which would be
+	// prohibitively expensive in the concurrent policies, we quantise
+	// the ratio logarithmically and give the item one additional chance
+	// to survive `pop()` per doubling. Each pass of `pop()` then uses up
+	// one chance from all the items it visits, ageing them in the same way
+	// that GreedyDual-Size does by inflating its baseline priority.
+	const double ratio = (double)recomputeCost / (double)std::max<Cost>( cost, 1 );
+	return 1 + std::min<int>( (int)std::log2( ratio ), g_maxRetention - 1 );
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 bool LRUCache<Key, Value, Policy, GetterKey>::cached( const Key &key ) const
 {
@@ -1275,7 +1328,10 @@ void LRUCache<Key, Value, Policy, GetterKey>::limitCost( Cost cost )
 			break;
 		}
 
-		eraseInternal( key, cacheEntry );
+		if( eraseInternal( key, cacheEntry ) )
+		{
+			m_evictions.fetch_add( 1, std::memory_order_relaxed );
+		}
 	}
 }
 
@@ -0,0 +1,208 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/Object.h"
+
+#include "boost/noncopyable.hpp"
+
+#include "tbb/spin_rw_mutex.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// A cache of serialised objects stored as files within a directory,
+/// keyed by MurmurHash. Because the cache lives on disk, it may be shared
+/// by multiple processes running concurrently or consecutively on the same
+/// machine. Files are written atomically so that concurrent readers never
+/// see partial entries. Used by ValuePlug to provide a second tier to the
+/// in-memory compute cache.
+///
+/// Each entry is stored along with a "signature", identifying the kind
+/// of value it holds (for ValuePlug, the node type and plug name). Lookups
+/// are only made for signatures that have previously been stored, so that
+/// values which have never been expensive enough to store don't pay for
+/// filesystem access on every miss. Known signatures are shared between
+/// processes via the cache directory.
+///
+/// > Note : Cost limits are applied per process, using an approximate
+/// > total that is resynchronised with the directory contents whenever
+/// > the limit is exceeded. Resynchronisation and writes are performed on
+/// > a background thread, so don't delay the callers of `set()`.
+class GAFFER_API PersistentCache : private boost::noncopyable
+{
+
+	public :
+
+		PersistentCache( size_t maxCost );
+		~PersistentCache();
+
+		/// Sets the directory used to store the cache. Entries are stored
+		/// in a subdirectory specific to the current Gaffer version, so that
+		/// changes to serialisation formats and hashing are never an issue.
+		/// An empty string disables the cache.
+		void setDirectory( const std::string &directory );
+		const std::string getDirectory() const;
+
+		/// Returns true if a directory has been set. May be called
+		/// concurrently with any other method, and is very cheap.
+		bool enabled() const
+		{
+			return m_enabled.load( std::memory_order_acquire );
+		}
+
+		/// Returns the stored object for `key`, or null if it is not
+		/// available. Failures to read are treated as misses. Returns null
+		/// without accessing the filesystem if no entry has ever been stored
+		/// with `signature`.
+		IECore::ConstObjectPtr get( const IECore::MurmurHash &key, const IECore::MurmurHash &signature );
+		/// Queues `value` to be stored for `key`. Serialisation and writing
+		/// are performed on a background thread, and failures are recorded
+		/// in `statistics()`. `value` must not be modified after it has been
+		/// passed to `set()`. If too many writes are already pending, `value`
+		/// is written before returning instead, so that the queue can't hold
+		/// on to an unbounded amount of memory.
+		void set( const IECore::MurmurHash &key, const IECore::MurmurHash &signature, const IECore::ConstObjectPtr &value );
+		/// Waits for all writes queued by `set()` to complete.
+		void flush();
+
+		/// Removes all entries for the current version.
+		void clear();
+
+		void setMaxCost( size_t maxCost );
+		size_t getMaxCost() const;
+		/// Returns the total size of all entries in bytes.
+		size_t currentCost() const;
+
+		struct Statistics
+		{
+			size_t hits = 0;
+			size_t misses = 0;
+			size_t writes = 0;
+			size_t failures = 0;
+			size_t evictions = 0;
+		};
+
+		Statistics statistics() const;
+		void resetStatistics();
+
+	private :
+
+		std::filesystem::path entryPath( const std::filesystem::path &versionDirectory, const IECore::MurmurHash &key ) const;
+		std::filesystem::path versionDirectory() const;
+
+		// Serialises and writes `value`, returning true on success.
+		bool write( const IECore::MurmurHash &key, const IECore::MurmurHash &signature, const IECore::Object *value );
+
+		bool hasSignature( const IECore::MurmurHash &signature ) const;
+		void addSignature( const std::filesystem::path &versionDirectory, const IECore::MurmurHash &signature );
+		// Adds signatures recorded by other processes.
+		void loadSignatures( const std::filesystem::path &versionDirectory );
+
+		// Schedules a call to `limitCost( cost )` on the maintenance thread.
+		void requestLimitCost( size_t cost );
+		// Must be called with `m_maintenanceMutex` held.
+		void startMaintenanceThread();
+		void maintenanceThread();
+		// Scans the directory, updating `m_currentCost`, and removing
+		// least recently used entries until we are below `cost`.
+		void limitCost( size_t cost );
+
+		using DirectoryMutex = tbb::spin_rw_mutex;
+		mutable DirectoryMutex m_directoryMutex;
+		std::string m_directory;
+		std::filesystem::path m_versionDirectory;
+		std::atomic_bool m_enabled;
+
+		using SignatureMutex = tbb::spin_rw_mutex;
+		mutable SignatureMutex m_signatureMutex;
+		std::unordered_set<IECore::MurmurHash> m_signatures;
+
+		std::atomic_size_t m_maxCost;
+		std::atomic_size_t m_currentCost;
+		// Total bytes ever written by this process. Used to account for
+		// writes made while `limitCost()` is scanning the directory.
+		std::atomic_size_t m_bytesWritten;
+
+		// Held for the duration of `limitCost()` and `clear()`.
+		std::mutex m_limitCostMutex;
+
+		std::mutex m_maintenanceMutex;
+		std::condition_variable m_maintenanceCondition;
+		// Cost limit requested of the maintenance thread, or
+		// `std::numeric_limits<size_t>::max()` if none is pending.
+		size_t m_pendingLimit;
+		struct PendingWrite
+		{
+			IECore::MurmurHash key;
+			IECore::MurmurHash signature;
+			IECore::ConstObjectPtr value;
+		};
+		std::deque<PendingWrite> m_pendingWrites;
+		// True while the maintenance thread is writing an entry
+		// taken from `m_pendingWrites`.
+		bool m_writing;
+		// Notified when `m_pendingWrites` becomes empty.
+		std::condition_variable m_flushCondition;
+		bool m_stopMaintenance;
+		std::thread m_maintenanceThread;
+
+		std::atomic_size_t m_hits;
+		std::atomic_size_t m_misses;
+		std::atomic_size_t m_writes;
+		std::atomic_size_t m_failures;
+		std::atomic_size_t m_evictions;
+
+};
+
+} // namespace Private
+
+} // namespace Gaffer
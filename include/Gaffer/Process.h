@@ -38,6 +38,7 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/Export.h"
+#include "Gaffer/Monitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadState.h"
 
@@ -99,6 +100,12 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// the original caller.
 		[[noreturn]] void handleException() const;
 
+		/// Notifies the monitors in `s` of an access to the cache used for
+		/// processes of type `processType`. Should be called by derived classes
+		/// which cache their results, so that cache behaviour can be
+		/// monitored. Cheap to call when there are no active monitors.
+		inline static void cacheEvent( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheEvent event, size_t cost = 0 );
+
 		/// Searches for an in-flight process and waits for its result, collaborating
 		/// on any TBB tasks it spawns. If no such process exists, constructs one
 		/// using `args` and makes it available for collaboration by other threads,
@@ -115,6 +122,9 @@ class GAFFER_API Process : private ThreadState::Scope
 		///   to be used for the caching of the result.
 		/// - `ProcessType::cacheCostFunction()` is a static function suitable
 		///   for use with `CacheType::setIfUncached()`.
+		/// - `ProcessType::staticType` is the type of the process.
+		/// - The first of `args` is the plug the process is for. This is used to
+		///   report cache events to any active monitors.
 		///
 		template<typename ProcessType, typename... ProcessArguments>
 		static typename ProcessType::ResultType acquireCollaborativeResult(
@@ -126,8 +136,11 @@ class GAFFER_API Process : private ThreadState::Scope
 		class Collaboration;
 		template<typename T>
 		class TypedCollaboration;
+		class CollaborativeWaitScope;
 
 		static bool forceMonitoringInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType );
+		static void cacheEventInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheEvent event, size_t cost );
+		static void collaborativeWaitInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, bool finished );
 
 		void emitError( const std::string &error, const Plug *source = nullptr ) const;
 
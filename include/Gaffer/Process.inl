@@ -34,11 +34,14 @@
 //
 //////////////////////////////////////////////////////////////////////////
 
+#include "boost/noncopyable.hpp"
+
 #include "tbb/concurrent_hash_map.h"
 #include "tbb/spin_mutex.h"
 #include "tbb/task_arena.h"
 #include "tbb/task_group.h"
 
+#include <chrono>
 #include <unordered_set>
 #include <variant>
 
@@ -303,6 +306,32 @@ class Process::TypedCollaboration : public Process::Collaboration
 template<typename ProcessType>
 typename Process::TypedCollaboration<ProcessType>::PendingCollaborations Process::TypedCollaboration<ProcessType>::g_pendingCollaborations;
 
+/// Notifies any active monitors of the start and end of a wait
+/// on a collaboration launched by another thread.
+class Process::CollaborativeWaitScope : boost::noncopyable
+{
+
+	public :
+
+		CollaborativeWaitScope( const ThreadState &threadState, const Plug *plug, const IECore::InternedString &processType )
+			:	m_threadState( threadState ), m_plug( plug ), m_processType( processType )
+		{
+			collaborativeWaitInternal( m_threadState, m_plug, m_processType, /* finished = */ false );
+		}
+
+		~CollaborativeWaitScope()
+		{
+			collaborativeWaitInternal( m_threadState, m_plug, m_processType, /* finished = */ true );
+		}
+
+	private :
+
+		const ThreadState &m_threadState;
+		const Plug *m_plug;
+		const IECore::InternedString m_processType;
+
+};
+
 template<typename ProcessType, typename... ProcessArguments>
 typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
@@ -369,9 +398,15 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 		CollaborationTypePtr collaboration = candidate;
 		accessor.release();
 
-		collaboration->arena.execute(
-			[&]{ return collaboration->taskGroup.wait(); }
-		);
+		const Plug *plug = std::get<0>( std::forward_as_tuple( args... ) );
+		cacheEvent( threadState, plug, ProcessType::staticType, Monitor::CacheEvent::CollaborativeWait );
+
+		{
+			CollaborativeWaitScope waitScope( threadState, plug, ProcessType::staticType );
+			collaboration->arena.execute(
+				[&]{ return collaboration->taskGroup.wait(); }
+			);
+		}
 
 		return collaboration->resultOrException();
 	}
@@ -406,14 +441,27 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 					{
 						ProcessType process( std::forward<ProcessArguments>( args )... );
 						process.m_collaboration = collaboration.get();
+						const auto startTime = std::chrono::steady_clock::now();
 						collaboration->result = process.run();
+						// Time taken is passed to the cache as the cost of recomputing
+						// the result, for use by cost-aware eviction policies.
+						const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - startTime;
 						// Publish result to cache before we remove ourself from
 						// `g_pendingCollaborations`, so that other threads will
 						// be able to get the result one way or the other.
-						ProcessType::g_cache.setIfUncached(
-							cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
-							ProcessType::cacheCostFunction
-						);
+						size_t cost = 0;
+						if(
+							ProcessType::g_cache.setIfUncached(
+								cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
+								[&cost] ( const typename ProcessType::ResultType &result ) {
+									return cost = ProcessType::cacheCostFunction( result );
+								},
+								duration.count()
+							)
+						)
+						{
+							cacheEvent( threadState, process.plug(), process.type(), Monitor::CacheEvent::Store, cost );
+						}
 					}
 					catch( ... )
 					{
@@ -443,6 +491,14 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	return collaboration->resultOrException();
 }
 
+inline void Process::cacheEvent( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheEvent event, size_t cost )
+{
+	if( s.m_monitors && !s.m_monitors->empty() )
+	{
+		cacheEventInternal( s, plug, processType, event, cost );
+	}
+}
+
 inline bool Process::forceMonitoring( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType )
 {
 	if( s.m_mightForceMonitoring )
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+#include "Gaffer/Plug.h"
+
+#include "IECore/MurmurHash.h"
+
+#include "boost/unordered_map.hpp"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <chrono>
+#include <iosfwd>
+#include <vector>
+
+namespace Gaffer
+{
+
+/// A monitor which records a timeline of process and cache events, for
+/// export in the Chrome trace event format. Traces may be viewed in Perfetto
+/// (https://ui.perfetto.dev) or `chrome://tracing`, and show which thread
+/// performed each process and when, making it possible to identify the
+/// serialisation points and collaborative waits that limit scaling.
+class GAFFER_API TraceMonitor : public Monitor
+{
+
+	public :
+
+		/// Each thread records events into its own ring buffer, holding up to
+		/// `eventsPerThread` events. When a buffer is full, the oldest events
+		/// are discarded to make room for new ones.
+		explicit TraceMonitor( size_t eventsPerThread = 100000 );
+		~TraceMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( TraceMonitor )
+
+		/// Query functions. These are not thread-safe, and must be called
+		/// only when the Monitor is not active (as defined by `Monitor::Scope`).
+		///
+		/// Returns the number of events held, summed over all threads.
+		size_t numEvents() const;
+		/// Returns the number of events discarded due to full buffers.
+		size_t numDiscardedEvents() const;
+		/// Writes all held events as JSON in the Chrome trace event format.
+		void writeTrace( std::ostream &stream ) const;
+		void writeTrace( const std::string &fileName ) const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+		void cacheEvent( const Plug *plug, const IECore::InternedString &processType, CacheEvent event, size_t cost ) override;
+		void collaborativeWaitStarted( const Plug *plug, const IECore::InternedString &processType ) override;
+		void collaborativeWaitFinished( const Plug *plug, const IECore::InternedString &processType ) override;
+
+	private :
+
+		enum class EventType : unsigned char
+		{
+			ProcessBegin,
+			ProcessEnd,
+			WaitBegin,
+			WaitEnd,
+			Cache
+		};
+
+		struct Event
+		{
+			EventType type;
+			CacheEvent cacheEvent;
+			// Nanoseconds since the monitor was constructed.
+			int64_t time;
+			const Plug *plug;
+			IECore::InternedString processType;
+			IECore::MurmurHash contextHash;
+		};
+
+		// Events are recorded into per-thread ring buffers, so
+		// no synchronisation is needed between threads.
+		struct ThreadData
+		{
+			ThreadData();
+			int threadId;
+			std::vector<Event> events;
+			// Total number of events recorded, including
+			// those that have since been discarded.
+			size_t numRecorded;
+			// Keeps alive the plugs referenced by `events`, without
+			// the cost of reference counting every event.
+			boost::unordered_map<const Plug *, ConstPlugPtr> plugs;
+		};
+
+		void record( EventType type, const Plug *plug, const IECore::InternedString &processType, const IECore::MurmurHash &contextHash, CacheEvent cacheEvent = CacheEvent::Hit );
+
+		const size_t m_eventsPerThread;
+		const std::chrono::steady_clock::time_point m_startTime;
+		mutable tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
+
+};
+
+IE_CORE_DECLAREPTR( TraceMonitor )
+
+} // namespace Gaffer
@@ -114,6 +114,14 @@ class IECORE_EXPORT TypedObjectPlug : public ValuePlug
 		/// avoids unnecessary conversions, but it also avoids churn in
 		/// the ValuePlug cache.
 		ConstValuePtr getValue( const IECore::MurmurHash *precomputedHash = nullptr ) const;
+		/// Returns the values of multiple plugs, each evaluated in the corresponding
+		/// context from `contexts`, or in the current context if `contexts` is empty.
+		/// This is more efficient than calling `getValue()` for each plug in turn,
+		/// because cache lookups are performed up front and uncached values are
+		/// computed in parallel. Intended for use by nodes which must gather values
+		/// from many inputs or locations. Precomputed hashes may be passed as
+		/// for `getValue()`, one per plug.
+		static std::vector<ConstValuePtr> getValues( const std::vector<const TypedObjectPlug *> &plugs, const std::vector<const Context *> &contexts = {}, const std::vector<IECore::MurmurHash> &precomputedHashes = {} );
 
 		void setFrom( const ValuePlug *other ) override;
 
@@ -55,4 +55,27 @@ inline typename TypedObjectPlug<T>::ConstValuePtr TypedObjectPlug<T>::getValue(
 	}
 }
 
+template<class T>
+std::vector<typename TypedObjectPlug<T>::ConstValuePtr> TypedObjectPlug<T>::getValues( const std::vector<const TypedObjectPlug *> &plugs, const std::vector<const Context *> &contexts, const std::vector<IECore::MurmurHash> &precomputedHashes )
+{
+	std::vector<IECore::ConstObjectPtr> objects;
+	getObjectValues( std::vector<const ValuePlug *>( plugs.begin(), plugs.end() ), contexts, objects, precomputedHashes );
+
+	std::vector<ConstValuePtr> result; result.reserve( objects.size() );
+	for( size_t i = 0; i < objects.size(); ++i )
+	{
+		if( !objects[i] || !objects[i]->isInstanceOf( ValueType::staticTypeId() ) )
+		{
+			throw IECore::Exception( fmt::format(
+				"{} : getObjectValues() didn't return expected type (wanted {} but got {}). Is the hash being computed correctly?",
+				plugs[i]->fullName(), ValueType::staticTypeName(), objects[i] ? objects[i]->typeName() : "nullptr"
+			) );
+		}
+		// Avoid unnecessary reference count manipulations.
+		result.push_back( boost::static_pointer_cast<const ValueType>( std::move( objects[i] ) ) );
+	}
+
+	return result;
+}
+
 } // namespace Gaffer
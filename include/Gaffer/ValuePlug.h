@@ -41,9 +41,12 @@
 
 #include "IECore/Object.h"
 
+#include <vector>
+
 namespace Gaffer
 {
 
+IE_CORE_FORWARDDECLARE( Context )
 IE_CORE_FORWARDDECLARE( DependencyNode )
 
 /// The Plug base class defines the concept of a connection
@@ -158,6 +161,23 @@ class GAFFER_API ValuePlug : public Plug
 		static size_t cacheMemoryUsage();
 		/// Clears the cache.
 		static void clearCache();
+		/// Returns the number of values that have been evicted from the
+		/// cache to keep it within the memory limit. See CacheMonitor for
+		/// more detailed cache statistics.
+		static size_t cacheEvictions();
+		/// Determines which values are discarded when the cache exceeds
+		/// its memory limit. "LRU" discards the least recently used values
+		/// first. "CostAware" weighs the time taken to compute each value
+		/// against its memory usage, so that values which are expensive to
+		/// recompute are retained in preference to values which are cheap
+		/// to recompute.
+		enum class CacheEvictionPolicy
+		{
+			LRU,
+			CostAware
+		};
+		static void setCacheEvictionPolicy( CacheEvictionPolicy policy );
+		static CacheEvictionPolicy getCacheEvictionPolicy();
 		//@}
 
 		/// @name Hash cache management
@@ -172,6 +192,10 @@ class GAFFER_API ValuePlug : public Plug
 		static void setHashCacheSizeLimit( size_t maxEntriesPerThread );
 		/// Returns the total number of entries in both global and per-thread hash caches
 		static size_t hashCacheTotalUsage();
+		/// Returns the total number of entries that have been evicted from
+		/// both global and per-thread hash caches to keep them within their
+		/// size limits.
+		static size_t hashCacheEvictions();
 		/// Clears the hash cache.
 		/// > Note : By default, clearing occurs on a per-thread basis as
 		/// > and when each thread next accesses its cache. Pass `now = true`
@@ -184,18 +208,78 @@ class GAFFER_API ValuePlug : public Plug
 		/// plugs.  If you have incorrect affects() methods, you can use
 		/// "Legacy", which pessimisticly dirties all hash cache entries
 		/// when something changes, or "Checked" which helps identify
-		/// bad affects() methods by throwing exceptions.
+		/// bad affects() methods by throwing exceptions. "Compact" behaves
+		/// as "Standard", but folds the plug, context and dirty count into
+		/// a single digest which is used to index a more efficient per-thread
+		/// cache.
 		enum class HashCacheMode
 		{
 			Standard,
 			Checked,
-			Legacy
+			Legacy,
+			Compact
 		};
 		static void setHashCacheMode( HashCacheMode hashCacheMode );
 		static HashCacheMode getHashCacheMode();
 
 		//@}
 
+		/// @name Persistent cache management
+		/// Values which are expensive to compute may also be stored in a
+		/// persistent cache on disk. This is consulted when a value is
+		/// missing from the in-memory cache, allowing work to be shared
+		/// between separate processes running on the same machine, such as
+		/// consecutive frames of a render or sibling tasks in a dispatch.
+		///
+		/// > Caution : Entries are keyed by `ComputeNode::hash()`, so may
+		/// > only be shared between processes if the hash is stable from
+		/// > process to process. Objects which cannot be serialised are
+		/// > never stored.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the directory in which the persistent cache is stored.
+		/// The default value of "" disables the persistent cache.
+		static void setPersistentCacheDirectory( const std::string &directory );
+		static std::string getPersistentCacheDirectory();
+		/// Sets the maximum amount of disk space in bytes to use for
+		/// the persistent cache.
+		static void setPersistentCacheSizeLimit( size_t bytes );
+		static size_t getPersistentCacheSizeLimit();
+		/// Sets the minimum duration of a compute for its result to be
+		/// written to the persistent cache. Results which are quicker to
+		/// compute are not worth the cost of writing and reading. The
+		/// persistent cache is only searched for plugs which have
+		/// previously exceeded this threshold, so that cheap computes
+		/// don't pay for filesystem access.
+		static void setPersistentCacheComputeThreshold( double seconds );
+		static double getPersistentCacheComputeThreshold();
+		/// Returns the current disk usage of the persistent cache in bytes.
+		/// Values are written to the persistent cache in the background, so
+		/// this first waits for any pending writes to complete.
+		static size_t persistentCacheUsage();
+		/// Removes all entries from the persistent cache.
+		static void clearPersistentCache();
+
+		struct PersistentCacheStatistics
+		{
+			/// Number of values loaded from the persistent cache.
+			size_t hits = 0;
+			/// Number of lookups that didn't find a value.
+			size_t misses = 0;
+			/// Number of values written to the persistent cache.
+			size_t writes = 0;
+			/// Number of values that could not be written or read.
+			size_t failures = 0;
+			/// Number of entries removed to limit disk usage.
+			size_t evictions = 0;
+		};
+
+		/// As for `persistentCacheUsage()`, waits for pending writes before
+		/// returning.
+		static PersistentCacheStatistics persistentCacheStatistics();
+		static void resetPersistentCacheStatistics();
+		//@}
+
 		/// Returns a counter that increments when this plug is been dirtied
 		/// ( but doesn't necessarily start at 0 ). This is used internally
 		/// for cache invalidation but may also be useful for debugging and
@@ -251,6 +335,16 @@ class GAFFER_API ValuePlug : public Plug
 		/// so this feature is not suitable for use in classes that override that method.
 		template<typename T = IECore::Object>
 		const T *getObjectValue( IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash = nullptr ) const;
+		/// Batched form of `getObjectValue()`, for use by nodes which need
+		/// the values of many plugs, or of one plug in many contexts. Each plug
+		/// is evaluated in the corresponding context from `contexts`, or in the
+		/// current context if `contexts` is empty. All hashes are computed and
+		/// looked up in the cache up front, and any values which are not cached
+		/// are then computed in parallel. Results are returned via `values`, which
+		/// is resized to match `plugs`. If `precomputedHashes` is not empty, it
+		/// must contain one hash per plug, subject to the same caution as for
+		/// `getObjectValue()`.
+		static void getObjectValues( const std::vector<const ValuePlug *> &plugs, const std::vector<const Context *> &contexts, std::vector<IECore::ConstObjectPtr> &values, const std::vector<IECore::MurmurHash> &precomputedHashes = {} );
 		/// Should be called by derived classes when they wish to set the plug
 		/// value - the value is referenced directly (not copied) and so must
 		/// not be changed following the call.
@@ -37,8 +37,12 @@
 
 #pragma once
 
+#include "Gaffer/Context.h"
+
 #include "IECorePython/ScopedGILRelease.h"
 
+#include "boost/python/suite/indexing/container_utils.hpp"
+
 namespace GafferBindings
 {
 
@@ -97,6 +101,42 @@ IECore::ObjectPtr getValue( typename T::Ptr p, const IECore::MurmurHash *precomp
 	return nullptr;
 }
 
+template<typename T>
+boost::python::list getValues( boost::python::object pythonPlugs, boost::python::object pythonContexts, bool copy=true )
+{
+	std::vector<typename T::Ptr> plugPtrs;
+	boost::python::container_utils::extend_container( plugPtrs, pythonPlugs );
+	std::vector<Gaffer::ContextPtr> contextPtrs;
+	if( pythonContexts != boost::python::object() )
+	{
+		boost::python::container_utils::extend_container( contextPtrs, pythonContexts );
+	}
+
+	std::vector<const T *> plugs;
+	for( const auto &p : plugPtrs )
+	{
+		plugs.push_back( p.get() );
+	}
+	std::vector<const Gaffer::Context *> contexts;
+	for( const auto &c : contextPtrs )
+	{
+		contexts.push_back( c.get() );
+	}
+
+	std::vector<typename T::ConstValuePtr> values;
+	{
+		IECorePython::ScopedGILRelease r;
+		values = T::getValues( plugs, contexts );
+	}
+
+	boost::python::list result;
+	for( const auto &v : values )
+	{
+		result.append( copy ? v->copy() : boost::const_pointer_cast<typename T::ValueType>( v ) );
+	}
+	return result;
+}
+
 template<typename T>
 typename T::ValuePtr defaultValue( typename T::Ptr p, bool copy )
 {
@@ -160,6 +200,8 @@ TypedObjectPlugClass<T, TWrapper>::TypedObjectPlugClass( const char *docString )
 	this->def( "defaultValue", &Detail::defaultValue<T>, ( boost::python::arg_( "_copy" ) = true ) );
 	this->def( "setValue", Detail::setValue<T>, ( boost::python::arg_( "value" ), boost::python::arg_( "_copy" ) = true ) );
 	this->def( "getValue", Detail::getValue<T>, ( boost::python::arg_( "_precomputedHash" ) = boost::python::object(), boost::python::arg_( "_copy" ) = true ) );
+	this->def( "getValues", Detail::getValues<T>, ( boost::python::arg_( "plugs" ), boost::python::arg_( "contexts" ) = boost::python::object(), boost::python::arg_( "_copy" ) = true ) );
+	this->staticmethod( "getValues" );
 
 	boost::python::scope s = *this;
 
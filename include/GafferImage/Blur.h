@@ -92,6 +92,8 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		void hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		IECore::ConstFloatVectorDataPtr computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const override;
 
+		void prefetch( const Gaffer::ValuePlug *output, const Gaffer::Context *context, PrefetchRequests &requests ) const override;
+
 		static size_t g_firstPlugIndex;
 
 };
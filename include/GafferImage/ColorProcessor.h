@@ -94,6 +94,14 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		Gaffer::ObjectPlug *colorDataPlug();
 		const Gaffer::ObjectPlug *colorDataPlug() const;
 
+		// Adjacent ColorProcessors are fused together, so that only the last
+		// node in a chain needs to compute (and cache) `colorDataPlug()`. This
+		// fills `processors` with the nodes in the chain starting with this
+		// one and working upstream, and returns the input to the first of them.
+		// Layers are only fused if all of R, G and B exist and are processed.
+		// Must be called in a GlobalScope.
+		const ImagePlug *fusedChain( const std::string &layerName, std::vector<const ColorProcessor *> &processors ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -84,6 +84,7 @@ class GAFFERSCENE_API AttributeProcessor : public FilteredSceneProcessor
 
 		void hashAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const final;
 		IECore::ConstCompoundObjectPtr computeAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const final;
+		void hashSubtree( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const final;
 
 		/// Private constructor and friendship for old nodes which are filtered to everything
 		/// by default. This was a mistake, and we want to ensure that we don't repeat the mistake
@@ -0,0 +1,151 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/ScenePlug.h"
+
+#include "IECore/Export.h"
+#include "IECore/PathMatcher.h"
+#include "IECore/RefCounted.h"
+
+IECORE_PUSH_DEFAULT_VISIBILITY
+#include "Imath/ImathLine.h"
+#include "Imath/ImathPlane.h"
+IECORE_POP_DEFAULT_VISIBILITY
+
+#include <atomic>
+#include <vector>
+
+namespace IECoreScene
+{
+
+IE_CORE_FORWARDDECLARE( Camera )
+
+} // namespace IECoreScene
+
+namespace GafferScene
+{
+
+IE_CORE_FORWARDDECLARE( BoundingVolumeHierarchy )
+
+/// An acceleration structure for spatial queries on a scene. The world-space
+/// bounds of all leaf locations below a root are gathered in a single parallel
+/// traversal and organised into a bounding volume hierarchy, so that queries
+/// visit only the parts of the hierarchy that are relevant, regardless of how
+/// the scene itself is structured. Only leaf locations are indexed, as they
+/// have the tightest bounds; their ancestors are implied by the PathMatcher
+/// results in the usual way.
+///
+/// > Caution : Locations with children are never returned by queries, even
+/// > if they have an object of their own. Only the bounds of their
+/// > descendants are considered.
+///
+/// The hierarchy reflects the scene at the time of construction, and is not
+/// updated when the scene changes. Clients that perform many queries should
+/// hold on to a hierarchy and reuse it, or use `acquire()` to share one
+/// with other clients.
+class GAFFERSCENE_API BoundingVolumeHierarchy : public IECore::RefCounted
+{
+
+	public :
+
+		/// Builds a hierarchy for `scene` below `root`, in the current context.
+		/// Throws if `root` does not exist.
+		BoundingVolumeHierarchy( const ScenePlug *scene, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+		~BoundingVolumeHierarchy() override;
+
+		IE_CORE_DECLAREMEMBERPTR( BoundingVolumeHierarchy )
+
+		/// Returns a hash uniquely identifying the hierarchy that would be built
+		/// for `scene` and `root` in the current context. This is derived from
+		/// `ScenePlug::subtreeHash()`, so is cheap to compute once the subtree
+		/// hash has been cached.
+		static IECore::MurmurHash hash( const ScenePlug *scene, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+		/// Returns a hierarchy for `scene` and `root` in the current context, reusing
+		/// a previously built hierarchy from a cache where possible.
+		static ConstBoundingVolumeHierarchyPtr acquire( const ScenePlug *scene, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+
+		const ScenePlug::ScenePath &root() const;
+		/// Number of leaf locations indexed by the hierarchy.
+		size_t size() const;
+		/// World-space bound of all indexed locations.
+		Imath::Box3f bound() const;
+
+		/// Queries
+		/// =======
+		///
+		/// Each query returns the leaf locations with world-space bounds that
+		/// intersect the specified region. Bounds are tested conservatively,
+		/// so locations may be returned even if their geometry doesn't quite
+		/// intersect the region.
+
+		IECore::PathMatcher intersecting( const Imath::Box3f &bound ) const;
+		/// The frustum is defined by planes with normals pointing inwards.
+		/// Locations are considered to intersect unless they are entirely
+		/// behind one of the planes.
+		IECore::PathMatcher intersecting( const std::vector<Imath::Plane3f> &frustum ) const;
+		/// The ray extends from `ray.pos` in the direction of `ray.dir` only.
+		IECore::PathMatcher intersecting( const Imath::Line3f &ray ) const;
+
+		/// Returns the planes of the frustum for `camera`, transformed into
+		/// world space by `cameraToWorld`. Planes are provided for the screen
+		/// window and clipping planes, in a form suitable for use with
+		/// `intersecting()`.
+		static std::vector<Imath::Plane3f> frustum( const IECoreScene::Camera *camera, const Imath::M44f &cameraToWorld );
+
+	private :
+
+		struct Node;
+		struct Item;
+
+		void build( size_t nodeIndex, size_t begin, size_t end, std::atomic<size_t> &nextNode );
+		template<typename Predicate>
+		IECore::PathMatcher query( Predicate &&predicate ) const;
+		IECore::PathMatcher paths( std::vector<size_t> &locations ) const;
+
+		const ScenePlug::ScenePath m_root;
+
+		// Structure of the scene, as stored by SceneSnapshot.
+		std::vector<IECore::InternedString> m_names;
+		std::vector<size_t> m_parents;
+
+		std::vector<Node> m_nodes;
+		std::vector<Item> m_items;
+
+};
+
+} // namespace GafferScene
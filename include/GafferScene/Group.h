@@ -95,6 +95,8 @@ class GAFFERSCENE_API Group : public SceneProcessor
 		IECore::ConstInternedStringVectorDataPtr computeSetNames( const Gaffer::Context *context, const ScenePlug *parent ) const override;
 		IECore::ConstPathMatcherDataPtr computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const override;
 
+		void prefetch( const Gaffer::ValuePlug *output, const Gaffer::Context *context, PrefetchRequests &requests ) const override;
+
 	private :
 
 		Gaffer::ObjectPlug *mappingPlug();
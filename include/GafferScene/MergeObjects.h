@@ -42,6 +42,8 @@
 
 #include "IECore/CompoundData.h"
 
+#include <functional>
+
 namespace Gaffer
 {
 
@@ -126,6 +128,27 @@ class GAFFERSCENE_API MergeObjects : public FilteredSceneProcessor
 			const Gaffer::Context *context
 		) const = 0;
 
+		/// Returns the object for source `i`, together with the transform that maps it into
+		/// the space of the output location. May be called concurrently, and more than once
+		/// for the same source.
+		using SourceFunction = std::function< std::pair< IECore::ConstObjectPtr, Imath::M44f >( size_t ) >;
+
+		/// Called from `compute()` to choose between `computeStreamedMergedObject()` and
+		/// `computeMergedObject()`. Both must produce the same result, so the choice is not
+		/// included in the hash. The default implementation returns false; derived classes
+		/// that implement a streamed merge may return true based on the value of a plug.
+		virtual bool useStreamedMerge( const Gaffer::Context *context ) const;
+
+		/// Alternative merge function used when `useStreamedMerge()` returns true. Rather than
+		/// receiving all the sources up front, implementations fetch them on demand, and may
+		/// release each one as soon as it has been used, so that peak memory stays close to the
+		/// size of the result. The default implementation fetches all the sources and calls
+		/// `computeMergedObject()`.
+		virtual IECore::ConstObjectPtr computeStreamedMergedObject(
+			size_t numSources, const SourceFunction &source,
+			const Gaffer::Context *context
+		) const;
+
 
 
 
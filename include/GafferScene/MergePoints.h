@@ -38,6 +38,8 @@
 
 #include "GafferScene/MergeObjects.h"
 
+#include "Gaffer/TypedPlug.h"
+
 namespace GafferScene
 {
 
@@ -50,9 +52,14 @@ class GAFFERSCENE_API MergePoints : public MergeObjects
 		explicit MergePoints( const std::string &name=defaultName<MergePoints>() );
 		~MergePoints() override;
 
+		Gaffer::BoolPlug *streamingPlug();
+		const Gaffer::BoolPlug *streamingPlug() const;
+
 	protected :
 
+		bool useStreamedMerge( const Gaffer::Context *context ) const override;
 		IECore::ConstObjectPtr computeMergedObject( const std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > &sources, const Gaffer::Context *context ) const override;
+		IECore::ConstObjectPtr computeStreamedMergedObject( size_t numSources, const SourceFunction &source, const Gaffer::Context *context ) const override;
 
 	private :
 
@@ -53,6 +53,12 @@ namespace IECoreScenePreview
 /// If the Bool `cr:unrenderable` attribute is set to true at a location, then
 /// calls to object, light, lightFilter, camera, etc... for that location will
 /// return nullptr rather than a valid ObjectInterface.
+///
+/// If the Bool `cr:instances` option is set to true, then `supportsInstances()`
+/// returns true, and calls to `instances()` are captured as a single object,
+/// with the instance arrays available via `CapturedObject::capturedInstances()`.
+/// Otherwise each instance is captured as a separate object, using the default
+/// implementation of `instances()`.
 class GAFFERSCENE_API CapturingRenderer : public Renderer
 {
 
@@ -123,6 +129,11 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 				uint32_t id() const;
 
+				/// For objects created by `instances()`, returns a CompoundObject
+				/// containing the prototypes and per-instance arrays. Returns null
+				/// for all other objects.
+				const IECore::CompoundObject *capturedInstances() const;
+
 				/// Renderer interface
 				/// ==================
 
@@ -148,6 +159,7 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 				int m_numAttributeEdits;
 				std::unordered_map<IECore::InternedString, std::pair<ConstObjectSetPtr, int>> m_capturedLinks;
 				uint32_t m_id;
+				IECore::ConstCompoundObjectPtr m_capturedInstances;
 
 		};
 
@@ -169,6 +181,8 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 		ObjectInterfacePtr lightFilter( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) override;
+		bool supportsInstances() const override;
+		ObjectInterfacePtr instances( const std::string &name, const InstanceArray &instances ) override;
 		void render() override;
 		void pause() override;
 
@@ -180,6 +194,7 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 		RenderType m_renderType;
 		std::atomic_bool m_rendering;
+		bool m_captureInstances;
 		using ObjectMap = tbb::concurrent_hash_map<std::string, CapturedObject *>;
 		ObjectMap m_capturedObjects;
 
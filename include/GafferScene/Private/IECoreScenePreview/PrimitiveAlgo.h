@@ -40,6 +40,8 @@
 #include "IECore/Canceller.h"
 #include "IECore/Object.h"
 
+#include <functional>
+
 namespace IECoreScenePreview
 {
 
@@ -61,6 +63,20 @@ GAFFERSCENE_API IECoreScene::PrimitivePtr mergePrimitives(
 	const IECore::Canceller *canceller = nullptr
 );
 
+// Provides the source primitives for the streaming form of `mergePrimitives()`.
+using PrimitiveSource = std::function< std::pair< IECoreScene::ConstPrimitivePtr, Imath::M44f >( size_t ) >;
+
+// Streaming form of `mergePrimitives()`, for merges too large to hold all the sources in
+// memory at once. `source( i )` is called concurrently, twice for each index : once to
+// measure the primitive, and once to copy it into the result. It must return the same
+// primitive both times, and may return null to skip an index. Each source is released as
+// soon as it has been used, so peak memory is close to the size of the result. Returns
+// null if every source is skipped.
+GAFFERSCENE_API IECoreScene::PrimitivePtr mergePrimitives(
+	size_t numPrimitives, const PrimitiveSource &source,
+	const IECore::Canceller *canceller = nullptr
+);
+
 } // namespace MeshAlgo
 
 } // namespace IECoreScenePreview
@@ -298,6 +298,72 @@ class GAFFERSCENE_API Renderer : public IECore::RefCounted
 		/// As above, but specifying a deforming object.
 		virtual ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) = 0;
 
+		/// Describes many instances of a small number of prototype objects
+		/// using flat arrays, so that renderers with native support for point
+		/// instancing can avoid the overhead of a separate ObjectInterface
+		/// per instance. All pointers are owned by the caller, and are only
+		/// valid for the duration of the call to `instances()`.
+		struct InstanceArray
+		{
+
+			struct Prototype
+			{
+				/// Used to name the instances of this prototype.
+				std::string name;
+				/// Object samples, in the same form as for `object()`.
+				/// `sampleTimes` is empty unless the prototype is deforming.
+				std::vector<const IECore::Object *> samples;
+				std::vector<float> sampleTimes;
+				/// The attributes for all instances of this prototype.
+				const IECore::CompoundObject *attributes = nullptr;
+				/// The result of passing `attributes` to `Renderer::attributes()`.
+				const AttributesInterface *rendererAttributes = nullptr;
+			};
+
+			std::vector<Prototype> prototypes;
+
+			/// Per-instance arrays
+			/// ===================
+			///
+			/// Each array contains one element per instance.
+
+			/// Index into `prototypes`, or `-1` for instances which
+			/// should not be rendered.
+			const std::vector<int> *prototypeIndices = nullptr;
+			/// Unique identifier for each instance.
+			const std::vector<int64_t> *ids = nullptr;
+			/// Instance transforms, including the transform of the
+			/// prototype itself. When `transformTimes` has more than one
+			/// element, the transforms for all instances at the first time
+			/// are followed by all transforms at the second time, and so on.
+			const std::vector<Imath::M44f> *transforms = nullptr;
+			std::vector<float> transformTimes;
+			/// Per-instance attributes, each being a VectorTypedData
+			/// with one element per instance. These take precedence
+			/// over the attributes of the prototype.
+			IECore::CompoundDataMap attributes;
+
+			size_t size() const { return prototypeIndices ? prototypeIndices->size() : 0; }
+
+		};
+
+		/// Returns true if the renderer has a native implementation of
+		/// `instances()`. Clients should only use `instances()` when this
+		/// returns true, and should otherwise output instances individually
+		/// with `object()`, which avoids building the arrays and keeping every
+		/// instance alive for the duration of the call. The default
+		/// implementation returns false.
+		virtual bool supportsInstances() const;
+		/// Adds a named set of instances, returning a single ObjectInterface
+		/// that represents them all. Renderers with native support for
+		/// point instancing should implement a suitable override. The default
+		/// implementation outputs each instance individually using `object()`,
+		/// naming them `<name>/<prototypeName>/<id>`, or `<prototypeName>/<id>`
+		/// if `name` is empty. The ObjectInterface it returns supports
+		/// `link()` and `assignID()` edits, but not `transform()` edits, and
+		/// `attributes()` edits always return false.
+		virtual ObjectInterfacePtr instances( const std::string &name, const InstanceArray &instances );
+
 		/// Performs the render - should be called after the
 		/// entire scene has been specified using the methods
 		/// above. Batch and SceneDescripton renders will have
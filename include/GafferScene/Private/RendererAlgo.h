@@ -50,6 +50,7 @@
 #include "tbb/concurrent_hash_map.h"
 #include "tbb/spin_mutex.h"
 
+#include <atomic>
 #include <functional>
 
 namespace GafferScene
@@ -105,6 +106,60 @@ GAFFERSCENE_API bool transformSamples( const Gaffer::M44fPlug *transformPlug, co
 /// Primitives and Cameras, since other object types cannot be interpolated anyway.
 GAFFERSCENE_API bool objectSamples( const Gaffer::ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, std::vector<IECore::ConstObjectPtr> &samples, IECore::MurmurHash *hash = nullptr );
 
+/// Utility class to share identical objects between the locations of a render.
+/// Objects are identified by the hash computed by `objectSamples()`, so
+/// duplicates are found without computing the object again, and all locations
+/// with the same object are given the same samples. This means that renderer
+/// backends can instance duplicates instead of converting them repeatedly. To
+/// avoid holding the whole scene in memory, samples are only retained once an
+/// object has been seen at more than one location.
+class GAFFERSCENE_API ObjectDeduplicator : boost::noncopyable
+{
+
+	public :
+
+		ObjectDeduplicator();
+
+		/// As for the `objectSamples()` function, but returning samples that
+		/// are shared with any other location with the same hash. May be called
+		/// concurrently with itself.
+		bool objectSamples( const Gaffer::ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, std::vector<IECore::ConstObjectPtr> &samples, IECore::MurmurHash *hash = nullptr );
+
+		/// Releases all retained samples. Statistics are not reset. Must not be
+		/// called concurrently with other methods.
+		void clear();
+
+		struct Statistics
+		{
+			/// The number of distinct objects seen.
+			size_t uniqueObjects = 0;
+			/// The number of locations whose object had already been seen at
+			/// another location.
+			size_t duplicateObjects = 0;
+			/// The total memory usage of the duplicates. This is the memory saved
+			/// by backends that instance them.
+			size_t duplicateMemory = 0;
+		};
+
+		Statistics statistics() const;
+
+	private :
+
+		struct Entry
+		{
+			std::vector<IECore::ConstObjectPtr> samples;
+			size_t memoryUsage = 0;
+		};
+
+		using EntryMap = tbb::concurrent_hash_map<IECore::MurmurHash, Entry>;
+		EntryMap m_entries;
+
+		std::atomic_size_t m_uniqueObjects;
+		std::atomic_size_t m_duplicateObjects;
+		std::atomic_size_t m_duplicateMemory;
+
+};
+
 GAFFERSCENE_API void outputOptions( const IECore::CompoundObject *globals, IECoreScenePreview::Renderer *renderer );
 GAFFERSCENE_API void outputOptions( const IECore::CompoundObject *globals, const IECore::CompoundObject *previousGlobals, IECoreScenePreview::Renderer *renderer );
 
@@ -130,8 +185,12 @@ class GAFFERSCENE_API RenderSets : boost::noncopyable
 		};
 
 		/// Returns a bitmask describing which sets
-		/// changed.
-		unsigned update( const ScenePlug *scene );
+		/// changed. If `changedPaths` is specified, then
+		/// locations whose `attributes()` may have been
+		/// affected by the update are added to it. Changes
+		/// to a location also affect its descendants, but
+		/// they are not added explicitly.
+		unsigned update( const ScenePlug *scene, IECore::PathMatcher *changedPaths = nullptr );
 		void clear();
 
 		const IECore::PathMatcher &camerasSet() const;
@@ -282,7 +341,9 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 GAFFERSCENE_API void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer );
 GAFFERSCENE_API void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
 GAFFERSCENE_API void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
-GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+/// If `objectDeduplicator` is not specified, then objects are deduplicated
+/// within this call only.
+GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath(), ObjectDeduplicator *objectDeduplicator = nullptr );
 
 } // namespace RendererAlgo
 
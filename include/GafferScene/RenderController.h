@@ -122,6 +122,7 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 			DeformationBlurGlobalComponent = 32,
 			CameraShutterGlobalComponent = 64,
 			IncludedPurposesGlobalComponent = 128,
+			RenderSetMembershipGlobalComponent = 256,
 			CapsuleAffectingGlobalComponents = TransformBlurGlobalComponent | DeformationBlurGlobalComponent | IncludedPurposesGlobalComponent,
 			AllGlobalComponents = GlobalsGlobalComponent | SetsGlobalComponent | RenderSetsGlobalComponent | CameraOptionsGlobalComponent | TransformBlurGlobalComponent | DeformationBlurGlobalComponent | IncludedPurposesGlobalComponent
 		};
@@ -161,7 +162,11 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 		unsigned m_changedGlobalComponents;
 		Private::RendererAlgo::RenderOptions m_renderOptions;
 		Private::RendererAlgo::RenderSets m_renderSets;
+		// Locations affected by changes to `m_renderSets` since
+		// `m_changedGlobalComponents` was last cleared.
+		IECore::PathMatcher m_changedRenderSetPaths;
 		std::unique_ptr<Private::RendererAlgo::LightLinks> m_lightLinks;
+		Private::RendererAlgo::ObjectDeduplicator m_objectDeduplicator;
 		IECoreScenePreview::Renderer::ObjectInterfacePtr m_defaultCamera;
 		IECoreScenePreview::Renderer::AttributesInterfacePtr m_defaultAttributes;
 
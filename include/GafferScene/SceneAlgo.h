@@ -48,6 +48,8 @@
 #include "IECore/Export.h"
 
 IECORE_PUSH_DEFAULT_VISIBILITY
+#include "Imath/ImathLine.h"
+#include "Imath/ImathPlane.h"
 #include "Imath/ImathVec.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
@@ -126,6 +128,20 @@ GAFFERSCENE_API IECore::MurmurHash matchingPathsHash( const IECore::PathMatcher
 template <class ThreadableFunctor>
 void parallelProcessLocations( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 
+/// As for `parallelProcessLocations()`, and accepting the same functors, but optimised
+/// for wide hierarchies such as the output of an Instancer. Rather than a task and a
+/// PathScope per location, siblings are processed in batches, with each batch reusing a
+/// single PathScope. The batch size is chosen adaptively, by timing the work done for
+/// each parent location and sizing batches of its children so that each represents a
+/// worthwhile amount of work. Locations with two or more children are always processed
+/// in at least two batches, so that narrow hierarchies are still processed in parallel.
+///
+/// > Note : Since a batch processes its locations serially, the order in which siblings
+/// > are visited is even less predictable than for `parallelProcessLocations()`. The
+/// > parent-before-child guarantee still holds.
+template <class ThreadableFunctor>
+void parallelProcessLocationsBatched( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+
 /// Calls a functor on all locations in the scene. This differs from `parallelProcessLocations()` in that a single instance
 /// of the functor is used for all locations.
 /// The functor must take `( const ScenePlug *, const ScenePlug::ScenePath & )`, and can return false to prune traversal.
@@ -153,6 +169,21 @@ IECore::PathMatcher findAll( const ScenePlug *scene, Predicate &&predicate, cons
 /// returns locations where the attribute has that value.
 GAFFERSCENE_API IECore::PathMatcher findAllWithAttribute( const ScenePlug *scene, IECore::InternedString name, const IECore::Object *value = nullptr, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 
+/// Spatial queries
+/// ===============
+///
+/// Return the leaf locations whose world-space bounds intersect a region. Locations with
+/// children are never returned, even if they have an object. Queries use a
+/// BoundingVolumeHierarchy, which is cached and shared between queries on the same scene,
+/// so that after the first query only a cached subtree hash is required. Clients that make
+/// many queries of a scene that is known not to change should use a BoundingVolumeHierarchy
+/// directly.
+
+GAFFERSCENE_API IECore::PathMatcher findIntersecting( const ScenePlug *scene, const Imath::Box3f &bound, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+/// Frustum planes have normals pointing inwards. See `BoundingVolumeHierarchy::frustum()`.
+GAFFERSCENE_API IECore::PathMatcher findIntersecting( const ScenePlug *scene, const std::vector<Imath::Plane3f> &frustum, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+GAFFERSCENE_API IECore::PathMatcher findIntersecting( const ScenePlug *scene, const Imath::Line3f &ray, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+
 /// Globals
 /// =======
 
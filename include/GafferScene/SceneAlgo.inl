@@ -38,6 +38,9 @@
 
 #include "tbb/enumerable_thread_specific.h"
 #include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <chrono>
 
 namespace GafferScene
 {
@@ -87,6 +90,77 @@ void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Ga
 	}
 }
 
+// Target duration for each batch processed by `parallelProcessLocationsBatched()`.
+// This is long enough to amortise the cost of spawning a task and constructing a
+// PathScope, but short enough for work stealing to balance the load effectively.
+constexpr std::chrono::nanoseconds g_locationBatchDuration = std::chrono::microseconds( 100 );
+
+// Processes `path` using `pathScope`, which must have been constructed on the
+// current thread. `path` is modified during the walk, but is restored before
+// returning. Because the scope only stores a pointer to the path, we must call
+// `setPath()` after every modification and before any computation.
+template<typename ThreadableFunctor>
+void parallelProcessLocationsBatchedWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, ScenePlug::PathScope &pathScope, ScenePlug::ScenePath &path, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
+{
+	pathScope.setPath( &path );
+
+	// Time the work for this location alone, not including its descendants.
+	// We use it to estimate the cost of each child, so that we can choose
+	// the batch size for them.
+	const auto startTime = std::chrono::steady_clock::now();
+
+	if( !f( scene, path ) )
+	{
+		return;
+	}
+
+	IECore::ConstInternedStringVectorDataPtr childNamesData = scene->childNamesPlug()->getValue();
+	const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
+	{
+		return;
+	}
+
+	const auto duration = std::max( std::chrono::steady_clock::now() - startTime, std::chrono::steady_clock::duration( 1 ) );
+
+	if( childNames.size() == 1 )
+	{
+		// No parallelism to be had, so process the child on this thread,
+		// reusing our scope.
+		ThreadableFunctor childFunctor( f );
+		path.push_back( childNames.front() );
+		parallelProcessLocationsBatchedWalk( scene, threadState, pathScope, path, childFunctor, taskGroupContext );
+		path.pop_back();
+		return;
+	}
+
+	size_t batchSize = std::max<size_t>( 1, g_locationBatchDuration / duration );
+	// Don't let batches get so large that we can't keep all threads busy. This
+	// also guarantees at least two batches, so that siblings are always
+	// processed in parallel, however cheap they appear to be.
+	const size_t minBatches = 4 * tbb::this_task_arena::max_concurrency();
+	batchSize = std::min( batchSize, std::max<size_t>( 1, childNames.size() / minBatches ) );
+
+	using IndexRange = tbb::blocked_range<size_t>;
+	const IndexRange loopRange( 0, childNames.size(), batchSize );
+
+	auto loopBody = [&] ( const IndexRange &range ) {
+		ScenePlug::PathScope batchScope( threadState );
+		ScenePlug::ScenePath childPath;
+		childPath.reserve( path.size() + 8 );
+		childPath = path;
+		childPath.push_back( IECore::InternedString() ); // Space for the child name
+		for( size_t i = range.begin(); i != range.end(); ++i )
+		{
+			ThreadableFunctor childFunctor( f );
+			childPath.back() = childNames[i];
+			parallelProcessLocationsBatchedWalk( scene, threadState, batchScope, childPath, childFunctor, taskGroupContext );
+		}
+	};
+
+	tbb::parallel_for( loopRange, loopBody, taskGroupContext );
+}
+
 template <class ThreadableFunctor>
 struct ThreadableFilteredFunctor
 {
@@ -154,6 +228,16 @@ void parallelProcessLocations( const GafferScene::ScenePlug *scene, ThreadableFu
 	Detail::parallelProcessLocationsWalk( scene, Gaffer::ThreadState::current(), root, f, taskGroupContext );
 }
 
+template <class ThreadableFunctor>
+void parallelProcessLocationsBatched( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
+{
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
+	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+	ScenePlug::PathScope pathScope( threadState );
+	ScenePlug::ScenePath path = root;
+	Detail::parallelProcessLocationsBatchedWalk( scene, threadState, pathScope, path, f, taskGroupContext );
+}
+
 template <class ThreadableFunctor>
 void parallelTraverse( const ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
@@ -68,6 +68,8 @@ class GAFFERSCENE_API SceneElementProcessor : public FilteredSceneProcessor
 		void hashAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
 		/// Implemented to call hashProcessedObject() where appropriate.
 		void hashObject( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
+		/// Implemented to pass through the input subtree hash where the filter doesn't match.
+		void hashSubtree( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
 
 		/// Implemented to call computeProcessedBound() where appropriate.
 		Imath::Box3f computeBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const override;
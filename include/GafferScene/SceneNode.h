@@ -99,6 +99,12 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		virtual void hashGlobals( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 		virtual void hashSetNames( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 		virtual void hashSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
+		/// Hash method for `ScenePlug::subtreeHash()`. The default implementation combines the
+		/// per-location hashes for `path` with the subtree hashes of its children, and is correct
+		/// for all nodes. Derived classes may override it to assign directly from `inPlug()->subtreeHash()`
+		/// at locations where they are guaranteed to leave the entire subtree unmodified. There is no
+		/// corresponding compute method.
+		virtual void hashSubtree( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 
 		/// Implemented to call the compute*() methods below whenever output is part of a ScenePlug and the node is enabled.
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
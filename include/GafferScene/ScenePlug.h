@@ -253,6 +253,15 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 		IECore::MurmurHash objectHash( const ScenePath &scenePath ) const;
 		IECore::MurmurHash childNamesHash( const ScenePath &scenePath ) const;
 		IECore::MurmurHash childBoundsHash( const ScenePath &scenePath ) const;
+		/// Returns a hash representing the entire subtree below `scenePath`,
+		/// including `scenePath` itself. This is computed by combining the bound,
+		/// transform, attributes, object and child names hashes of the location
+		/// with the subtree hashes of its children, and can therefore be used
+		/// to determine cheaply that nothing has changed within a subtree.
+		/// Computing it for the first time requires a traversal of the whole
+		/// subtree, but results are cached and derived nodes may pass through
+		/// the hash of their input for subtrees they do not modify.
+		IECore::MurmurHash subtreeHash( const ScenePath &scenePath ) const;
 		/// See comments for `globals()` method.
 		IECore::MurmurHash globalsHash() const;
 		/// See comments for `setNames()` method.
@@ -281,6 +290,10 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 		// Private plug used for the computation of `existsPlug()` by SceneNode.
 		Gaffer::InternedStringVectorDataPlug *sortedChildNamesPlug();
 		const Gaffer::InternedStringVectorDataPlug *sortedChildNamesPlug() const;
+		// Private plug used for the computation of `subtreeHash()` by SceneNode.
+		// Only the hash is meaningful; the value is always the default.
+		Gaffer::IntPlug *subtreeHashPlug();
+		const Gaffer::IntPlug *subtreeHashPlug() const;
 		friend class SceneNode;
 
 };
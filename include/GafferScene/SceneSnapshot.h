@@ -0,0 +1,145 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/ScenePlug.h"
+
+#include "IECore/RefCounted.h"
+
+#include <limits>
+#include <vector>
+
+namespace GafferScene
+{
+
+/// Evaluates an entire subtree of a scene in one go, storing the results
+/// in flat arrays ("columns") indexed by location. Locations are stored in
+/// depth-first order, with each location followed immediately by all of its
+/// descendants. This allows clients that need to visit every location in a
+/// large hierarchy to iterate over plain arrays, rather than paying for a
+/// separate context, hash and cache lookup per location and per query.
+///
+/// The snapshot is computed in the context that is current at the time of
+/// construction, and is not updated when the scene changes. Attributes and
+/// objects are stored as shared (const) handles to the values held in the
+/// compute cache, so no copies of the data are made.
+class GAFFERSCENE_API SceneSnapshot : public IECore::RefCounted
+{
+
+	public :
+
+		enum Components
+		{
+			None = 0,
+			Bound = 1,
+			Transform = 2,
+			Attributes = 4,
+			Object = 8,
+			All = Bound | Transform | Attributes | Object
+		};
+
+		/// Sentinel returned by `parent()` for the root of the snapshot,
+		/// and by `find()` for paths not contained in the snapshot.
+		static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+		/// Evaluates `scene` below `root` (inclusive) in the current context.
+		/// Only the requested `components` are computed; the structure of the
+		/// hierarchy is always available. Throws if `root` does not exist.
+		SceneSnapshot( const ScenePlug *scene, const ScenePlug::ScenePath &root = ScenePlug::ScenePath(), unsigned components = All );
+		~SceneSnapshot() override;
+
+		IE_CORE_DECLAREMEMBERPTR( SceneSnapshot )
+
+		unsigned components() const;
+		const ScenePlug::ScenePath &root() const;
+
+		/// Number of locations in the snapshot, including the root.
+		size_t size() const;
+
+		/// Structure
+		/// =========
+		///
+		/// Location `0` is always the root. The descendants of location `i`
+		/// occupy the half-open range `[ i + 1, subtreeEnd( i ) )`.
+
+		const IECore::InternedString &name( size_t index ) const;
+		size_t parent( size_t index ) const;
+		size_t subtreeEnd( size_t index ) const;
+		/// Fills `path` with the full path to the location.
+		void path( size_t index, ScenePlug::ScenePath &path ) const;
+		ScenePlug::ScenePath path( size_t index ) const;
+		/// Returns the index of `path`, or `npos` if it is not in the snapshot.
+		size_t find( const ScenePlug::ScenePath &path ) const;
+
+		/// Columns
+		/// =======
+		///
+		/// Each column has `size()` elements if the corresponding component
+		/// was requested, and is empty otherwise. `fullTransforms` includes
+		/// the transforms of the ancestors of `root()`.
+
+		const std::vector<IECore::InternedString> &names() const { return m_names; }
+		const std::vector<size_t> &parents() const { return m_parents; }
+		const std::vector<size_t> &subtreeEnds() const { return m_subtreeEnds; }
+		const std::vector<Imath::Box3f> &bounds() const { return m_bounds; }
+		const std::vector<Imath::M44f> &transforms() const { return m_transforms; }
+		const std::vector<Imath::M44f> &fullTransforms() const { return m_fullTransforms; }
+		const std::vector<IECore::ConstCompoundObjectPtr> &attributes() const { return m_attributes; }
+		const std::vector<IECore::ConstObjectPtr> &objects() const { return m_objects; }
+
+	private :
+
+		struct Location;
+		void flatten( Location &location, size_t index, size_t parentIndex, const Imath::M44f &parentFullTransform );
+
+		const unsigned m_components;
+		const ScenePlug::ScenePath m_root;
+
+		std::vector<IECore::InternedString> m_names;
+		std::vector<size_t> m_parents;
+		std::vector<size_t> m_subtreeEnds;
+		std::vector<Imath::Box3f> m_bounds;
+		std::vector<Imath::M44f> m_transforms;
+		std::vector<Imath::M44f> m_fullTransforms;
+		std::vector<IECore::ConstCompoundObjectPtr> m_attributes;
+		std::vector<IECore::ConstObjectPtr> m_objects;
+
+};
+
+IE_CORE_DECLAREPTR( SceneSnapshot )
+
+} // namespace GafferScene
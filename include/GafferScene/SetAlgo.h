@@ -41,6 +41,7 @@
 #include "Gaffer/Plug.h"
 
 #include "IECore/MurmurHash.h"
+#include "IECore/PathMatcher.h"
 
 namespace GafferScene
 {
@@ -55,6 +56,25 @@ GAFFERSCENE_API void setExpressionHash( const std::string &setExpression, const
 
 GAFFERSCENE_API bool affectsSetExpression( const Gaffer::Plug *scenePlugChild );
 
+/// Set deltas
+/// ==========
+///
+/// A SetDelta describes an edit to a set in terms of the paths that were
+/// added and removed. For small edits to large sets, a delta is typically
+/// much smaller than the set itself, and allows clients to update their own
+/// state incrementally rather than from scratch.
+
+struct SetDelta
+{
+	IECore::PathMatcher added;
+	IECore::PathMatcher removed;
+};
+
+/// Returns the delta that transforms `before` into `after`.
+GAFFERSCENE_API SetDelta setDelta( const IECore::PathMatcher &before, const IECore::PathMatcher &after );
+/// Applies `delta` to `set`, returning true if `set` was modified.
+GAFFERSCENE_API bool applySetDelta( IECore::PathMatcher &set, const SetDelta &delta );
+
 } // namespace SetAlgo
 
 } // namespace Gaffer
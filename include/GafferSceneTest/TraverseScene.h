@@ -42,6 +42,8 @@
 
 #include "Gaffer/Context.h"
 
+#include "IECore/PathMatcher.h"
+
 namespace GafferSceneTest
 {
 
@@ -50,6 +52,11 @@ namespace GafferSceneTest
 /// any thread related crashes, and also in profiling for performance improvement.
 GAFFERSCENETEST_API void traverseScene( const GafferScene::ScenePlug *scenePlug );
 
+/// As for `traverseScene()`, but using `SceneAlgo::parallelProcessLocationsBatched()`.
+/// Returns all the locations visited, and throws if any location is visited with the
+/// wrong `scene:path` in the current context.
+GAFFERSCENETEST_API IECore::PathMatcher traverseSceneBatched( const GafferScene::ScenePlug *scenePlug, const GafferScene::ScenePlug::ScenePath &root = GafferScene::ScenePlug::ScenePath() );
+
 /// Arranges for traverseScene() to be called every time the scene is dirtied. This is useful
 /// for exposing bugs caused by things like InteractiveRender and SceneView, where threaded
 /// traversals will be triggered automatically by plugDirtiedSignal().
@@ -198,5 +198,25 @@ class BlurTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( finalCrop["out"], expectedReader["out"], maxDifference = 0.00001, ignoreMetadata = True )
 
+	def testPrefetch( self ) :
+
+		self.addCleanup( Gaffer.ComputeNode.setPrefetchEnabled, Gaffer.ComputeNode.getPrefetchEnabled() )
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 500, 400 ) )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checker["out"] )
+		blur["radius"].setValue( imath.V2f( 70, 30 ) )
+
+		Gaffer.ComputeNode.setPrefetchEnabled( False )
+		expected = GafferImage.ImageAlgo.image( blur["out"] )
+
+		Gaffer.ComputeNode.setPrefetchEnabled( True )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		self.assertEqual( GafferImage.ImageAlgo.image( blur["out"] ), expected )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -98,6 +98,28 @@ class ImageReaderTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertNotEqual( h1, h2 )
 
+	def testCacheMemoryUsage( self ) :
+
+		# Half images are cached in their native format, and only converted to
+		# float on demand. Reading through an ImageReader without a colour space
+		# conversion must not cache the float data as well.
+
+		n = GafferImage.ImageReader()
+		n["fileName"].setValue( self.imagesPath() / "colorbars_half_max.exr" )
+		n["colorSpace"].setValue( GafferImage.OpenColorIOAlgo.getWorkingSpace( Gaffer.Context.current() ) )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 0 )
+
+		tiles = GafferImage.ImageAlgo.tiles( n["out"], _copy = False )
+		floatBytes = sum(
+			len( tile ) * 4
+			for name, channelTiles in tiles.items() if name != "tileOrigins"
+			for tile in channelTiles
+		)
+
+		self.assertLess( Gaffer.ValuePlug.cacheMemoryUsage(), floatBytes * 0.75 )
+
 	def testChannelMissing( self ) :
 		n = GafferImage.ImageReader()
 		n["fileName"].setValue( self.largeFileName )
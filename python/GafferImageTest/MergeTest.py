@@ -925,6 +925,88 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 		merge["in"][0].setInput( c1["out"] )
 		self.assertImagesEqual( merge["out"], c1["out"] )
 
+	def testManyInputsMatchPairwise( self ) :
+
+		# Merges with many inputs use a single pass for tiles where every input
+		# covers the whole tile. Check that this matches merging pairwise, both
+		# for those tiles and for the tiles around the edges of the data windows.
+
+		inputs = []
+		for i in range( 0, 6 ) :
+
+			checker = GafferImage.Checkerboard()
+			checker["format"].setValue( GafferImage.Format( 300, 200 ) )
+			checker["size"].setValue( imath.V2f( 7 + i * 3 ) )
+			checker["colorA"].setValue( imath.Color4f( 0.1 * i, 0.5, -0.25, 0.2 * i ) )
+			checker["colorB"].setValue( imath.Color4f( 0.9, 0.1 * i, 2, 1 - 0.1 * i ) )
+
+			offset = GafferImage.Offset()
+			offset["in"].setInput( checker["out"] )
+			offset["offset"].setValue( imath.V2i( i * 5, -i * 3 ) )
+
+			inputs.append( offset )
+
+		merge = GafferImage.Merge()
+		for i, node in enumerate( inputs ) :
+			merge["in"][i].setInput( node["out"] )
+
+		pairwiseMerges = []
+		for node in inputs[1:] :
+			pairwiseMerge = GafferImage.Merge()
+			pairwiseMerge["in"][0].setInput( pairwiseMerges[-1]["out"] if pairwiseMerges else inputs[0]["out"] )
+			pairwiseMerge["in"][1].setInput( node["out"] )
+			pairwiseMerge["operation"].setInput( merge["operation"] )
+			pairwiseMerges.append( pairwiseMerge )
+
+		for operation in GafferImage.Merge.Operation.values.values() :
+			with self.subTest( operation = operation ) :
+				merge["operation"].setValue( operation )
+				self.assertImagesEqual( merge["out"], pairwiseMerges[-1]["out"] )
+
+	def mergeManyPerf( self, operation ) :
+
+		inputs = []
+		for i in range( 0, 20 ) :
+
+			checker = GafferImage.Checkerboard()
+			checker["format"].setValue( GafferImage.Format( 2048, 1556 ) )
+			checker["size"].setValue( imath.V2f( 64.01 + i ) )
+			checker["colorA"].setValue( imath.Color4f( 0.05 * i, 0.5, 0.25, 0.5 ) )
+			checker["colorB"].setValue( imath.Color4f( 0.9, 0.05 * i, 0.1, 0.25 ) )
+			inputs.append( checker )
+
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( operation )
+		for i, node in enumerate( inputs ) :
+			merge["in"][i].setInput( node["out"] )
+
+		# Precache upstream network, we're only interested in the performance of Merge
+		for node in inputs :
+			GafferImageTest.processTiles( node["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( merge["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testManyInputsOverPerf( self ) :
+		self.mergeManyPerf( GafferImage.Merge.Operation.Over )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testManyInputsAddPerf( self ) :
+		self.mergeManyPerf( GafferImage.Merge.Operation.Add )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testManyInputsMultiplyPerf( self ) :
+		self.mergeManyPerf( GafferImage.Merge.Operation.Multiply )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testManyInputsMaxPerf( self ) :
+		self.mergeManyPerf( GafferImage.Merge.Operation.Max )
+
 	def mergePerf( self, operation, mismatch ):
 		r = GafferImage.Checkerboard( "Checkerboard" )
 		r["format"].setValue( GafferImage.Format( 4096, 3112, 1.000 ) )
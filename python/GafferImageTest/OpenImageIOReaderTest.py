@@ -221,6 +221,37 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( exrReader["out"], jpgOCIO["out"], ignoreMetadata = True, maxDifference = 0.001 )
 
+	def testCompactTileStorage( self ) :
+
+		for fileName, tileType in [
+			( self.circlesJpgFileName, IECore.UCharVectorData ),
+			( self.alignmentTestSourceFileName, IECore.HalfVectorData ),
+			( self.circlesExrFileName, IECore.FloatVectorData ),
+		] :
+
+			with self.subTest( fileName = fileName ) :
+
+				reader = GafferImage.OpenImageIOReader()
+				reader["fileName"].setValue( fileName )
+
+				# Tile batches are stored in the native format of the file,
+				# to save memory in the cache.
+
+				with Gaffer.Context() as context :
+					context["__tileBatchOrigin"] = imath.V3i( 0 )
+					tileBatch = reader["__tileBatch"].getValue()
+
+				self.assertTrue( any( isinstance( t, tileType ) for t in tileBatch[0] ) )
+
+				# But are always output as float, without loss.
+
+				image = GafferImage.ImageAlgo.image( reader["out"] )
+				image.blindData().clear()
+				expectedImage = IECore.Reader.create( str( fileName ) ).read()
+				expectedImage.blindData().clear()
+
+				self.assertEqual( image, expectedImage )
+
 	def testSupportedExtensions( self ) :
 
 		e = GafferImage.OpenImageIOReader.supportedExtensions()
@@ -42,6 +42,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 
@@ -82,3 +83,125 @@ class SaturationTest( GafferImageTest.ImageTestCase ) :
 		sat["saturation"].setValue( 2 )
 		ref["color"].setValue( imath.Color4f( 0.67874, 0.47874, 0.47874, 1 ) )
 		self.assertImagesEqual( sat["out"], ref["out"], maxDifference = 1e-7 )
+
+	def testFusedChain( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 200, 150 ) )
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.5, 0.2, 0.5 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.6, 0.3, 0.9, 1 ) )
+
+		# Adjacent ColorProcessors are fused together. Grades are not
+		# ColorProcessors, so interleaving them prevents fusion and gives
+		# us a reference to compare against.
+
+		fused = []
+		unfused = []
+		for i in range( 0, 5 ) :
+
+			saturation = GafferImage.Saturation()
+			saturation["in"].setInput( fused[-1]["out"] if fused else checker["out"] )
+			saturation["saturation"].setValue( 0.5 + i * 0.25 )
+			fused.append( saturation )
+
+			grade = GafferImage.Grade()
+			grade["in"].setInput( unfused[-1]["out"] if unfused else checker["out"] )
+			saturation = GafferImage.Saturation()
+			saturation["in"].setInput( grade["out"] )
+			saturation["saturation"].setValue( 0.5 + i * 0.25 )
+			unfused.append( saturation )
+
+		self.assertImagesEqual( fused[-1]["out"], unfused[-1]["out"], maxDifference = 1e-6 )
+
+		# Only the last node in the chain should have computed colour data.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( fused[-1]["out"] )
+
+		for saturation in fused[:-1] :
+			self.assertEqual( monitor.plugStatistics( saturation["__colorData"] ).computeCount, 0 )
+		self.assertGreater( monitor.plugStatistics( fused[-1]["__colorData"] ).computeCount, 0 )
+
+		# Edits upstream in the chain must be reflected downstream.
+
+		for name, value in [
+			( "enabled", False ),
+			( "processUnpremultiplied", True ),
+			( "channels", "R G" ),
+			( "saturation", 0.1 ),
+		] :
+			with self.subTest( name = name ) :
+
+				original = fused[1][name].getValue()
+				for chain in ( fused, unfused ) :
+					chain[1][name].setValue( value )
+
+				self.assertImagesEqual( fused[-1]["out"], unfused[-1]["out"], maxDifference = 1e-6 )
+
+				for chain in ( fused, unfused ) :
+					chain[1][name].setValue( original )
+
+	def testFusedChainWithPartialChannels( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 200, 150 ) )
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.5, 0.2, 0.5 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.6, 0.3, 0.9, 1 ) )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( checker["out"] )
+		deleteChannels["enabled"].setValue( False )
+
+		fused = []
+		unfused = []
+		for i in range( 0, 3 ) :
+
+			saturation = GafferImage.Saturation()
+			saturation["in"].setInput( fused[-1]["out"] if fused else deleteChannels["out"] )
+			saturation["saturation"].setValue( 0.5 + i * 0.25 )
+			saturation["channels"].setValue( "R G" )
+			fused.append( saturation )
+
+			grade = GafferImage.Grade()
+			grade["in"].setInput( unfused[-1]["out"] if unfused else deleteChannels["out"] )
+			saturation = GafferImage.Saturation()
+			saturation["in"].setInput( grade["out"] )
+			saturation["saturation"].setValue( 0.5 + i * 0.25 )
+			saturation["channels"].setValue( "R G" )
+			unfused.append( saturation )
+
+		# Each node only outputs R and G, passing B through unprocessed, so
+		# the chain must give the same result as separate nodes.
+
+		self.assertImagesEqual( fused[-1]["out"], unfused[-1]["out"], maxDifference = 1e-6 )
+		self.assertEqual(
+			fused[-1]["out"].channelData( "B", imath.V2i( 0 ) ),
+			checker["out"].channelData( "B", imath.V2i( 0 ) )
+		)
+
+		# Likewise when processing all channels, but B is missing.
+
+		for saturation in fused + unfused :
+			saturation["channels"].setValue( "*" )
+		deleteChannels["channels"].setValue( "B" )
+		deleteChannels["enabled"].setValue( True )
+
+		self.assertImagesEqual( fused[-1]["out"], unfused[-1]["out"], maxDifference = 1e-6 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFusedChainPerformance( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 3000, 3000 ) )
+
+		saturations = []
+		for i in range( 0, 10 ) :
+			saturation = GafferImage.Saturation()
+			saturation["in"].setInput( saturations[-1]["out"] if saturations else checker["out"] )
+			saturation["saturation"].setValue( 0.5 + i * 0.1 )
+			saturations.append( saturation )
+
+		GafferImageTest.processTiles( checker["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( saturations[-1]["out"] )
@@ -1109,22 +1109,22 @@ class OSLObjectTest( GafferOSLTest.OSLTestCase ) :
 			del cs[:]
 
 		s["transform"]["translate"]["x"].setValue( 1 )
-		checkAffected( [ "transform", "bound", "childBounds" ] )
+		checkAffected( [ "transform", "bound", "childBounds", "__subtreeHash" ] )
 
 		o["useTransform"].setValue( True )
-		checkAffected( [ "object", "bound", "childBounds" ] )
+		checkAffected( [ "object", "bound", "childBounds", "__subtreeHash" ] )
 
 		s["transform"]["translate"]["x"].setValue( 2 )
-		checkAffected( [ "transform", "object", "bound", "childBounds" ] )
+		checkAffected( [ "transform", "object", "bound", "childBounds", "__subtreeHash" ] )
 
 		a["attributes"][0]["value"].setValue( 1 )
-		checkAffected( [ "attributes" ] )
+		checkAffected( [ "attributes", "__subtreeHash" ] )
 
 		o["useAttributes"].setValue( True )
-		checkAffected( [ "object", "bound", "childBounds" ] )
+		checkAffected( [ "object", "bound", "childBounds", "__subtreeHash" ] )
 
 		a["attributes"][0]["value"].setValue( 2 )
-		checkAffected( [ "attributes", "object", "bound", "childBounds" ] )
+		checkAffected( [ "attributes", "object", "bound", "childBounds", "__subtreeHash" ] )
 
 	def testBoundsUpdate( self ) :
 
@@ -0,0 +1,193 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+import imath
+
+import IECore
+
+import Gaffer
+import GafferTest
+import GafferScene
+import GafferSceneTest
+
+class BoundFilterTest( GafferSceneTest.SceneTestCase ) :
+
+	def __spheres( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["transform"]["translate"].setValue( imath.V3f( 0, 0, -3 ) )
+		duplicate["copies"].setValue( 3 )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( duplicate["out"] )
+
+		return sphere, duplicate, group
+
+	def __matchingPaths( self, filter, scene ) :
+
+		result = IECore.PathMatcher()
+		GafferScene.SceneAlgo.matchingPaths( filter["out"], scene, result )
+		return set( result.paths() )
+
+	def testBoundMode( self ) :
+
+		sphere, duplicate, group = self.__spheres()
+
+		boundFilter = GafferScene.BoundFilter()
+		self.assertEqual( boundFilter["mode"].getValue(), GafferScene.BoundFilter.Mode.Bound )
+		boundFilter["bound"].setValue( imath.Box3f( imath.V3f( -1, -1, -4.5 ), imath.V3f( 1, 1, -1.5 ) ) )
+
+		self.assertEqual( self.__matchingPaths( boundFilter, group["out"] ), { "/group/sphere1" } )
+
+		boundFilter["bound"].setValue( imath.Box3f( imath.V3f( -1, -1, -5.5 ), imath.V3f( 1, 1, -0.5 ) ) )
+		self.assertEqual( self.__matchingPaths( boundFilter, group["out"] ), { "/group/sphere", "/group/sphere1", "/group/sphere2" } )
+
+		# Only leaf locations are matched directly, with ancestors
+		# being matched as descendant matches.
+
+		isolate = GafferScene.Isolate()
+		isolate["in"].setInput( group["out"] )
+		isolate["filter"].setInput( boundFilter["out"] )
+
+		self.assertEqual( isolate["out"].childNames( "/group" ), IECore.InternedStringVectorData( [ "sphere", "sphere1", "sphere2" ] ) )
+		self.assertSceneValid( isolate["out"] )
+
+		# Changes to the scene must be reflected in the result.
+
+		duplicate["transform"]["translate"].setValue( imath.V3f( 0, 0, -10 ) )
+		self.assertEqual( isolate["out"].childNames( "/group" ), IECore.InternedStringVectorData( [ "sphere" ] ) )
+
+		group["transform"]["translate"].setValue( imath.V3f( 10, 0, 0 ) )
+		self.assertEqual( isolate["out"].childNames( "/" ), IECore.InternedStringVectorData() )
+
+	def testCameraMode( self ) :
+
+		sphere, duplicate, group = self.__spheres()
+
+		camera = GafferScene.Camera()
+		camera["transform"]["translate"]["z"].setValue( 5 )
+		camera["clippingPlanes"].setValue( imath.V2f( 0.1, 9.5 ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( group["out"] )
+		parent["children"][0].setInput( camera["out"] )
+		parent["parent"].setValue( "/" )
+
+		boundFilter = GafferScene.BoundFilter()
+		boundFilter["mode"].setValue( GafferScene.BoundFilter.Mode.Camera )
+		boundFilter["camera"].setValue( "/camera" )
+
+		def assertSpheres( expected ) :
+
+			self.assertEqual(
+				{ p for p in self.__matchingPaths( boundFilter, parent["out"] ) if p.startswith( "/group/" ) },
+				{ "/group/" + x for x in expected }
+			)
+
+		# Camera at z = 5, far clipping plane at z = -4.5.
+		assertSpheres( { "sphere", "sphere1" } )
+
+		camera["clippingPlanes"].setValue( imath.V2f( 0.1, 100 ) )
+		assertSpheres( { "sphere", "sphere1", "sphere2" } )
+
+		# Near clipping plane at z = -1.5.
+		camera["clippingPlanes"].setValue( imath.V2f( 6.5, 100 ) )
+		assertSpheres( { "sphere1", "sphere2" } )
+
+		# Looking away from the spheres.
+		camera["transform"]["rotate"]["y"].setValue( 180 )
+		assertSpheres( set() )
+
+		# Looking along the row of spheres from the side, with a narrow
+		# field of view.
+		camera["clippingPlanes"].setValue( imath.V2f( 0.1, 100 ) )
+		camera["transform"]["translate"].setValue( imath.V3f( 20, 0, -3 ) )
+		camera["transform"]["rotate"]["y"].setValue( 90 )
+		camera["fieldOfView"].setValue( 2 )
+		assertSpheres( { "sphere1" } )
+
+	def testMissingCamera( self ) :
+
+		sphere, duplicate, group = self.__spheres()
+
+		boundFilter = GafferScene.BoundFilter()
+		boundFilter["mode"].setValue( GafferScene.BoundFilter.Mode.Camera )
+		boundFilter["camera"].setValue( "/camera" )
+
+		with self.assertRaisesRegex( Gaffer.ProcessException, 'Camera "/camera" does not exist' ) :
+			self.__matchingPaths( boundFilter, group["out"] )
+
+	def testLocationsWithChildren( self ) :
+
+		sphere = GafferScene.Sphere()
+		cube = GafferScene.Cube()
+		cube["transform"]["translate"]["x"].setValue( 10 )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( sphere["out"] )
+		parent["children"][0].setInput( cube["out"] )
+		parent["parent"].setValue( "/sphere" )
+
+		# Only leaf locations are indexed, so the sphere is not matched
+		# even though its own object intersects the bound.
+
+		boundFilter = GafferScene.BoundFilter()
+		boundFilter["bound"].setValue( imath.Box3f( imath.V3f( -0.5 ), imath.V3f( 0.5 ) ) )
+		self.assertEqual( self.__matchingPaths( boundFilter, parent["out"] ), set() )
+
+		boundFilter["bound"].setValue( imath.Box3f( imath.V3f( 9.5, -0.5, -0.5 ), imath.V3f( 10.5, 0.5, 0.5 ) ) )
+		self.assertEqual( self.__matchingPaths( boundFilter, parent["out"] ), { "/sphere/cube" } )
+
+	def testAffects( self ) :
+
+		boundFilter = GafferScene.BoundFilter()
+		for plug in [ boundFilter["mode"], boundFilter["bound"]["min"]["x"], boundFilter["camera"] ] :
+			self.assertIn( boundFilter["__matches"], boundFilter.affects( plug ) )
+
+		scene = GafferScene.ScenePlug()
+		for plug in [ scene["bound"], scene["transform"], scene["attributes"], scene["childNames"], scene["object"] ] :
+			self.assertIn( boundFilter["__matches"], boundFilter.affects( plug ) )
+
+		self.assertNotIn( boundFilter["__matches"], boundFilter.affects( scene["globals"] ) )
+		self.assertEqual( boundFilter.affects( boundFilter["__matches"] ), [ boundFilter["out"] ] )
+
+if __name__ == "__main__":
+	unittest.main()
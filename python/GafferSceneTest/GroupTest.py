@@ -839,6 +839,68 @@ class GroupTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( group["out"].set( "C" ).value, IECore.PathMatcher( [ "/world" ] ) )
 		self.assertEqual( group["out"].set( "D" ).value, IECore.PathMatcher() )
 
+	def testPrefetch( self ) :
+
+		self.addCleanup( Gaffer.ComputeNode.setPrefetchEnabled, Gaffer.ComputeNode.getPrefetchEnabled() )
+
+		script = Gaffer.ScriptNode()
+		script["group"] = GafferScene.Group()
+
+		spheres = []
+		for i in range( 0, 10 ) :
+			sphere = GafferScene.Sphere( "sphere{}".format( i ) )
+			sphere["radius"].setValue( i + 1 )
+			sphere["transform"]["translate"]["x"].setValue( i * 10 )
+			script.addChild( sphere )
+			script["group"]["in"][i].setInput( sphere["out"] )
+			spheres.append( sphere )
+
+		# Make the first input slow, so that while `compute()` is waiting
+		# for it, the prefetch has plenty of time to compute the others.
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( "import time; time.sleep( 0.5 ); parent['sphere0']['radius'] = 1" )
+
+		Gaffer.ComputeNode.setPrefetchEnabled( False )
+		with Gaffer.PerformanceMonitor() as expectedMonitor, Gaffer.ThreadMonitor() as expectedThreadMonitor :
+			expectedBounds = { p : script["group"]["out"].bound( p ) for p in [ "/", "/group" ] }
+			expectedChildNames = script["group"]["out"].childNames( "/group" )
+
+		Gaffer.ComputeNode.setPrefetchEnabled( True )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		with Gaffer.PerformanceMonitor() as monitor, Gaffer.ThreadMonitor() as threadMonitor :
+			self.assertEqual( script["group"]["out"].childNames( "/group" ), expectedChildNames )
+			for path, bound in expectedBounds.items() :
+				self.assertEqual( script["group"]["out"].bound( path ), bound )
+
+		# Without prefetching, the input bounds are computed serially by the
+		# calling thread. With prefetching, they should have been computed on
+		# other threads while we were waiting for the first one.
+
+		thisThread = Gaffer.ThreadMonitor.thisThreadId()
+		for sphere in spheres :
+			self.assertEqual( set( expectedThreadMonitor.plugStatistics( sphere["out"]["bound"] ).keys() ), { thisThread } )
+
+		self.assertTrue( any(
+			set( threadMonitor.plugStatistics( sphere["out"]["bound"] ).keys() ) - { thisThread }
+			for sphere in spheres[1:]
+		) )
+
+		# Prefetching must never cause a value to be computed twice, by
+		# racing with the compute that needs it.
+
+		for sphere in spheres :
+			for plug in sphere["out"].children() :
+				self.assertEqual(
+					monitor.plugStatistics( plug ).computeCount,
+					expectedMonitor.plugStatistics( plug ).computeCount,
+					plug.fullName()
+				)
+
+		self.assertSceneValid( script["group"]["out"] )
+
 	def setUp( self ) :
 
 		GafferSceneTest.SceneTestCase.setUp( self )
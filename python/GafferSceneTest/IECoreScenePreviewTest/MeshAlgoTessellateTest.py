@@ -37,6 +37,7 @@
 import unittest
 import imath
 import pathlib
+import time
 
 import IECore
 import IECoreScene
@@ -644,5 +645,32 @@ class MeshAlgoTessellateTest( GafferTest.TestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			MeshAlgo.tessellateMesh( sphere, 1 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testTessellationRatePerf( self ):
+
+		plane = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), divisions = imath.V2i( 100 )
+		)
+		plane.setInterpolation( "catmullClark" )
+
+		# The triangles at the poles of the sphere give us extraordinary
+		# vertices, which OpenSubdiv handles much less efficiently than
+		# the regular faces of the plane.
+		sphere = IECoreScene.MeshPrimitive.createSphere(
+			1, divisions = imath.V2i( 100 )
+		)
+		sphere.setInterpolation( "catmullClark" )
+		del sphere["N"]
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for name, mesh in [ ( "Plane", plane ), ( "Sphere", sphere ) ] :
+				for divisions in [ 1, 3, 7, 15 ] :
+					startTime = time.perf_counter()
+					result = MeshAlgo.tessellateMesh( mesh, divisions )
+					duration = time.perf_counter() - startTime
+					print( "\n{} divisions {} : {:.0f} output faces per second".format(
+						name, divisions, result.numFaces() / duration
+					) )
+
 if __name__ == "__main__":
 	unittest.main()
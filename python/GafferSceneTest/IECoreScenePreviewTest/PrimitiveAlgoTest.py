@@ -195,6 +195,104 @@ class PrimitiveAlgoTest( GafferTest.TestCase ) :
 				PrimitiveAlgo.transformPrimitive( mesh, m )
 
 
+	def testTransformPrimitiveMatchesImath( self ) :
+
+		# Transforms are processed in blocks, so we use a number of
+		# elements that leaves a remainder.
+
+		r = random.Random( 1 )
+		points = IECore.V3fVectorData(
+			[ imath.V3f( r.uniform( -10, 10 ), r.uniform( -10, 10 ), r.uniform( -10, 10 ) ) for i in range( 1003 ) ],
+			IECore.GeometricData.Interpretation.Point
+		)
+
+		prim = IECoreScene.PointsPrimitive( points )
+		for name, interpretation in [
+			( "vector", IECore.GeometricData.Interpretation.Vector ),
+			( "normal", IECore.GeometricData.Interpretation.Normal ),
+		] :
+			data = points.copy()
+			data.setInterpretation( interpretation )
+			prim[name] = IECoreScene.PrimitiveVariable( Interpolation.Vertex, data )
+
+		affine = imath.M44f().translate( imath.V3f( 10, 1, 0 ) ).rotate( imath.V3f( 0.1, 0.2, 0.3 ) ).scale( imath.V3f( 0.5, 1, 2 ) )
+		projective = imath.M44f(
+			1, 0, 0, 0.01,
+			0, 1, 0, 0.02,
+			0, 0, 1, 0,
+			0, 0, 0, 1
+		) * affine
+
+		for matrix in [ affine, projective ] :
+
+			result = prim.copy()
+			PrimitiveAlgo.transformPrimitive( result, matrix )
+
+			normalMatrix = matrix.inverse().transposed()
+			self.assertEqual( list( result["P"].data ), [ p * matrix for p in points ] )
+			self.assertEqual( list( result["vector"].data ), [ matrix.multDirMatrix( p ) for p in points ] )
+			self.assertEqual( list( result["normal"].data ), [ normalMatrix.multDirMatrix( p ) for p in points ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTransformPrimitiveVectorsPerf( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -2 ), imath.V2f( 2 ) ),
+			divisions = imath.V2i( 2000, 2000 )
+		)
+		for name, interpretation in [
+			( "vector", IECore.GeometricData.Interpretation.Vector ),
+			( "normal", IECore.GeometricData.Interpretation.Normal ),
+		] :
+			data = mesh["P"].data.copy()
+			data.setInterpretation( interpretation )
+			mesh[name] = IECoreScene.PrimitiveVariable( Interpolation.Vertex, data )
+
+		m = imath.M44f().translate( imath.V3f( 0, 1, 0 ) ).rotate( imath.V3f( 0, 1, 0 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 10 ):
+				PrimitiveAlgo.transformPrimitive( mesh, m )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMergeIndexedPerf( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -2 ), imath.V2f( 2 ) ),
+			divisions = imath.V2i( 1000, 1000 )
+		)
+		mesh["indexed"] = IECoreScene.PrimitiveVariable(
+			Interpolation.FaceVarying,
+			IECore.FloatVectorData( range( 100 ) ),
+			IECore.IntVectorData( [ i % 100 for i in range( mesh.variableSize( Interpolation.FaceVarying ) ) ] )
+		)
+
+		meshes = [ ( mesh, imath.M44f().translate( imath.V3f( i, 0, 0 ) ) ) for i in range( 4 ) ]
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			PrimitiveAlgo.mergePrimitives( meshes )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMergeInterpolationPerf( self ) :
+
+		mesh1 = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -2 ), imath.V2f( 2 ) ),
+			divisions = imath.V2i( 1000, 1000 )
+		)
+		mesh2 = mesh1.copy()
+
+		# Mismatched interpolations require the Uniform variable to be
+		# promoted to FaceVarying.
+		mesh1["c"] = IECoreScene.PrimitiveVariable(
+			Interpolation.Uniform, IECore.FloatVectorData( [ 1 ] * mesh1.variableSize( Interpolation.Uniform ) )
+		)
+		mesh2["c"] = IECoreScene.PrimitiveVariable(
+			Interpolation.FaceVarying, IECore.FloatVectorData( [ 2 ] * mesh2.variableSize( Interpolation.FaceVarying ) )
+		)
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			PrimitiveAlgo.mergePrimitives( [ ( mesh1, imath.M44f() ), ( mesh2, imath.M44f() ) ] )
+
 	def testMergePrimitivesSimpleMeshes( self ) :
 
 		mesh1 = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -2 ), imath.V2f( 2 ) ) )
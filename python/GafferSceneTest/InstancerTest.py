@@ -3285,5 +3285,97 @@ parent["radius"] = ( 2 + context.getFrame() ) * 15
 		with GafferTest.TestRunner.PerformanceScope() :
 			nodes["instancer"]["out"].object( "/plane/instances" ).render( renderer )
 
+	def testEncapsulatedInstanceArray( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( x, 0, 0 ) for x in range( 0, 4 ) ] ) )
+		points["index"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ 0, 1, 0, 1 ] ) )
+		points["instanceId"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ 10, 11, 12, 13 ] ) )
+		points["testAttr"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.FloatVectorData( [ 0, 1, 2, 3 ] ) )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		sphere = GafferScene.Sphere()
+		sphere["transform"]["translate"].setValue( imath.V3f( 0, 1, 0 ) )
+		cube = GafferScene.Cube()
+
+		prototypes = GafferScene.Parent()
+		prototypes["parent"].setValue( "/" )
+		prototypes["in"].setInput( sphere["out"] )
+		prototypes["children"][0].setInput( cube["out"] )
+
+		instancerFilter = GafferScene.PathFilter()
+		instancerFilter["paths"].setValue( IECore.StringVectorData( [ "/object" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["prototypes"].setInput( prototypes["out"] )
+		instancer["filter"].setInput( instancerFilter["out"] )
+		instancer["prototypeIndex"].setValue( "index" )
+		instancer["id"].setValue( "instanceId" )
+		instancer["attributes"].setValue( "testAttr" )
+		instancer["inactiveIds"].setValue( "11" )
+		instancer["encapsulate"].setValue( True )
+
+		capsule = instancer["out"].object( "/object/instances" )
+
+		# Renderer with native instancing receives a single array.
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer( GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch )
+		renderer.option( "cr:instances", IECore.BoolData( True ) )
+		self.assertTrue( renderer.supportsInstances() )
+		capsule.render( renderer )
+
+		self.assertEqual( renderer.capturedObjectNames(), [ "" ] )
+		instances = renderer.capturedObject( "" ).capturedInstances()
+		self.assertEqual( instances["prototypeNames"], IECore.StringVectorData( [ "sphere", "cube" ] ) )
+		self.assertEqual( instances["prototypes"][0], sphere["out"].object( "/sphere" ) )
+		self.assertEqual( instances["prototypes"][1], cube["out"].object( "/cube" ) )
+		self.assertEqual( instances["prototypeIndices"], IECore.IntVectorData( [ 0, -1, 0, 1 ] ) )
+		self.assertEqual( instances["ids"], IECore.Int64VectorData( [ 10, 11, 12, 13 ] ) )
+		self.assertEqual( instances["transformTimes"], IECore.FloatVectorData() )
+		self.assertEqual( instances["attributes"], IECore.CompoundData( { "testAttr" : IECore.FloatVectorData( [ 0, 1, 2, 3 ] ) } ) )
+
+		transforms = instances["transforms"]
+		self.assertEqual( len( transforms ), 4 )
+		self.assertEqual( transforms[0].translation(), imath.V3f( 0, 1, 0 ) )
+		self.assertEqual( transforms[2].translation(), imath.V3f( 2, 1, 0 ) )
+		self.assertEqual( transforms[3].translation(), imath.V3f( 3, 0, 0 ) )
+
+		# Other renderers receive individual instances, streamed directly
+		# from the capsule without building the arrays.
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer( GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch )
+		self.assertFalse( renderer.supportsInstances() )
+		capsule.render( renderer )
+
+		self.assertEqual( sorted( renderer.capturedObjectNames() ), [ "cube/13", "sphere/10", "sphere/12" ] )
+		sphere12 = renderer.capturedObject( "sphere/12" )
+		self.assertEqual( sphere12.capturedTransforms(), [ transforms[2] ] )
+		self.assertEqual( sphere12.capturedSamples(), [ sphere["out"].object( "/sphere" ) ] )
+		self.assertEqual( sphere12.capturedAttributes().attributes()["testAttr"], IECore.FloatData( 2 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testEncapsulatedInstanceArrayPerf( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ),
+			imath.V2i( 3161 )
+		)
+		self.assertEqual( mesh.variableSize( IECoreScene.PrimitiveVariable.Interpolation.Vertex ), 3162 * 3162 )
+
+		nodes = self.initSimpleInstancer()
+		nodes["meshSource"]["object"].setValue( mesh )
+		nodes["meshSource"]["out"].object( "/plane" )
+		nodes["instancer"]["encapsulate"].setValue( True )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer( GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch )
+		renderer.option( "cr:instances", IECore.BoolData( True ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			nodes["instancer"]["out"].object( "/plane/instances" ).render( renderer )
+
+		self.assertEqual( len( renderer.capturedObject( "" ).capturedInstances()["transforms"] ), 3162 * 3162 )
+
 if __name__ == "__main__":
 	unittest.main()
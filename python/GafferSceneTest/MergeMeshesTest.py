@@ -38,7 +38,9 @@ import unittest
 import imath
 import inspect
 import pathlib
+import os
 import random
+import subprocess
 
 import IECore
 import IECoreScene
@@ -822,6 +824,47 @@ class MergeMeshesTest( GafferSceneTest.SceneTestCase ) :
 		)
 		self.assertBoundingBoxesValid( mergeMeshes["out"] )
 
+	def testStreaming( self ) :
+
+		sphere = GafferScene.Sphere()
+		plane = GafferScene.Plane()
+		plane["transform"]["translate"].setValue( imath.V3f( 2, 0, 0 ) )
+		camera = GafferScene.Camera()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( plane["out"] )
+		group["in"][2].setInput( camera["out"] )
+		group["transform"]["rotate"].setValue( imath.V3f( 0, 45, 0 ) )
+
+		groupFilter = GafferScene.PathFilter()
+		groupFilter["paths"].setValue( IECore.StringVectorData( [ "/group/*" ] ) )
+
+		mergeMeshes = GafferScene.MergeMeshes()
+		mergeMeshes["in"].setInput( group["out"] )
+		mergeMeshes["filter"].setInput( groupFilter["out"] )
+
+		streamingMergeMeshes = GafferScene.MergeMeshes()
+		streamingMergeMeshes["in"].setInput( group["out"] )
+		streamingMergeMeshes["filter"].setInput( groupFilter["out"] )
+		streamingMergeMeshes["streaming"].setValue( True )
+
+		# The camera is skipped, and the streamed merge matches the regular one.
+
+		self.assertScenesEqual( streamingMergeMeshes["out"], mergeMeshes["out"] )
+		self.assertEqual( streamingMergeMeshes["out"].object( "/mergedMesh" ), mergeMeshes["out"].object( "/mergedMesh" ) )
+		self.assertSceneHashesEqual( streamingMergeMeshes["out"], mergeMeshes["out"] )
+
+		# A single mesh is just transformed.
+
+		groupFilter["paths"].setValue( IECore.StringVectorData( [ "/group/sphere" ] ) )
+		self.assertScenesEqual( streamingMergeMeshes["out"], mergeMeshes["out"] )
+
+		# And if there are no meshes at all, we get a null object.
+
+		groupFilter["paths"].setValue( IECore.StringVectorData( [ "/group/camera" ] ) )
+		self.assertEqual( streamingMergeMeshes["out"].object( "/mergedMesh" ), IECore.NullObject.defaultNullObject() )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testPerformance( self ) :
 		sphere = GafferScene.Sphere()
@@ -914,5 +957,89 @@ class MergeMeshesTest( GafferSceneTest.SceneTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope():
 			GafferSceneTest.traverseScene( mergeMeshes["out"] )
 
+	@staticmethod
+	def _streamingScript( streaming ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["plane"] = GafferScene.Plane()
+		script["plane"]["divisions"].setValue( imath.V2i( 200 ) )
+
+		script["planeFilter"] = GafferScene.PathFilter()
+		script["planeFilter"]["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		# Translating each copy, and then freezing the transform, gives us
+		# sources with unique point data.
+
+		script["duplicate"] = GafferScene.Duplicate()
+		script["duplicate"]["in"].setInput( script["plane"]["out"] )
+		script["duplicate"]["filter"].setInput( script["planeFilter"]["out"] )
+		script["duplicate"]["copies"].setValue( 500 )
+		script["duplicate"]["transform"]["translate"].setValue( imath.V3f( 1, 0, 0 ) )
+
+		script["allFilter"] = GafferScene.PathFilter()
+		script["allFilter"]["paths"].setValue( IECore.StringVectorData( [ "/*" ] ) )
+
+		script["freezeTransform"] = GafferScene.FreezeTransform()
+		script["freezeTransform"]["in"].setInput( script["duplicate"]["out"] )
+		script["freezeTransform"]["filter"].setInput( script["allFilter"]["out"] )
+
+		script["mergeMeshes"] = GafferScene.MergeMeshes()
+		script["mergeMeshes"]["in"].setInput( script["freezeTransform"]["out"] )
+		script["mergeMeshes"]["filter"].setInput( script["allFilter"]["out"] )
+		script["mergeMeshes"]["streaming"].setValue( streaming )
+
+		return script
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testStreamingPerformance( self ) :
+
+		script = self._streamingScript( streaming = True )
+		GafferSceneTest.traverseScene( script["duplicate"]["out"] )
+
+		# Streaming only saves memory if the cache isn't holding on to the sources.
+		cacheLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, cacheLimit )
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["mergeMeshes"]["out"].object( "/mergedMesh" )
+
+	@staticmethod
+	def _streamingPeakRSS( streaming ) :
+
+		import resource
+
+		script = MergeMeshesTest._streamingScript( streaming )
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+		script["mergeMeshes"]["out"].object( "/mergedMesh" )
+
+		# `ru_maxrss` is measured in kilobytes on Linux.
+		return resource.getrusage( resource.RUSAGE_SELF ).ru_maxrss
+
+	@unittest.skipIf( os.name == "nt", "The `resource` module is not available on Windows." )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "expensivePerformance" } )
+	def testStreamingMemoryUsage( self ) :
+
+		# Peak RSS can only be measured for a process as a whole, so we
+		# perform each merge in a fresh subprocess.
+
+		def peakRSS( streaming ) :
+
+			output = subprocess.check_output(
+				[
+					str( Gaffer.executablePath() ), "env", "python", "-c",
+					"import GafferSceneTest; print( GafferSceneTest.MergeMeshesTest._streamingPeakRSS( {} ) )".format( streaming )
+				],
+				text = True
+			)
+			return int( output.split()[-1] ) / 1024.0
+
+		nonStreaming = peakRSS( False )
+		streaming = peakRSS( True )
+
+		print( "\nPeak RSS : {:.1f}MB without streaming, {:.1f}MB with streaming".format( nonStreaming, streaming ) )
+		self.assertLess( streaming, nonStreaming )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1827,5 +1827,105 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 		controller.update()
 		self.assertTrue( capture.isSame( renderer.capturedObject( "/cube" ) ) )
 
+	def testRenderSetEditsOnlyUpdateAffectedLocations( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 100 )
+
+		setFilter = GafferScene.PathFilter()
+		setFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere1", "/sphere2" ] ) )
+
+		renderSet = GafferScene.Set()
+		renderSet["in"].setInput( duplicate["out"] )
+		renderSet["name"].setValue( "render:test" )
+		renderSet["filter"].setInput( setFilter["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( renderSet["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		def assertSets( expectedMembers, expectedEdits ) :
+
+			for i in range( 1, 101 ) :
+				name = "/sphere{}".format( i )
+				o = renderer.capturedObject( name )
+				self.assertEqual(
+					o.capturedAttributes().attributes()["sets"],
+					IECore.InternedStringVectorData( [ "test" ] if name in expectedMembers else [] )
+				)
+				self.assertEqual( o.numAttributeEdits(), expectedEdits.get( name, 1 ), name )
+
+		assertSets( { "/sphere1", "/sphere2" }, {} )
+
+		# Only the locations whose membership changed should be updated.
+
+		setFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere2", "/sphere3" ] ) )
+		controller.update()
+		assertSets( { "/sphere2", "/sphere3" }, { "/sphere1" : 2, "/sphere3" : 2 } )
+
+		# Removing the set entirely should update all its members.
+
+		renderSet["enabled"].setValue( False )
+		controller.update()
+		assertSets( set(), { "/sphere1" : 2, "/sphere2" : 2, "/sphere3" : 3 } )
+
+	def testUnchangedSubtreesAreSkipped( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 100 )
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere1" ] ) )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( duplicate["out"] )
+		attributes["filter"].setInput( sphereFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", 1 ) )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( attributes["out"], Gaffer.Context(), renderer )
+		# Fully expanded, as for InteractiveRender.
+		controller.setMinimumExpansionDepth( 2 ** 64 - 1 )
+		controller.update()
+
+		self.assertEqual( renderer.capturedObject( "/sphere1" ).capturedAttributes().attributes()["test"], IECore.IntData( 1 ) )
+
+		# Only the edited location should need visiting.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			attributes["attributes"][0]["value"].setValue( 2 )
+			controller.update()
+
+		self.assertEqual( renderer.capturedObject( "/sphere1" ).capturedAttributes().attributes()["test"], IECore.IntData( 2 ) )
+		self.assertLessEqual( monitor.plugStatistics( attributes["out"]["attributes"] ).hashCount, 2 )
+		for i in range( 2, 101 ) :
+			self.assertEqual( renderer.capturedObject( "/sphere{}".format( i ) ).numAttributeEdits(), 1 )
+
+		# Edits to the skipped subtrees must still be picked up, as must
+		# reverting to a previously rendered state.
+
+		duplicate["transform"]["translate"]["x"].setValue( 1 )
+		controller.update()
+		self.assertEqual(
+			renderer.capturedObject( "/sphere2" ).capturedTransforms(),
+			[ imath.M44f().translate( imath.V3f( 2, 0, 0 ) ) ]
+		)
+
+		duplicate["transform"]["translate"]["x"].setValue( 0 )
+		controller.update()
+		self.assertEqual(
+			renderer.capturedObject( "/sphere2" ).capturedTransforms(),
+			[ imath.M44f() ]
+		)
+
 if __name__ == "__main__":
 	unittest.main()
@@ -61,6 +61,42 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertEqual( [ s.radius() for s in samples ], [ 0.75, 1.25 ] )
 
+	def testObjectSamplesWithRepeatedHashes( self ) :
+
+		frame = GafferTest.FrameNode()
+
+		sphere = GafferScene.Sphere()
+		sphere["type"].setValue( sphere.Type.Primitive )
+		sphere["radius"].setInput( frame["output"] )
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			with Gaffer.PerformanceMonitor() as monitor :
+				samples = GafferScene.Private.RendererAlgo.objectSamples( sphere["out"]["object"], [ 0.75, 1.25, 1.25, 0.75 ] )
+
+		self.assertEqual( [ s.radius() for s in samples ], [ 0.75, 1.25, 1.25, 0.75 ] )
+		# Each distinct sample is only computed once.
+		self.assertEqual( monitor.plugStatistics( sphere["out"]["object"] ).computeCount, 2 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testObjectSamplesPerformance( self ) :
+
+		frame = GafferTest.FrameNode()
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 1000 ) )
+		sphere["radius"].setInput( frame["output"] )
+
+		sampleTimes = [ 0.75, 0.875, 1.0, 1.125, 1.25 ]
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			with GafferTest.TestRunner.PerformanceScope() :
+				samples = GafferScene.Private.RendererAlgo.objectSamples( sphere["out"]["object"], sampleTimes, _copy = False )
+
+		self.assertEqual( len( samples ), len( sampleTimes ) )
+		for sample, time in zip( samples, sampleTimes ) :
+			self.assertAlmostEqual( sample.bound().max().x, time, delta = 0.0001 )
+
 	def testNonInterpolableObjectSamples( self ) :
 
 		frame = GafferTest.FrameNode()
@@ -925,5 +961,53 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 					else :
 						self.assertIsNone( capsuleRenderer.capturedObject( f"/{purpose}/cube" ) )
 
+	def testObjectDeduplication( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 10 )
+
+		cube = GafferScene.Cube()
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( duplicate["out"] )
+		parent["children"][0].setInput( cube["out"] )
+		parent["parent"].setValue( "/" )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		objectDeduplicator = GafferScene.Private.RendererAlgo.ObjectDeduplicator()
+		GafferScene.Private.RendererAlgo.outputObjects(
+			parent["out"], GafferScene.Private.RendererAlgo.RenderOptions( parent["out"] ),
+			GafferScene.Private.RendererAlgo.RenderSets( parent["out"] ), GafferScene.Private.RendererAlgo.LightLinks(),
+			renderer, objectDeduplicator = objectDeduplicator
+		)
+
+		statistics = objectDeduplicator.statistics()
+		self.assertEqual( statistics.uniqueObjects, 2 )
+		self.assertEqual( statistics.duplicateObjects, 10 )
+		self.assertEqual( statistics.duplicateMemory, 10 * sphere["out"].object( "/sphere" ).memoryUsage() )
+
+		# The first location to be output doesn't know it will be shared, but
+		# all the others should be given the same object.
+
+		samples = [
+			renderer.capturedObject( path ).capturedSamples()[0]
+			for path in [ "/sphere" ] + [ f"/sphere{i}" for i in range( 1, 11 ) ]
+		]
+		self.assertGreaterEqual(
+			max( len( [ s for s in samples if s.isSame( t ) ] ) for t in samples ),
+			10
+		)
+
+		for s in samples :
+			self.assertEqual( s, sphere["out"].object( "/sphere" ) )
+
+		self.assertIsNotNone( renderer.capturedObject( "/cube" ) )
+
 if __name__ == "__main__":
 	unittest.main()
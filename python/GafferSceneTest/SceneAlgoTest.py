@@ -2422,6 +2422,152 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 			IECore.PathMatcher( [ "/group/light1" ] )
 		)
 
+	def testParallelProcessLocationsBatched( self ) :
+
+		sphere = GafferScene.Sphere()
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 30 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( instancer["out"] )
+		group["in"][1].setInput( sphere["out"] )
+
+		expected = GafferScene.SceneAlgo.findAll( group["out"], lambda scene, path : True )
+		self.assertEqual( expected.size(), 31 * 31 + 6 )
+
+		self.assertEqual( GafferSceneTest.traverseSceneBatched( group["out"] ), expected )
+
+		subtree = GafferSceneTest.traverseSceneBatched( group["out"], "/group/plane/instances" )
+		self.assertEqual( subtree.size(), 31 * 31 + 2 )
+		self.assertTrue( subtree.match( "/group/plane/instances/sphere/0" ) & IECore.PathMatcher.Result.ExactMatch )
+		self.assertFalse( subtree.match( "/group/sphere" ) & IECore.PathMatcher.Result.ExactMatch )
+
+	@unittest.skipIf( IECore.hardwareConcurrency() < 2, "Requires multiple threads" )
+	def testParallelProcessLocationsBatchedBinaryHierarchy( self ) :
+
+		# Deep binary hierarchy, where every location has just two children.
+		# These must still be processed in parallel.
+
+		sphere = GafferScene.Sphere()
+		groups = []
+		for i in range( 0, 12 ) :
+			group = GafferScene.Group()
+			upstream = groups[-1]["out"] if groups else sphere["out"]
+			group["in"][0].setInput( upstream )
+			group["in"][1].setInput( upstream )
+			groups.append( group )
+
+		with Gaffer.ThreadMonitor() as monitor :
+			result = GafferSceneTest.traverseSceneBatched( groups[-1]["out"] )
+
+		self.assertEqual( result.size(), 2 ** 13 )
+		self.assertGreater( len( monitor.combinedStatistics() ), 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelProcessLocationsBatchedPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 700 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		# Warm the cache, so that we are measuring traversal overhead
+		# rather than the computes themselves.
+		GafferSceneTest.traverseScene( instancer["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseSceneBatched( instancer["out"] )
+
+	def testFindIntersecting( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["transform"]["translate"].setValue( imath.V3f( 3, 0, 0 ) )
+		duplicate["copies"].setValue( 4 )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( duplicate["out"] )
+		group["transform"]["translate"]["y"].setValue( 10 )
+
+		def assertIntersecting( region, expected, root = "/" ) :
+
+			self.assertEqual(
+				set( GafferScene.SceneAlgo.findIntersecting( group["out"], region, root ).paths() ),
+				{ "/group/" + x for x in expected }
+			)
+
+		# Boxes
+
+		assertIntersecting( imath.Box3f( imath.V3f( -1.5, 0, -1 ), imath.V3f( 1.5, 20, 1 ) ), { "sphere" } )
+		assertIntersecting( imath.Box3f( imath.V3f( 2.5, 0, -1 ), imath.V3f( 6.5, 20, 1 ) ), { "sphere1", "sphere2" } )
+		assertIntersecting( imath.Box3f( imath.V3f( 2.5, -5, -1 ), imath.V3f( 6.5, 5, 1 ) ), set() )
+		assertIntersecting( imath.Box3f( imath.V3f( -100 ), imath.V3f( 100 ) ), { "sphere", "sphere1", "sphere2", "sphere3", "sphere4" } )
+		assertIntersecting( imath.Box3f( imath.V3f( -100 ), imath.V3f( 100 ) ), { "sphere2" }, root = "/group/sphere2" )
+
+		# Frustums
+
+		assertIntersecting( [ imath.Plane3f( imath.V3f( 1, 0, 0 ), 2.5 ), imath.Plane3f( imath.V3f( -1, 0, 0 ), -6.5 ) ], { "sphere1", "sphere2" } )
+		assertIntersecting( [ imath.Plane3f( imath.V3f( 0, -1, 0 ), -5 ) ], set() )
+		assertIntersecting( [], { "sphere", "sphere1", "sphere2", "sphere3", "sphere4" } )
+
+		# Rays
+
+		assertIntersecting( imath.Line3f( imath.V3f( -10, 10, 0 ), imath.V3f( 0, 10, 0 ) ), { "sphere", "sphere1", "sphere2", "sphere3", "sphere4" } )
+		assertIntersecting( imath.Line3f( imath.V3f( 4.5, 10, 0 ), imath.V3f( 5.5, 10, 0 ) ), { "sphere2", "sphere3", "sphere4" } )
+		assertIntersecting( imath.Line3f( imath.V3f( 0, 20, 0 ), imath.V3f( 0, 19, 0 ) ), { "sphere" } )
+		assertIntersecting( imath.Line3f( imath.V3f( 0, 0, 0 ), imath.V3f( 0, -1, 0 ) ), set() )
+
+		# Results must reflect changes to the scene.
+
+		group["transform"]["translate"]["y"].setValue( 0 )
+		assertIntersecting( imath.Box3f( imath.V3f( -1.5, -1, -1 ), imath.V3f( 1.5, 1, 1 ) ), { "sphere" } )
+		duplicate["transform"]["translate"].setValue( imath.V3f( 0.5, 0, 0 ) )
+		assertIntersecting( imath.Box3f( imath.V3f( 2.4, -1, -1 ), imath.V3f( 2.6, 1, 1 ) ), { "sphere3", "sphere4" } )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFindIntersectingPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["radius"].setValue( 0.0001 )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1000 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		# Build the hierarchy up front, so we measure the cost of
+		# subsequent queries.
+		bound = imath.Box3f( imath.V3f( -0.01 ), imath.V3f( 0.01 ) )
+		self.assertEqual( GafferScene.SceneAlgo.findIntersecting( instancer["out"], bound ).size(), 21 * 21 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				GafferScene.SceneAlgo.findIntersecting( instancer["out"], imath.Box3f( imath.V3f( i * 0.01 - 0.5 ), imath.V3f( i * 0.01 - 0.48 ) ) )
+
 	def tearDown( self ) :
 
 		GafferSceneTest.SceneTestCase.tearDown( self )
@@ -377,6 +377,69 @@ class SceneNodeTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( plane["out"].childBounds( "/plane" ), imath.Box3f() )
 		self.assertEqual( sphere["out"].childBounds( "/sphere" ), imath.Box3f() )
 
+	def testSubtreeHash( self ) :
+
+		cube = GafferScene.Cube()
+		sphere = GafferScene.Sphere()
+		group = GafferScene.Group()
+		group["in"][0].setInput( cube["out"] )
+		group["in"][1].setInput( sphere["out"] )
+
+		cubeFilter = GafferScene.PathFilter()
+		cubeFilter["paths"].setValue( IECore.StringVectorData( [ "/group/cube" ] ) )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( group["out"] )
+		attributes["filter"].setInput( cubeFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", 1 ) )
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "group" ] )
+			self.assertEqual( group["out"]["__subtreeHash"].hash(), group["out"].subtreeHash( "/group" ) )
+
+		# Edits anywhere in the subtree are reflected in the hash for
+		# all ancestors, but not for siblings.
+
+		groupHash = group["out"].subtreeHash( "/group" )
+		rootHash = group["out"].subtreeHash( "/" )
+		sphereHash = group["out"].subtreeHash( "/group/sphere" )
+		cubeHash = group["out"].subtreeHash( "/group/cube" )
+
+		cube["transform"]["translate"]["x"].setValue( 10 )
+
+		self.assertNotEqual( group["out"].subtreeHash( "/group" ), groupHash )
+		self.assertNotEqual( group["out"].subtreeHash( "/" ), rootHash )
+		self.assertNotEqual( group["out"].subtreeHash( "/group/cube" ), cubeHash )
+		self.assertEqual( group["out"].subtreeHash( "/group/sphere" ), sphereHash )
+
+		sphereHash = group["out"].subtreeHash( "/group/sphere" )
+		sphere["radius"].setValue( 2 )
+		self.assertNotEqual( group["out"].subtreeHash( "/group/sphere" ), sphereHash )
+
+		# Filtered processors pass through the input hash for subtrees
+		# they don't modify.
+
+		self.assertEqual( attributes["out"].subtreeHash( "/group/sphere" ), attributes["in"].subtreeHash( "/group/sphere" ) )
+		self.assertNotEqual( attributes["out"].subtreeHash( "/group/cube" ), attributes["in"].subtreeHash( "/group/cube" ) )
+		self.assertNotEqual( attributes["out"].subtreeHash( "/group" ), attributes["in"].subtreeHash( "/group" ) )
+
+		groupHash = attributes["out"].subtreeHash( "/group" )
+		sphereHash = attributes["out"].subtreeHash( "/group/sphere" )
+		attributes["attributes"][0]["value"].setValue( 2 )
+		self.assertNotEqual( attributes["out"].subtreeHash( "/group" ), groupHash )
+		self.assertEqual( attributes["out"].subtreeHash( "/group/sphere" ), sphereHash )
+
+		# As do disabled nodes.
+
+		attributes["enabled"].setValue( False )
+		self.assertEqual( attributes["out"].subtreeHash( "/group" ), attributes["in"].subtreeHash( "/group" ) )
+
+		# And nodes which make pass-through connections for everything.
+
+		options = GafferScene.CustomOptions()
+		options["in"].setInput( group["out"] )
+		self.assertEqual( options["out"].subtreeHash( "/group" ), options["in"].subtreeHash( "/group" ) )
+
 	def testEnabledEvaluationUsesGlobalContext( self ) :
 
 		script = Gaffer.ScriptNode()
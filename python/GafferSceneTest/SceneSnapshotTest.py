@@ -0,0 +1,200 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+
+import imath
+
+import IECore
+
+import Gaffer
+import GafferTest
+import GafferScene
+import GafferSceneTest
+
+class SceneSnapshotTest( GafferSceneTest.SceneTestCase ) :
+
+	def __scene( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["transform"]["translate"].setValue( imath.V3f( 1, 2, 3 ) )
+
+		cube = GafferScene.Cube()
+		cube["transform"]["rotate"]["y"].setValue( 45 )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( cube["out"] )
+		group["transform"]["scale"].setValue( imath.V3f( 2 ) )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( group["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", 10 ) )
+
+		filter = GafferScene.PathFilter()
+		filter["paths"].setValue( IECore.StringVectorData( [ "/group/sphere" ] ) )
+		attributes["filter"].setInput( filter["out"] )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( attributes["out"] )
+		duplicate["target"].setValue( "/group" )
+		duplicate["copies"].setValue( 3 )
+
+		return [ sphere, cube, group, attributes, filter, duplicate ]
+
+	def __assertSnapshotMatchesScene( self, snapshot, scene ) :
+
+		visited = set()
+		for i in range( 0, snapshot.size() ) :
+
+			path = snapshot.path( i )
+			visited.add( GafferScene.ScenePlug.pathToString( path ) )
+
+			self.assertEqual( snapshot.find( path ), i )
+			if len( path ) > len( snapshot.root() ) :
+				self.assertEqual( snapshot.name( i ), str( path[-1] ) )
+				self.assertEqual( list( snapshot.path( snapshot.parent( i ) ) ), list( path )[:-1] )
+			else :
+				self.assertIsNone( snapshot.parent( i ) )
+
+			childNames = scene.childNames( path )
+			self.assertEqual(
+				snapshot.subtreeEnd( i ) == i + 1,
+				len( childNames ) == 0
+			)
+
+			self.assertEqual( snapshot.bound( i ), scene.bound( path ) )
+			self.assertEqual( snapshot.transform( i ), scene.transform( path ) )
+			self.assertEqual( snapshot.fullTransform( i ), scene.fullTransform( path ) )
+			self.assertEqual( snapshot.attributes( i ), scene.attributes( path ) )
+			self.assertEqual( snapshot.object( i ), scene.object( path ) )
+
+		expected = set()
+		def visit( path ) :
+			expected.add( path )
+			for childName in scene.childNames( path ) :
+				visit( path.rstrip( "/" ) + "/" + str( childName ) )
+
+		visit( GafferScene.ScenePlug.pathToString( snapshot.root() ) )
+		self.assertEqual( visited, expected )
+
+	def test( self ) :
+
+		nodes = self.__scene()
+		scene = nodes[-1]["out"]
+
+		snapshot = GafferScene.SceneSnapshot( scene )
+		self.assertEqual( snapshot.components(), GafferScene.SceneSnapshot.Components.All )
+		self.assertEqual( snapshot.root(), IECore.InternedStringVectorData() )
+		self.assertEqual( len( snapshot ), snapshot.size() )
+		self.assertEqual( snapshot.subtreeEnd( 0 ), snapshot.size() )
+		self.__assertSnapshotMatchesScene( snapshot, scene )
+
+	def testRoot( self ) :
+
+		nodes = self.__scene()
+		scene = nodes[-1]["out"]
+
+		snapshot = GafferScene.SceneSnapshot( scene, "/group2" )
+		self.assertEqual( snapshot.root(), IECore.InternedStringVectorData( [ "group2" ] ) )
+		self.assertEqual( snapshot.size(), 3 )
+		self.assertEqual( snapshot.find( [ "group" ] ), None )
+		self.assertEqual( snapshot.find( [ "group2", "cube" ] ), 2 )
+		self.assertEqual( snapshot.find( [ "group2", "notHere" ] ), None )
+		self.__assertSnapshotMatchesScene( snapshot, scene )
+
+		with self.assertRaisesRegex( RuntimeError, 'Location "/notHere" does not exist' ) :
+			GafferScene.SceneSnapshot( scene, "/notHere" )
+
+	def testComponents( self ) :
+
+		nodes = self.__scene()
+		scene = nodes[-1]["out"]
+
+		snapshot = GafferScene.SceneSnapshot( scene, components = GafferScene.SceneSnapshot.Components.Bound )
+		self.assertEqual( snapshot.bound( 0 ), scene.bound( "/" ) )
+		for method in ( snapshot.transform, snapshot.fullTransform, snapshot.attributes, snapshot.object ) :
+			with self.assertRaises( ValueError ) :
+				method( 0 )
+
+		with self.assertRaises( IndexError ) :
+			snapshot.path( snapshot.size() )
+
+	def testContext( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["sphere"]["name"] = context["sphereName"]' )
+
+		with Gaffer.Context() as context :
+			context["sphereName"] = "ball"
+			snapshot = GafferScene.SceneSnapshot( script["sphere"]["out"] )
+
+		self.assertEqual( snapshot.find( [ "ball" ] ), 1 )
+
+	def testNoCopy( self ) :
+
+		sphere = GafferScene.Sphere()
+		snapshot = GafferScene.SceneSnapshot( sphere["out"] )
+		self.assertTrue(
+			snapshot.object( 1, _copy = False ).isSame( sphere["out"].object( "/sphere", _copy = False ) )
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 500 ) )
+
+		sphere = GafferScene.Sphere()
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			snapshot = GafferScene.SceneSnapshot( instancer["out"] )
+
+		self.assertEqual( snapshot.size(), 501 * 501 + 4 )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -498,5 +498,62 @@ class SceneWriterTest( GafferSceneTest.SceneTestCase ) :
 				context.setFrame( frame )
 				self.assertPathsEqual( reader["out"], "/_1", sphere["out"], "/1" )
 
+	def testComputeErrorPropagates( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+
+		script["duplicate"] = GafferScene.Duplicate()
+		script["duplicate"]["in"].setInput( script["sphere"]["out"] )
+		script["duplicate"]["target"].setValue( "/sphere" )
+		script["duplicate"]["copies"].setValue( 1000 )
+
+		script["customAttributes"] = GafferScene.CustomAttributes()
+		script["customAttributes"]["in"].setInput( script["duplicate"]["out"] )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( inspect.cleandoc(
+			"""
+			if context.get( "scene:path" ) == IECore.InternedStringVectorData( [ "sphere500" ] ) :
+				raise Exception( "Bad location" )
+			parent["customAttributes"]["extraAttributes"] = IECore.CompoundObject()
+			"""
+		) )
+
+		script["writer"] = GafferScene.SceneWriter()
+		script["writer"]["in"].setInput( script["customAttributes"]["out"] )
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+
+		with self.assertRaisesRegex( Gaffer.ProcessException, "Bad location" ) :
+			script["writer"]["task"].execute()
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testWriteThroughput( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 316 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		writer = GafferScene.SceneWriter()
+		writer["in"].setInput( instancer["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+
+		# Prime the cache, so that we are measuring the cost of writing
+		# rather than that of computing the scene.
+		GafferSceneTest.traverseScene( instancer["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -331,6 +331,24 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def testSetDelta( self ) :
+
+		before = IECore.PathMatcher( [ "/a", "/a/b", "/c", "/d/e/f" ] )
+		after = IECore.PathMatcher( [ "/a", "/c/d", "/d/e/f", "/g" ] )
+
+		delta = GafferScene.SetAlgo.setDelta( before, after )
+		self.assertEqual( set( delta.added.paths() ), { "/c/d", "/g" } )
+		self.assertEqual( set( delta.removed.paths() ), { "/a/b", "/c" } )
+
+		s = IECore.PathMatcher( before )
+		self.assertTrue( GafferScene.SetAlgo.applySetDelta( s, delta ) )
+		self.assertEqual( s, after )
+		self.assertFalse( GafferScene.SetAlgo.applySetDelta( s, delta ) )
+
+		delta = GafferScene.SetAlgo.setDelta( after, after )
+		self.assertTrue( delta.added.isEmpty() )
+		self.assertTrue( delta.removed.isEmpty() )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
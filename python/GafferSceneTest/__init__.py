@@ -94,8 +94,10 @@ from .GridTest import GridTest
 from .SetTest import SetTest
 from .FreezeTransformTest import FreezeTransformTest
 from .SetFilterTest import SetFilterTest
+from .BoundFilterTest import BoundFilterTest
 from .FilterTest import FilterTest
 from .SceneAlgoTest import SceneAlgoTest
+from .SceneSnapshotTest import SceneSnapshotTest
 from .CoordinateSystemTest import CoordinateSystemTest
 from .DeleteOutputsTest import DeleteOutputsTest
 from .ExternalProceduralTest import ExternalProceduralTest
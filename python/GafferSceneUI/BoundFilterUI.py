@@ -0,0 +1,110 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import Gaffer
+import GafferUI
+import GafferScene
+
+Gaffer.Metadata.registerNode(
+
+	GafferScene.BoundFilter,
+
+	"description",
+	"""
+	A filter which matches leaf locations based on their world-space
+	bounds, matching those that intersect either a box or the frustum
+	of a camera. Ancestors of the matched locations are matched as
+	descendant matches in the usual way, so the filter can be used
+	with an Isolate node to cull a scene to the parts that are visible
+	from a camera.
+
+	The filter uses an acceleration structure built from the bounds
+	of the whole input scene, so that it remains fast even for scenes
+	with millions of locations.
+	""",
+
+	"layout:activator:modeIsBound", lambda node : node["mode"].getValue() == GafferScene.BoundFilter.Mode.Bound,
+	"layout:activator:modeIsCamera", lambda node : node["mode"].getValue() == GafferScene.BoundFilter.Mode.Camera,
+
+	plugs = {
+
+		"mode" : [
+
+			"description",
+			"""
+			The region used to match locations. `Bound` uses the box
+			specified by the `bound` plug, and `Camera` uses the
+			frustum of the camera specified by the `camera` plug.
+			""",
+
+			"preset:Bound", GafferScene.BoundFilter.Mode.Bound,
+			"preset:Camera", GafferScene.BoundFilter.Mode.Camera,
+
+			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
+			"nodule:type", "",
+
+		],
+
+		"bound" : [
+
+			"description",
+			"""
+			The world-space box used to match locations when `mode` is
+			`Bound`.
+			""",
+
+			"layout:activator", "modeIsBound",
+			"nodule:type", "",
+
+		],
+
+		"camera" : [
+
+			"description",
+			"""
+			The location of the camera used to match locations when
+			`mode` is `Camera`. The screen window and clipping planes
+			of the camera are taken into account.
+			""",
+
+			"layout:activator", "modeIsCamera",
+			"nodule:type", "",
+
+		],
+
+	}
+
+)
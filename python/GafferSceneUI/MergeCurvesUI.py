@@ -56,4 +56,22 @@ Gaffer.Metadata.registerNode(
 	multiple destinations.
 	""",
 
+	plugs = {
+
+		"streaming" : [
+
+			"description",
+			"""
+			Reduces peak memory usage when merging very large numbers of curves, at
+			the expense of evaluating each source twice : once to measure it, and once
+			to copy it into the result. Sources are released as soon as they have been
+			used, rather than all being held until the merge is complete. Note that
+			sources may still be retained by Gaffer's cache, so this is most effective
+			when the cache is too small to hold all the sources anyway.
+			""",
+
+		],
+
+	},
+
 )
@@ -91,6 +91,7 @@ from . import PrimitiveVariablesUI
 from . import DuplicateUI
 from . import GridUI
 from . import SetFilterUI
+from . import BoundFilterUI
 from . import DeleteGlobalsUI
 from . import DeleteOptionsUI
 from . import CopyOptionsUI
@@ -0,0 +1,163 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class CacheMonitorTest( GafferTest.TestCase ) :
+
+	def testStatistics( self ) :
+
+		m = Gaffer.CacheMonitor()
+
+		a = GafferTest.AddNode()
+		a["op1"].setValue( 1 )
+		a["op2"].setValue( 2 )
+
+		# First evaluation misses both caches, and stores
+		# the result in the compute cache.
+
+		with m :
+			self.assertEqual( a["sum"].getValue(), 3 )
+
+		s = m.plugStatistics( a["sum"] )
+		self.assertEqual( s.hashCacheHits, 0 )
+		self.assertEqual( s.hashCacheMisses, 1 )
+		self.assertEqual( s.computeCacheHits, 0 )
+		self.assertEqual( s.computeCacheMisses, 1 )
+		self.assertEqual( s.computeCacheStores, 1 )
+		self.assertGreater( s.computeCacheBytes, 0 )
+
+		# Second evaluation hits both caches.
+
+		with m :
+			self.assertEqual( a["sum"].getValue(), 3 )
+
+		s = m.plugStatistics( a["sum"] )
+		self.assertEqual( s.hashCacheHits, 1 )
+		self.assertEqual( s.hashCacheMisses, 1 )
+		self.assertEqual( s.computeCacheHits, 1 )
+		self.assertEqual( s.computeCacheMisses, 1 )
+		self.assertEqual( s.computeCacheStores, 1 )
+
+		# Evaluation in a new context requires a new hash,
+		# but the value is still cached.
+
+		with m :
+			with Gaffer.Context() as c :
+				c["myVariable"] = 1
+				self.assertEqual( a["sum"].getValue(), 3 )
+
+		s = m.plugStatistics( a["sum"] )
+		self.assertEqual( s.hashCacheMisses, 2 )
+		self.assertEqual( s.computeCacheHits, 2 )
+		self.assertEqual( s.computeCacheMisses, 1 )
+
+		self.assertEqual( list( m.allStatistics().keys() ), [ a["sum"] ] )
+		self.assertEqual( m.allStatistics()[a["sum"]], s )
+		self.assertEqual( m.combinedStatistics(), s )
+
+	def testNodeTypeStatistics( self ) :
+
+		m = Gaffer.CacheMonitor()
+
+		a1 = GafferTest.AddNode()
+		a2 = GafferTest.AddNode()
+		a2["op1"].setInput( a1["sum"] )
+		a2["op2"].setValue( 1 )
+
+		with m :
+			self.assertEqual( a2["sum"].getValue(), 1 )
+
+		s = m.nodeTypeStatistics()
+		self.assertEqual( list( s.keys() ), [ "GafferTest::AddNode" ] )
+		self.assertEqual( s["GafferTest::AddNode"].computeCacheMisses, 2 )
+		self.assertEqual( s["GafferTest::AddNode"], m.combinedStatistics() )
+
+	def testNoEventsWithoutMonitor( self ) :
+
+		m = Gaffer.CacheMonitor()
+
+		a = GafferTest.AddNode()
+		a["sum"].getValue()
+
+		self.assertEqual( m.allStatistics(), {} )
+		self.assertEqual( m.combinedStatistics(), Gaffer.CacheMonitor.Statistics() )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "taskCollaboration" } )
+	def testCollaborativeWaits( self ) :
+
+		# Processes `1...n` all depend on process `n+1`, so
+		# may collaborate on it rather than compute it themselves.
+
+		GafferTest.clearTestProcessCache()
+
+		n = 1000
+		plug = Gaffer.Plug()
+		with Gaffer.CacheMonitor() as monitor :
+			GafferTest.runTestProcess(
+				plug, 0,
+				{ x : { n + 1 : {} } for x in range( 1, n + 1 ) }
+			)
+
+		s = monitor.plugStatistics( plug )
+		self.assertEqual( s.computeCacheStores, n + 1 )
+		self.assertLess( s.computeCollaborativeWaits, n )
+
+	def testEvictionCounts( self ) :
+
+		cacheLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, cacheLimit )
+
+		Gaffer.ValuePlug.clearCache()
+		evictions = Gaffer.ValuePlug.cacheEvictions()
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+		self.assertEqual( Gaffer.ValuePlug.cacheEvictions(), evictions )
+
+		n = GafferTest.AddNode()
+		for i in range( 0, 10 ) :
+			n["op1"].setValue( i )
+			n["sum"].getValue()
+
+		self.assertGreater( Gaffer.ValuePlug.cacheEvictions(), evictions )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -770,5 +770,19 @@ class ComputeNodeTest( GafferTest.TestCase ) :
 		self.assertEqual( pm.plugStatistics( n1["sum"] ).computeCount, 1 )
 		self.assertEqual( pm.plugStatistics( n2["sum"] ).computeCount, 0 )
 
+	def testPrefetchEnabled( self ) :
+
+		self.addCleanup( Gaffer.ComputeNode.setPrefetchEnabled, Gaffer.ComputeNode.getPrefetchEnabled() )
+
+		n = GafferTest.AddNode()
+		n["op1"].setValue( 1 )
+		n["op2"].setValue( 2 )
+
+		for enabled in ( True, False ) :
+			Gaffer.ComputeNode.setPrefetchEnabled( enabled )
+			self.assertEqual( Gaffer.ComputeNode.getPrefetchEnabled(), enabled )
+			Gaffer.ValuePlug.clearCache()
+			self.assertEqual( n["sum"].getValue(), 3 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -809,6 +809,15 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextCopyPerformance( 10, 10 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testEditableScopePerformance( self ) :
+
+		GafferTest.testEditableScopePerformance( 10, 10 )
+
+	def testHashMaintenance( self ) :
+
+		GafferTest.testContextHashMaintenance()
+
 	def testCopyEditableScope( self ) :
 
 		GafferTest.testCopyEditableScope()
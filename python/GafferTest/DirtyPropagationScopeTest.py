@@ -36,6 +36,8 @@
 
 import unittest
 
+import IECore
+
 import Gaffer
 import GafferTest
 
@@ -60,5 +62,141 @@ class DirtyPropagationScopeTest( GafferTest.TestCase ) :
 
 		self.assertEqual( len( [ x[0] for x in cs if x[0].isSame( n["sum"] ) ] ), 1 )
 
+	def testPlugsDirtiedSignal( self ) :
+
+		a1 = GafferTest.AddNode()
+		a2 = GafferTest.AddNode()
+		a2["op1"].setInput( a1["sum"] )
+
+		cs1 = GafferTest.CapturingSlot( a1.plugDirtiedSignal() )
+		cs2 = GafferTest.CapturingSlot( a2.plugDirtiedSignal() )
+		ccs1 = GafferTest.CapturingSlot( a1.plugsDirtiedSignal() )
+		ccs2 = GafferTest.CapturingSlot( a2.plugsDirtiedSignal() )
+
+		for i in range( 0, 2 ) :
+
+			del cs1[:], cs2[:], ccs1[:], ccs2[:]
+
+			with Gaffer.DirtyPropagationScope() :
+				a1["op1"].setValue( i )
+				a1["op2"].setValue( i )
+
+			# Coalesced signal emitted once per node, with the same
+			# plugs in the same order as the per-plug signal.
+
+			self.assertEqual( len( ccs1 ), 1 )
+			self.assertEqual( [ p.fullName() for p in ccs1[0][0] ], [ x[0].fullName() for x in cs1 ] )
+			self.assertEqual( len( ccs2 ), 1 )
+			self.assertEqual( [ p.fullName() for p in ccs2[0][0] ], [ x[0].fullName() for x in cs2 ] )
+			self.assertEqual( { p.getName() for p in ccs2[0][0] }, { "op1", "sum" } )
+
+	def testRepeatedEditsFollowGraphChanges( self ) :
+
+		a1 = GafferTest.AddNode()
+		a2 = GafferTest.AddNode()
+		a2["op1"].setInput( a1["sum"] )
+
+		cs2 = GafferTest.CapturingSlot( a2.plugDirtiedSignal() )
+		for i in range( 0, 5 ) :
+			del cs2[:]
+			a1["op1"].setValue( i )
+			self.assertEqual( { x[0].getName() for x in cs2 }, { "op1", "sum" } )
+			self.assertEqual( a2["sum"].getValue(), i )
+
+		# Adding a connection must be reflected in
+		# subsequent edits.
+
+		a3 = GafferTest.AddNode()
+		a3["op1"].setInput( a2["sum"] )
+		cs3 = GafferTest.CapturingSlot( a3.plugDirtiedSignal() )
+		for i in range( 0, 2 ) :
+			del cs3[:]
+			a1["op1"].setValue( 10 + i )
+			self.assertEqual( { x[0].getName() for x in cs3 }, { "op1", "sum" } )
+			self.assertEqual( a3["sum"].getValue(), 10 + i )
+
+		# As must removing one.
+
+		a3["op1"].setInput( None )
+		for i in range( 0, 2 ) :
+			del cs3[:]
+			a1["op1"].setValue( 20 + i )
+			self.assertEqual( len( cs3 ), 0 )
+
+		# And adding and removing plugs.
+
+		a2["user"]["p"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		a2["user"]["p"].setInput( a1["sum"] )
+		for i in range( 0, 2 ) :
+			del cs2[:]
+			a1["op1"].setValue( 30 + i )
+			self.assertEqual( { x[0].getName() for x in cs2 }, { "op1", "sum", "p", "user" } )
+
+		del a2["user"]["p"]
+		for i in range( 0, 2 ) :
+			del cs2[:]
+			a1["op1"].setValue( 40 + i )
+			self.assertEqual( { x[0].getName() for x in cs2 }, { "op1", "sum" } )
+
+	def testAffectsErrorsAreNotCached( self ) :
+
+		class FlakyNode( Gaffer.DependencyNode ) :
+
+			def __init__( self, name = "FlakyNode" ) :
+
+				Gaffer.DependencyNode.__init__( self, name )
+
+				self["in"] = Gaffer.IntPlug()
+				self["out"] = Gaffer.IntPlug( direction = Gaffer.Plug.Direction.Out )
+				self.fail = True
+
+			def affects( self, input ) :
+
+				outputs = Gaffer.DependencyNode.affects( self, input )
+				if input.isSame( self["in"] ) :
+					if self.fail :
+						raise RuntimeError( "Oops" )
+					outputs.append( self["out"] )
+
+				return outputs
+
+		node = FlakyNode()
+		cs = GafferTest.CapturingSlot( node.plugDirtiedSignal() )
+
+		with IECore.CapturingMessageHandler() as mh :
+			node["in"].setValue( 1 )
+
+		self.assertEqual( len( mh.messages ), 1 )
+		self.assertEqual( [ x[0].getName() for x in cs ], [ "in" ] )
+
+		# The closure from the failed traversal must not be
+		# replayed once `affects()` is working again.
+
+		node.fail = False
+		for i in range( 0, 2 ) :
+			del cs[:]
+			node["in"].setValue( 2 + i )
+			self.assertEqual( [ x[0].getName() for x in cs ], [ "in", "out" ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testRepeatedEditPerformance( self ) :
+
+		# Large graph where every node is downstream of the first,
+		# via many different paths.
+
+		script = Gaffer.ScriptNode()
+		nodes = []
+		for i in range( 0, 20000 ) :
+			node = GafferTest.MultiplyNode( "n{}".format( i ) )
+			script.addChild( node )
+			if i :
+				node["op1"].setInput( nodes[(i-1)//2]["product"] )
+				node["op2"].setInput( nodes[(i-1)//3]["product"] )
+			nodes.append( node )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 100 ) :
+				nodes[0]["op1"].setValue( i )
+
 if __name__ == "__main__":
 	unittest.main()
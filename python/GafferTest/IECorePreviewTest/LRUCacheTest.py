@@ -228,5 +228,12 @@ class LRUCacheTest( GafferTest.TestCase ) :
 			with self.subTest( policy = policy ) :
 				GafferTest.testLRUCacheSetIfUncached( policy )
 
+	def testEvictionPolicy( self ) :
+
+		# The Serial policy always uses LRU order, so isn't tested here.
+		for policy in [ "parallel", "taskParallel" ] :
+			with self.subTest( policy = policy ) :
+				GafferTest.testLRUCacheEvictionPolicy( policy )
+
 if __name__ == "__main__":
 	unittest.main()
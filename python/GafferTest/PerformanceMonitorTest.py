@@ -100,23 +100,41 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 			hashCount = 10,
 			computeCount = 20,
 			hashDuration = 100,
-			computeDuration = 200
+			computeDuration = 200,
+			collaborativeWaitCount = 5,
+			collaborativeWorkCount = 2,
+			collaborativeWaitDuration = 50,
+			collaborativeIdleDuration = 10
 		)
 
 		self.assertEqual( s.hashCount, 10 )
 		self.assertEqual( s.computeCount, 20 )
 		self.assertEqual( s.hashDuration, 100 )
 		self.assertEqual( s.computeDuration, 200 )
+		self.assertEqual( s.collaborativeWaitCount, 5 )
+		self.assertEqual( s.collaborativeWorkCount, 2 )
+		self.assertEqual( s.collaborativeWaitDuration, 50 )
+		self.assertEqual( s.collaborativeIdleDuration, 10 )
 
 		s.hashCount = 20
 		s.computeCount = 30
 		s.hashDuration = 200
 		s.computeDuration = 300
+		s.collaborativeWaitCount = 6
+		s.collaborativeWorkCount = 3
+		s.collaborativeWaitDuration = 60
+		s.collaborativeIdleDuration = 20
 
 		self.assertEqual( s.hashCount, 20 )
 		self.assertEqual( s.computeCount, 30 )
 		self.assertEqual( s.hashDuration, 200 )
 		self.assertEqual( s.computeDuration, 300 )
+		self.assertEqual( s.collaborativeWaitCount, 6 )
+		self.assertEqual( s.collaborativeWorkCount, 3 )
+		self.assertEqual( s.collaborativeWaitDuration, 60 )
+		self.assertEqual( s.collaborativeIdleDuration, 20 )
+
+		self.assertEqual( eval( repr( s ) ), s )
 
 	def testEnterReturnValue( self ) :
 
@@ -222,6 +240,29 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 		self.assertAlmostEqual( seconds( m.plugStatistics( n2["out"] ).hashDuration ), 0.2, delta = delta )
 		self.assertAlmostEqual( seconds( m.plugStatistics( n2["out"] ).computeDuration ), 0.2, delta = delta )
 
+	@GafferTest.TestRunner.CategorisedTestMethod( { "taskCollaboration" } )
+	def testCollaborativeWaits( self ) :
+
+		# Processes `1...n` all depend on process `n+1`, so
+		# may collaborate on it rather than compute it themselves.
+
+		GafferTest.clearTestProcessCache()
+
+		n = 1000
+		plug = Gaffer.Plug()
+		with Gaffer.PerformanceMonitor() as performanceMonitor, Gaffer.CacheMonitor() as cacheMonitor :
+			GafferTest.runTestProcess(
+				plug, 0,
+				{ x : { n + 1 : {} } for x in range( 1, n + 1 ) }
+			)
+
+		s = performanceMonitor.plugStatistics( plug )
+		self.assertEqual( s.collaborativeWaitCount, cacheMonitor.plugStatistics( plug ).computeCollaborativeWaits )
+		self.assertLessEqual( s.collaborativeWorkCount, s.collaborativeWaitCount )
+		self.assertLessEqual( s.collaborativeIdleDuration, s.collaborativeWaitDuration )
+		if s.collaborativeWaitCount :
+			self.assertGreater( s.collaborativeWaitDuration, 0 )
+
 	def testDontMonitorPreExistingBackgroundTasks( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -0,0 +1,152 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import json
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class TraceMonitorTest( GafferTest.TestCase ) :
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		self.assertEqual( monitor.numEvents(), 0 )
+		self.assertEqual( monitor.numDiscardedEvents(), 0 )
+
+	def testWriteTrace( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add1"] = GafferTest.AddNode()
+		script["add2"] = GafferTest.AddNode()
+		script["add2"]["op1"].setInput( script["add1"]["sum"] )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			script["add2"]["sum"].getValue()
+
+		self.assertGreater( monitor.numEvents(), 0 )
+		self.assertEqual( monitor.numDiscardedEvents(), 0 )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName, encoding = "utf-8" ) as f :
+			trace = json.load( f )
+
+		events = trace["traceEvents"]
+		beginEvents = [ e for e in events if e["ph"] == "B" ]
+		endEvents = [ e for e in events if e["ph"] == "E" ]
+		self.assertEqual( len( beginEvents ), len( endEvents ) )
+
+		self.assertEqual(
+			{ e["name"] for e in beginEvents if e["cat"] == "computeNode:compute" },
+			{ script["add1"]["sum"].fullName(), script["add2"]["sum"].fullName() }
+		)
+
+		missEvents = [ e for e in events if e["ph"] == "i" and e["name"] == "Miss" ]
+		self.assertEqual(
+			{ e["args"]["plug"] for e in missEvents if e["cat"] == "computeNode:compute" },
+			{ script["add1"]["sum"].fullName(), script["add2"]["sum"].fullName() }
+		)
+
+		threadNames = [ e for e in events if e["ph"] == "M" ]
+		self.assertEqual( [ e["tid"] for e in threadNames ], [ Gaffer.ThreadMonitor.thisThreadId() ] )
+
+	def testDiscardedEvents( self ) :
+
+		add = GafferTest.AddNode()
+		monitor = Gaffer.TraceMonitor( eventsPerThread = 10 )
+		context = Gaffer.Context()
+		with monitor, context :
+			for i in range( 0, 100 ) :
+				context["i"] = i # Unique context to force hashing
+				add["sum"].getValue()
+
+		self.assertEqual( monitor.numEvents(), 10 )
+		self.assertGreater( monitor.numDiscardedEvents(), 0 )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName, encoding = "utf-8" ) as f :
+			trace = json.load( f )
+
+		# End events for processes whose begin events were
+		# discarded are omitted, so that the trace is balanced.
+		depth = 0
+		for event in trace["traceEvents"] :
+			if event["ph"] == "B" :
+				depth += 1
+			elif event["ph"] == "E" :
+				depth -= 1
+				self.assertGreaterEqual( depth, 0 )
+
+	def testParallelMonitoring( self ) :
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			GafferTest.parallelGetValue( random["outFloat"], 10000, "test" )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName, encoding = "utf-8" ) as f :
+			trace = json.load( f )
+
+		events = trace["traceEvents"]
+		self.assertEqual(
+			len( [ e for e in events if e["ph"] == "B" ] ),
+			len( [ e for e in events if e["ph"] == "E" ] )
+		)
+
+	def testCantWriteToInvalidFile( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		with self.assertRaisesRegex( RuntimeError, "Unable to open file" ) :
+			monitor.writeTrace( str( self.temporaryDirectory() / "nonexistent" / "trace.json" ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -376,5 +376,86 @@ class TypedObjectPlugTest( GafferTest.TestCase ) :
 		with self.assertRaisesRegex( ValueError, "Default value must not be None" ) :
 			Gaffer.ObjectPlug()
 
+	class FrameVectorNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name = "FrameVectorNode" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["prefix"] = Gaffer.StringPlug()
+			self["out"] = Gaffer.StringVectorDataPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.StringVectorData() )
+
+			self.numComputeCalls = 0
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["prefix"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, output, context, h ) :
+
+			self["prefix"].hash( h )
+			h.append( context.getFrame() )
+
+		def compute( self, output, context ) :
+
+			self.numComputeCalls += 1
+			output.setValue(
+				IECore.StringVectorData( [ self["prefix"].getValue(), str( context.getFrame() ) ] )
+			)
+
+	IECore.registerRunTimeTyped( FrameVectorNode )
+
+	def testGetValues( self ) :
+
+		nodes = []
+		for i in range( 0, 10 ) :
+			node = self.FrameVectorNode()
+			node["prefix"].setValue( "node{}".format( i ) )
+			nodes.append( node )
+
+		static = Gaffer.StringVectorDataPlug( defaultValue = IECore.StringVectorData( [ "static" ] ) )
+
+		plugs = [ n["out"] for n in nodes ] + [ static ]
+		contexts = []
+		for i in range( 0, len( plugs ) ) :
+			context = Gaffer.Context()
+			context.setFrame( i )
+			contexts.append( context )
+
+		# Batched evaluation should match individual evaluation.
+
+		values = Gaffer.StringVectorDataPlug.getValues( plugs, contexts )
+		self.assertEqual( len( values ), len( plugs ) )
+		for plug, context, value in zip( plugs, contexts, values ) :
+			with context :
+				self.assertEqual( value, plug.getValue() )
+
+		self.assertEqual( values[0], IECore.StringVectorData( [ "node0", "0" ] ) )
+		self.assertEqual( values[9], IECore.StringVectorData( [ "node9", "9" ] ) )
+		self.assertEqual( values[10], IECore.StringVectorData( [ "static" ] ) )
+		self.assertEqual( [ n.numComputeCalls for n in nodes ], [ 1 ] * len( nodes ) )
+
+		# Everything is cached now, so there should be no further computes.
+
+		self.assertEqual( Gaffer.StringVectorDataPlug.getValues( plugs, contexts ), values )
+		self.assertEqual( [ n.numComputeCalls for n in nodes ], [ 1 ] * len( nodes ) )
+
+		# Omitting the contexts evaluates everything in the current context.
+
+		with Gaffer.Context() as context :
+			context.setFrame( 100 )
+			values = Gaffer.StringVectorDataPlug.getValues( plugs )
+			for i, node in enumerate( nodes ) :
+				self.assertEqual( values[i], IECore.StringVectorData( [ "node{}".format( i ), "100" ] ) )
+
+		self.assertEqual( Gaffer.StringVectorDataPlug.getValues( [] ), [] )
+
+		with self.assertRaisesRegex( Exception, "Expected 11 contexts but got 1" ) :
+			Gaffer.StringVectorDataPlug.getValues( plugs, contexts[:1] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -77,6 +77,7 @@ class ValuePlugTest( GafferTest.TestCase ) :
 		self.assertFalse( v3.isSame( v2 ) )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCacheEvictionPolicy( self.__originalCacheEvictionPolicy )
 
 		v1 = n["out"].getValue( _copy=False )
 		v2 = n["out"].getValue( _copy=False )
@@ -883,6 +884,78 @@ class ValuePlugTest( GafferTest.TestCase ) :
 		finally:
 			Gaffer.ValuePlug.setHashCacheMode( defaultHashCacheMode )
 
+	def testCompactHashCacheMode( self ) :
+
+		defaultHashCacheMode = Gaffer.ValuePlug.getHashCacheMode()
+		Gaffer.ValuePlug.setHashCacheMode( Gaffer.ValuePlug.HashCacheMode.Compact )
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheMode, defaultHashCacheMode )
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheMode(), Gaffer.ValuePlug.HashCacheMode.Compact )
+
+		Gaffer.ValuePlug.clearHashCache( now = True )
+
+		a1 = GafferTest.AddNode()
+		a2 = GafferTest.AddNode()
+		a2["op1"].setInput( a1["sum"] )
+
+		a1["op1"].setValue( 1 )
+		self.assertEqual( a2["sum"].getValue(), 1 )
+		self.assertGreater( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+
+		# Repeated hashes should come from the cache.
+
+		with Gaffer.PerformanceMonitor() as m :
+			h = a2["sum"].hash()
+			self.assertEqual( a2["sum"].hash(), h )
+		self.assertEqual( m.plugStatistics( a2["sum"] ).hashCount, 0 )
+
+		# Dirtying should invalidate the cache entries.
+
+		a1["op2"].setValue( 2 )
+		self.assertNotEqual( a2["sum"].hash(), h )
+		self.assertEqual( a2["sum"].getValue(), 3 )
+
+		# As should changing the context.
+
+		h = a2["sum"].hash()
+		with Gaffer.PerformanceMonitor() as m :
+			with Gaffer.Context() as c :
+				c["test"] = 1
+				self.assertEqual( a2["sum"].hash(), h )
+		self.assertEqual( m.plugStatistics( a2["sum"] ).hashCount, 1 )
+		self.assertEqual( m.plugStatistics( a1["sum"] ).hashCount, 1 )
+
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+
+	def __testHashCacheLookupPerformance( self, hashCacheMode ) :
+
+		defaultHashCacheMode = Gaffer.ValuePlug.getHashCacheMode()
+		Gaffer.ValuePlug.setHashCacheMode( hashCacheMode )
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheMode, defaultHashCacheMode )
+
+		# Deep graph, where every plug needs a hash cache lookup.
+
+		nodes = [ GafferTest.AddNode() ]
+		for i in range( 0, 200 ) :
+			nodes.append( GafferTest.AddNode() )
+			nodes[-1]["op1"].setInput( nodes[-2]["sum"] )
+
+		plugs = [ n["sum"] for n in nodes ]
+		GafferTest.repeatHash( plugs, 100, 1 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.repeatHash( plugs, 100, 500 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testHashCacheLookupPerformance( self ) :
+
+		self.__testHashCacheLookupPerformance( Gaffer.ValuePlug.HashCacheMode.Standard )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testCompactHashCacheLookupPerformance( self ) :
+
+		self.__testHashCacheLookupPerformance( Gaffer.ValuePlug.HashCacheMode.Compact )
+
 	def testDefaultHash( self ) :
 
 		# Plug with single value
@@ -1067,17 +1140,181 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	def testPersistentCache( self ) :
+
+		Gaffer.ValuePlug.setPersistentCacheDirectory( str( self.temporaryDirectory() / "persistentCache" ) )
+		self.assertEqual( Gaffer.ValuePlug.getPersistentCacheDirectory(), str( self.temporaryDirectory() / "persistentCache" ) )
+		Gaffer.ValuePlug.setPersistentCacheComputeThreshold( 0 )
+		Gaffer.ValuePlug.resetPersistentCacheStatistics()
+
+		n = GafferTest.CachingTestNode()
+		n["in"].setValue( "persistent" )
+
+		# First compute should write to the persistent cache.
+
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( n["out"].getValue(), IECore.StringData( "persistent" ) )
+
+		self.assertEqual( m.plugStatistics( n["out"] ).computeCount, 1 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().writes, 1 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().hits, 0 )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		# Clearing the in-memory cache should cause the value to be
+		# loaded from disk rather than recomputed.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as m, Gaffer.CacheMonitor() as cm :
+			self.assertEqual( n["out"].getValue(), IECore.StringData( "persistent" ) )
+
+		self.assertEqual( m.plugStatistics( n["out"] ).computeCount, 0 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().hits, 1 )
+
+		# Loading from disk is not the same as an in-memory hit, so
+		# should be reported separately.
+
+		self.assertEqual( cm.plugStatistics( n["out"] ).computeCacheHits, 0 )
+		self.assertEqual( cm.plugStatistics( n["out"] ).computePersistentCacheHits, 1 )
+
+		# Clearing the persistent cache too should cause a recompute.
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearPersistentCache()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( n["out"].getValue(), IECore.StringData( "persistent" ) )
+
+		self.assertEqual( m.plugStatistics( n["out"] ).computeCount, 1 )
+
+	def testPersistentCacheComputeThreshold( self ) :
+
+		Gaffer.ValuePlug.setPersistentCacheDirectory( str( self.temporaryDirectory() / "persistentCache" ) )
+		Gaffer.ValuePlug.setPersistentCacheComputeThreshold( 1000 )
+		Gaffer.ValuePlug.resetPersistentCacheStatistics()
+
+		n = GafferTest.CachingTestNode()
+		n["in"].setValue( "quick" )
+		n["out"].getValue()
+
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().writes, 0 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		# Since nothing has ever been stored for this plug, subsequent
+		# misses shouldn't even look on disk.
+
+		Gaffer.ValuePlug.clearCache()
+		n["out"].getValue()
+
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().misses, 0 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().hits, 0 )
+
+		# But once the plug has been expensive enough to store, other
+		# values for the same plug are looked up.
+
+		Gaffer.ValuePlug.setPersistentCacheComputeThreshold( 0 )
+		n["in"].setValue( "stored" )
+		n["out"].getValue()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().writes, 1 )
+
+		n["in"].setValue( "notStored" )
+		n["out"].getValue()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheStatistics().misses, 1 )
+
+	def testPersistentCacheSharedBetweenProcesses( self ) :
+
+		directory = self.temporaryDirectory() / "persistentCache"
+
+		script = Gaffer.ScriptNode()
+		script["node"] = GafferTest.MultiplyNode()
+		script["node"]["op1"].setValue( 2 )
+		script["node"]["op2"].setValue( 21 )
+		script["fileName"].setValue( self.temporaryDirectory() / "test.gfr" )
+		script.save()
+
+		code = (
+			"import Gaffer, GafferTest; "
+			"Gaffer.ValuePlug.setPersistentCacheDirectory( {directory!r} ); "
+			"Gaffer.ValuePlug.setPersistentCacheComputeThreshold( 0 ); "
+			"s = Gaffer.ScriptNode(); s['fileName'].setValue( {fileName!r} ); s.load(); "
+			"assert( s['node']['product'].getValue() == 42 ); "
+			"print( Gaffer.ValuePlug.persistentCacheStatistics().hits )"
+		).format( directory = str( directory ), fileName = str( script["fileName"].getValue() ) )
+
+		hits = [
+			int( subprocess.check_output( [ str( Gaffer.executablePath() ), "env", "python", "-c", code ], universal_newlines = True ) )
+			for i in range( 0, 2 )
+		]
+
+		# The second process should have reused the result from the first.
+		self.assertEqual( hits, [ 0, 1 ] )
+
+	def testCacheEvictionPolicy( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionPolicy(), Gaffer.ValuePlug.CacheEvictionPolicy.LRU )
+
+		class SlowNode( GafferTest.CachingTestNode ) :
+
+			def compute( self, plug, context ) :
+
+				time.sleep( 0.5 )
+				GafferTest.CachingTestNode.compute( self, plug, context )
+
+		# Use large values, so that the cheap values are cheap
+		# relative to their memory usage.
+		padding = "x" * 100000
+
+		slow = SlowNode()
+		slow["in"].setValue( "s000" + padding )
+
+		cheap = GafferTest.CachingTestNode()
+
+		for policy in Gaffer.ValuePlug.CacheEvictionPolicy.values.values() :
+			with self.subTest( policy = policy ) :
+
+				Gaffer.ValuePlug.setCacheEvictionPolicy( policy )
+				self.assertEqual( Gaffer.ValuePlug.getCacheEvictionPolicy(), policy )
+
+				Gaffer.ValuePlug.clearCache()
+				Gaffer.ValuePlug.setCacheMemoryLimit( IECore.StringData( "s000" + padding ).memoryUsage() * 20 )
+
+				# Compute the slow value, followed by enough cheap values
+				# to force evictions.
+
+				slow["out"].getValue()
+				for i in range( 0, 60 ) :
+					cheap["in"].setValue( "c{:03d}".format( i ) + padding )
+					cheap["out"].getValue()
+
+				# The slow value is evicted by the LRU policy, because it
+				# hasn't been used recently. But it should be retained by
+				# the CostAware policy, because it is expensive to recompute.
+
+				with Gaffer.PerformanceMonitor() as m :
+					slow["out"].getValue()
+
+				self.assertEqual(
+					m.plugStatistics( slow["out"] ).computeCount,
+					0 if policy == Gaffer.ValuePlug.CacheEvictionPolicy.CostAware else 1
+				)
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
 
 		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalCacheEvictionPolicy = Gaffer.ValuePlug.getCacheEvictionPolicy()
+		self.__originalPersistentCacheDirectory = Gaffer.ValuePlug.getPersistentCacheDirectory()
+		self.__originalPersistentCacheComputeThreshold = Gaffer.ValuePlug.getPersistentCacheComputeThreshold()
 
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCacheEvictionPolicy( self.__originalCacheEvictionPolicy )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( self.__originalPersistentCacheDirectory )
+		Gaffer.ValuePlug.setPersistentCacheComputeThreshold( self.__originalPersistentCacheComputeThreshold )
 
 if __name__ == "__main__":
 	unittest.main()
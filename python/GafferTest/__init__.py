@@ -136,6 +136,7 @@ from .DownstreamIteratorTest import DownstreamIteratorTest
 from .PerformanceMonitorTest import PerformanceMonitorTest
 from .MetadataAlgoTest import MetadataAlgoTest
 from .ContextMonitorTest import ContextMonitorTest
+from .CacheMonitorTest import CacheMonitorTest
 from .PlugAlgoTest import PlugAlgoTest
 from .BoxInTest import BoxInTest
 from .BoxOutTest import BoxOutTest
@@ -160,6 +161,7 @@ from .HiddenFilePathFilterTest import HiddenFilePathFilterTest
 from .ContextVariableTweaksTest import ContextVariableTweaksTest
 from .OptionalValuePlugTest import OptionalValuePlugTest
 from .ThreadMonitorTest import ThreadMonitorTest
+from .TraceMonitorTest import TraceMonitorTest
 from .CollectTest import CollectTest
 from .ProcessTest import ProcessTest
 from .PatternMatchTest import PatternMatchTest
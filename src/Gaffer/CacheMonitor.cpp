@@ -0,0 +1,203 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/CacheMonitor.h"
+
+#include "Gaffer/Node.h"
+#include "Gaffer/Plug.h"
+#include "Gaffer/ValuePlug.h"
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer;
+
+static CacheMonitor::Statistics g_emptyStatistics;
+
+//////////////////////////////////////////////////////////////////////////
+// CacheMonitor::Statistics
+//////////////////////////////////////////////////////////////////////////
+
+CacheMonitor::Statistics::Statistics()
+	:	hashCacheHits( 0 ), hashCacheMisses( 0 ), hashCollaborativeWaits( 0 ),
+		computeCacheHits( 0 ), computeCacheMisses( 0 ), computeCollaborativeWaits( 0 ),
+		computeCacheStores( 0 ), computeCacheBytes( 0 ), computePersistentCacheHits( 0 )
+{
+}
+
+CacheMonitor::Statistics & CacheMonitor::Statistics::operator += ( const Statistics &rhs )
+{
+	hashCacheHits += rhs.hashCacheHits;
+	hashCacheMisses += rhs.hashCacheMisses;
+	hashCollaborativeWaits += rhs.hashCollaborativeWaits;
+	computeCacheHits += rhs.computeCacheHits;
+	computeCacheMisses += rhs.computeCacheMisses;
+	computeCollaborativeWaits += rhs.computeCollaborativeWaits;
+	computeCacheStores += rhs.computeCacheStores;
+	computeCacheBytes += rhs.computeCacheBytes;
+	computePersistentCacheHits += rhs.computePersistentCacheHits;
+	return *this;
+}
+
+bool CacheMonitor::Statistics::operator == ( const Statistics &rhs )
+{
+	return
+		hashCacheHits == rhs.hashCacheHits &&
+		hashCacheMisses == rhs.hashCacheMisses &&
+		hashCollaborativeWaits == rhs.hashCollaborativeWaits &&
+		computeCacheHits == rhs.computeCacheHits &&
+		computeCacheMisses == rhs.computeCacheMisses &&
+		computeCollaborativeWaits == rhs.computeCollaborativeWaits &&
+		computeCacheStores == rhs.computeCacheStores &&
+		computeCacheBytes == rhs.computeCacheBytes &&
+		computePersistentCacheHits == rhs.computePersistentCacheHits
+	;
+}
+
+bool CacheMonitor::Statistics::operator != ( const Statistics &rhs )
+{
+	return !( *this == rhs );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// CacheMonitor
+//////////////////////////////////////////////////////////////////////////
+
+CacheMonitor::CacheMonitor()
+{
+}
+
+CacheMonitor::~CacheMonitor()
+{
+}
+
+const CacheMonitor::StatisticsMap &CacheMonitor::allStatistics() const
+{
+	collate();
+	return m_statistics;
+}
+
+const CacheMonitor::Statistics &CacheMonitor::plugStatistics( const Plug *plug ) const
+{
+	collate();
+	StatisticsMap::const_iterator it = m_statistics.find( plug );
+	if( it == m_statistics.end() )
+	{
+		return g_emptyStatistics;
+	}
+	return it->second;
+}
+
+const CacheMonitor::Statistics &CacheMonitor::combinedStatistics() const
+{
+	collate();
+	return m_combinedStatistics;
+}
+
+const CacheMonitor::NodeTypeStatisticsMap &CacheMonitor::nodeTypeStatistics() const
+{
+	collate();
+	return m_nodeTypeStatistics;
+}
+
+void CacheMonitor::processStarted( const Process *process )
+{
+}
+
+void CacheMonitor::processFinished( const Process *process )
+{
+}
+
+void CacheMonitor::cacheEvent( const Plug *plug, const IECore::InternedString &processType, CacheEvent event, size_t cost )
+{
+	Statistics &s = m_threadData.local().statistics[plug];
+	if( processType == ValuePlug::hashProcessType() )
+	{
+		switch( event )
+		{
+			case CacheEvent::Hit :
+				s.hashCacheHits++;
+				break;
+			case CacheEvent::Miss :
+				s.hashCacheMisses++;
+				break;
+			case CacheEvent::CollaborativeWait :
+				s.hashCollaborativeWaits++;
+				break;
+			case CacheEvent::Store :
+			case CacheEvent::PersistentHit :
+				break;
+		}
+	}
+	else if( processType == ValuePlug::computeProcessType() )
+	{
+		switch( event )
+		{
+			case CacheEvent::Hit :
+				s.computeCacheHits++;
+				break;
+			case CacheEvent::Miss :
+				s.computeCacheMisses++;
+				break;
+			case CacheEvent::CollaborativeWait :
+				s.computeCollaborativeWaits++;
+				break;
+			case CacheEvent::Store :
+				s.computeCacheStores++;
+				s.computeCacheBytes += cost;
+				break;
+			case CacheEvent::PersistentHit :
+				s.computePersistentCacheHits++;
+				break;
+		}
+	}
+}
+
+void CacheMonitor::collate() const
+{
+	tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance>::iterator it, eIt;
+	for( it = m_threadData.begin(), eIt = m_threadData.end(); it != eIt; ++it )
+	{
+		StatisticsMap &m = it->statistics;
+		for( const auto &[plug, statistics] : m )
+		{
+			m_statistics[plug] += statistics;
+			m_combinedStatistics += statistics;
+			const Node *node = plug->node();
+			m_nodeTypeStatistics[node ? node->typeName() : ""] += statistics;
+		}
+		m.clear();
+	}
+}
@@ -39,8 +39,25 @@
 
 #include "Gaffer/ValuePlug.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
 using namespace Gaffer;
 
+namespace
+{
+
+bool defaultPrefetchEnabled()
+{
+	const char *e = getenv( "GAFFER_PREFETCH" );
+	return e && !strcmp( e, "1" );
+}
+
+std::atomic_bool g_prefetchEnabled( defaultPrefetchEnabled() );
+
+} // namespace
+
 GAFFER_NODE_DEFINE_TYPE( ComputeNode );
 
 ComputeNode::ComputeNode( const std::string &name )
@@ -52,6 +69,16 @@ ComputeNode::~ComputeNode()
 {
 }
 
+void ComputeNode::setPrefetchEnabled( bool enabled )
+{
+	g_prefetchEnabled = enabled;
+}
+
+bool ComputeNode::getPrefetchEnabled()
+{
+	return g_prefetchEnabled;
+}
+
 void ComputeNode::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
 {
 	// Hash in the TypeId for this node - this does two things.
@@ -91,3 +118,7 @@ ValuePlug::CachePolicy ComputeNode::computeCachePolicy( const ValuePlug *output
 	}
 	return ValuePlug::CachePolicy::Default;
 }
+
+void ComputeNode::prefetch( const ValuePlug *output, const Context *context, PrefetchRequests &requests ) const
+{
+}
@@ -229,7 +229,7 @@ static InternedString g_frame( "frame" );
 static InternedString g_framesPerSecond( "framesPerSecond" );
 
 Context::Context()
-	:	m_changedSignal( nullptr ), m_hashValid( false ), m_canceller( nullptr )
+	:	m_changedSignal( nullptr ), m_hash( 0, 0 ), m_hashValid( true ), m_canceller( nullptr )
 {
 	set( g_frame, 1.0f );
 	set( g_framesPerSecond, 24.0f );
@@ -242,14 +242,12 @@ Context::Context( const Context &other )
 
 Context::Context( const Context &other, CopyMode mode )
 	:	m_changedSignal( nullptr ),
-		m_hash( other.m_hash ),
-		m_hashValid( other.m_hashValid ),
+		m_hashValid( false ),
 		m_canceller( other.m_canceller )
 {
 	// Reserving one extra spot before we copy in the existing variables means that we will
 	// avoid a second allocation in the common case where we set exactly one context
-	// variable. Perhaps we should reserve two extra spots - though that is some extra memory
-	// to carry around in cases where we don't add any variables?
+	// variable. This is free when the variables fit in the inline storage of `m_map`.
 	m_map.reserve( other.m_map.size() + 1 );
 
 	if( mode == CopyMode::NonOwning )
@@ -282,6 +280,12 @@ Context::Context( const Context &other, CopyMode mode )
 			}
 		}
 	}
+
+	// Copied values have the same hashes as the originals, so we can
+	// take the total hash directly. We do this last so that it isn't
+	// updated redundantly by the `internalSetWithOwner()` calls above.
+	m_hash = other.m_hash;
+	m_hashValid = other.m_hashValid;
 }
 
 Context::Context( const Context &other, const IECore::Canceller &canceller )
@@ -335,8 +339,8 @@ void Context::remove( const IECore::InternedString &name )
 	Map::iterator it = m_map.find( name );
 	if( it != m_map.end() )
 	{
+		updateHash( it->second, Value() );
 		m_map.erase( it );
-		m_hashValid = false;
 		if( m_changedSignal )
 		{
 			(*m_changedSignal)( this, name );
@@ -355,8 +359,8 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 	{
 		if( StringAlgo::matchMultiple( it->first, pattern ) )
 		{
+			updateHash( it->second, Value() );
 			it = m_map.erase( it );
-			m_hashValid = false;
 			if( m_changedSignal )
 			{
 				(*m_changedSignal)( this, it->first );
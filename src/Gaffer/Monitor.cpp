@@ -129,3 +129,15 @@ bool Monitor::forceMonitoring( const Gaffer::Plug *plug, const IECore::InternedS
 {
 	return false;
 }
+
+void Monitor::cacheEvent( const Gaffer::Plug *plug, const IECore::InternedString &processType, CacheEvent event, size_t cost )
+{
+}
+
+void Monitor::collaborativeWaitStarted( const Gaffer::Plug *plug, const IECore::InternedString &processType )
+{
+}
+
+void Monitor::collaborativeWaitFinished( const Gaffer::Plug *plug, const IECore::InternedString &processType )
+{
+}
@@ -204,6 +204,70 @@ struct HashesPerComputeMetric
 
 };
 
+struct CollaborativeWaitCountMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.collaborativeWaitCount;
+	}
+
+	const std::string description = "number of collaborative waits";
+	const std::string annotation = "performanceMonitor:collaborativeWaitCount";
+	const std::string annotationPrefix = "Collaborative waits : ";
+
+};
+
+struct CollaborativeWaitDurationMetric
+{
+
+	using ResultType = boost::chrono::duration<double>;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.collaborativeWaitDuration;
+	}
+
+	const std::string description = "time spent in collaborative waits";
+	const std::string annotation = "performanceMonitor:collaborativeWaitDuration";
+	const std::string annotationPrefix = "Collaborative wait time : ";
+
+};
+
+struct CollaborativeIdleDurationMetric
+{
+
+	using ResultType = boost::chrono::duration<double>;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.collaborativeIdleDuration;
+	}
+
+	const std::string description = "time spent idle in collaborative waits";
+	const std::string annotation = "performanceMonitor:collaborativeIdleDuration";
+	const std::string annotationPrefix = "Collaborative idle time : ";
+
+};
+
+struct CollaborativeWorkFractionMetric
+{
+
+	using ResultType = double;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return static_cast<double>( s.collaborativeWorkCount ) / std::max( 1.0, static_cast<double>( s.collaborativeWaitCount ) );
+	}
+
+	const std::string description = "fraction of collaborative waits spent working";
+	const std::string annotation = "performanceMonitor:collaborativeWorkFraction";
+	const std::string annotationPrefix = "Collaborative work fraction : ";
+
+};
+
 // Utility for invoking a templated functor with a particular metric.
 template<typename F>
 std::invoke_result_t<F, const HashCountMetric &> dispatchMetric( const F &f, MonitorAlgo::PerformanceMetric performanceMetric )
@@ -226,6 +290,14 @@ std::invoke_result_t<F, const HashCountMetric &> dispatchMetric( const F &f, Mon
 			return f( PerComputeDurationMetric() );
 		case MonitorAlgo::HashesPerCompute :
 			return f( HashesPerComputeMetric() );
+		case MonitorAlgo::CollaborativeWaitCount :
+			return f( CollaborativeWaitCountMetric() );
+		case MonitorAlgo::CollaborativeWaitDuration :
+			return f( CollaborativeWaitDurationMetric() );
+		case MonitorAlgo::CollaborativeIdleDuration :
+			return f( CollaborativeIdleDurationMetric() );
+		case MonitorAlgo::CollaborativeWorkFraction :
+			return f( CollaborativeWorkFractionMetric() );
 		default :
 			return f( InvalidMetric() );
 	}
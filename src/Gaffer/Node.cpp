@@ -74,6 +74,11 @@ Node::UnaryPlugSignal &Node::plugDirtiedSignal()
 	return m_plugDirtiedSignal;
 }
 
+Node::PlugVectorSignal &Node::plugsDirtiedSignal()
+{
+	return m_plugsDirtiedSignal;
+}
+
 Gaffer::Plug *Node::userPlug()
 {
 	return getChild<Plug>( g_firstPlugIndex );
@@ -49,8 +49,13 @@ static PerformanceMonitor::Statistics g_emptyStatistics;
 // PerformanceMonitor::Statistics
 //////////////////////////////////////////////////////////////////////////
 
-PerformanceMonitor::Statistics::Statistics( size_t hashCount, size_t computeCount, boost::chrono::nanoseconds hashDuration, boost::chrono::nanoseconds computeDuration )
-	:	hashCount( hashCount ), computeCount( computeCount ), hashDuration( hashDuration ), computeDuration( computeDuration )
+PerformanceMonitor::Statistics::Statistics(
+	size_t hashCount, size_t computeCount, boost::chrono::nanoseconds hashDuration, boost::chrono::nanoseconds computeDuration,
+	size_t collaborativeWaitCount, size_t collaborativeWorkCount, boost::chrono::nanoseconds collaborativeWaitDuration, boost::chrono::nanoseconds collaborativeIdleDuration
+)
+	:	hashCount( hashCount ), computeCount( computeCount ), hashDuration( hashDuration ), computeDuration( computeDuration ),
+		collaborativeWaitCount( collaborativeWaitCount ), collaborativeWorkCount( collaborativeWorkCount ),
+		collaborativeWaitDuration( collaborativeWaitDuration ), collaborativeIdleDuration( collaborativeIdleDuration )
 {
 }
 
@@ -60,6 +65,10 @@ PerformanceMonitor::Statistics & PerformanceMonitor::Statistics::operator += ( c
 	computeCount += rhs.computeCount;
 	hashDuration += rhs.hashDuration;
 	computeDuration += rhs.computeDuration;
+	collaborativeWaitCount += rhs.collaborativeWaitCount;
+	collaborativeWorkCount += rhs.collaborativeWorkCount;
+	collaborativeWaitDuration += rhs.collaborativeWaitDuration;
+	collaborativeIdleDuration += rhs.collaborativeIdleDuration;
 	return *this;
 }
 
@@ -69,7 +78,11 @@ bool PerformanceMonitor::Statistics::operator == ( const Statistics &rhs )
 		hashCount == rhs.hashCount &&
 		computeCount == rhs.computeCount &&
 		hashDuration == rhs.hashDuration &&
-		computeDuration == rhs.computeDuration
+		computeDuration == rhs.computeDuration &&
+		collaborativeWaitCount == rhs.collaborativeWaitCount &&
+		collaborativeWorkCount == rhs.collaborativeWorkCount &&
+		collaborativeWaitDuration == rhs.collaborativeWaitDuration &&
+		collaborativeIdleDuration == rhs.collaborativeIdleDuration
 	;
 }
 
@@ -130,6 +143,7 @@ void PerformanceMonitor::processStarted( const Process *process )
 		*(threadData.durationStack.top()) += now - threadData.then;
 	}
 	threadData.then = now;
+	threadData.numProcessesStarted++;
 
 	Statistics &s = threadData.statistics[process->plug()];
 	if( type == g_hashType )
@@ -159,6 +173,53 @@ void PerformanceMonitor::processFinished( const Process *process )
 	threadData.then = now;
 }
 
+void PerformanceMonitor::collaborativeWaitStarted( const Plug *plug, const IECore::InternedString &processType )
+{
+	if( processType != g_hashType && processType != g_computeType )
+	{
+		return;
+	}
+
+	ThreadData &threadData = m_threadData.local();
+
+	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
+	if( !threadData.durationStack.empty() )
+	{
+		*(threadData.durationStack.top()) += now - threadData.then;
+	}
+	threadData.then = now;
+
+	// Time spent waiting is billed to the plug being waited on, rather than
+	// to the process doing the waiting. Any processes run while we wait
+	// push their own durations on top, so what remains is idle time.
+	Statistics &s = threadData.statistics[plug];
+	s.collaborativeWaitCount++;
+	threadData.durationStack.push( &s.collaborativeIdleDuration );
+	threadData.collaborativeWaitStack.push( { &s, now, threadData.numProcessesStarted } );
+}
+
+void PerformanceMonitor::collaborativeWaitFinished( const Plug *plug, const IECore::InternedString &processType )
+{
+	if( processType != g_hashType && processType != g_computeType )
+	{
+		return;
+	}
+
+	ThreadData &threadData = m_threadData.local();
+	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
+	*(threadData.durationStack.top()) += now - threadData.then;
+	threadData.durationStack.pop();
+	threadData.then = now;
+
+	const ThreadData::CollaborativeWait &wait = threadData.collaborativeWaitStack.top();
+	wait.statistics->collaborativeWaitDuration += now - wait.startTime;
+	if( threadData.numProcessesStarted != wait.numProcessesStarted )
+	{
+		wait.statistics->collaborativeWorkCount++;
+	}
+	threadData.collaborativeWaitStack.pop();
+}
+
 void PerformanceMonitor::collate() const
 {
 	tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance>::iterator it, eIt;
@@ -0,0 +1,592 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/Private/PersistentCache.h"
+
+#include "Gaffer/Version.h"
+
+#include "IECore/MemoryIndexedIO.h"
+#include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace IECore;
+using namespace Gaffer::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const IndexedIO::EntryID g_valueEntry( "v" );
+const std::string g_signaturesDirectory( "signatures" );
+const size_t g_noPendingLimit = std::numeric_limits<size_t>::max();
+// Beyond this, `set()` writes synchronously rather than queuing more
+// values for the maintenance thread.
+const size_t g_maxPendingWrites = 64;
+
+// Returns a suffix suitable for making a temporary file name that is
+// unique to this thread, even when other processes are writing the
+// same entry concurrently.
+std::string temporarySuffix()
+{
+	thread_local std::mt19937_64 generator( std::random_device{}() );
+	return fmt::format( ".{:016x}.tmp", generator() );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// PersistentCache
+//////////////////////////////////////////////////////////////////////////
+
+PersistentCache::PersistentCache( size_t maxCost )
+	:	m_enabled( false ), m_maxCost( maxCost ), m_currentCost( 0 ),
+		m_bytesWritten( 0 ), m_pendingLimit( g_noPendingLimit ), m_writing( false ), m_stopMaintenance( false ),
+		m_hits( 0 ), m_misses( 0 ), m_writes( 0 ), m_failures( 0 ), m_evictions( 0 )
+{
+}
+
+PersistentCache::~PersistentCache()
+{
+	// The maintenance thread completes any pending
+	// writes before stopping.
+	{
+		std::lock_guard<std::mutex> lock( m_maintenanceMutex );
+		m_stopMaintenance = true;
+	}
+	m_maintenanceCondition.notify_one();
+	if( m_maintenanceThread.joinable() )
+	{
+		m_maintenanceThread.join();
+	}
+}
+
+void PersistentCache::setDirectory( const std::string &directory )
+{
+	// Make sure pending writes go to the directory
+	// that was current when they were requested.
+	flush();
+
+	DirectoryMutex::scoped_lock lock( m_directoryMutex, /* write = */ true );
+	if( directory == m_directory )
+	{
+		return;
+	}
+
+	m_directory = directory;
+	m_versionDirectory.clear();
+	m_currentCost = 0;
+	{
+		SignatureMutex::scoped_lock signatureLock( m_signatureMutex, /* write = */ true );
+		m_signatures.clear();
+	}
+
+	if( !m_directory.empty() )
+	{
+		m_versionDirectory = std::filesystem::path( m_directory ) / Gaffer::versionString();
+		std::error_code e;
+		std::filesystem::create_directories( m_versionDirectory, e );
+		if( e )
+		{
+			IECore::msg(
+				IECore::Msg::Warning, "PersistentCache",
+				fmt::format( "Unable to create directory \"{}\" ({}). Persistent cache disabled.", m_versionDirectory.generic_string(), e.message() )
+			);
+			m_versionDirectory.clear();
+		}
+	}
+
+	const std::filesystem::path versionDirectory = m_versionDirectory;
+	lock.release();
+
+	if( !versionDirectory.empty() )
+	{
+		// Signatures are loaded before enabling, so that entries written
+		// by previous processes are available as soon as we're enabled.
+		loadSignatures( versionDirectory );
+		// Adopt any entries written by previous processes, trimming them
+		// if they exceed our own limit. This requires a full scan of the
+		// directory, so is done in the background.
+		requestLimitCost( m_maxCost );
+	}
+
+	m_enabled = !versionDirectory.empty();
+}
+
+const std::string PersistentCache::getDirectory() const
+{
+	DirectoryMutex::scoped_lock lock( m_directoryMutex, /* write = */ false );
+	return m_directory;
+}
+
+IECore::ConstObjectPtr PersistentCache::get( const IECore::MurmurHash &key, const IECore::MurmurHash &signature )
+{
+	if( !hasSignature( signature ) )
+	{
+		// Nothing like this has ever been stored, so there's no
+		// point in going to the filesystem.
+		return nullptr;
+	}
+
+	const std::filesystem::path directory = versionDirectory();
+	if( directory.empty() )
+	{
+		return nullptr;
+	}
+
+	const std::filesystem::path path = entryPath( directory, key );
+
+	// Read directly into the buffer we'll load from, so the
+	// data is only copied once.
+	CharVectorDataPtr buffer = new CharVectorData;
+	{
+		std::ifstream stream( path, std::ios::binary | std::ios::ate );
+		if( !stream.is_open() )
+		{
+			// Most likely the file just doesn't exist, which is an
+			// entirely normal cache miss.
+			m_misses++;
+			return nullptr;
+		}
+		const std::streamsize size = stream.tellg();
+		std::vector<char> &writableBuffer = buffer->writable();
+		writableBuffer.resize( std::max<std::streamsize>( size, 0 ) );
+		stream.seekg( 0 );
+		if( size <= 0 || !stream.read( writableBuffer.data(), size ) )
+		{
+			m_misses++;
+			m_failures++;
+			return nullptr;
+		}
+	}
+
+	ConstObjectPtr result;
+	try
+	{
+		ConstIndexedIOPtr io = new MemoryIndexedIO( buffer, {}, IndexedIO::Read );
+		result = Object::load( io, g_valueEntry );
+	}
+	catch( ... )
+	{
+		// Corrupt entry, or one containing a type we can't load because
+		// the module providing it isn't loaded. Either way we treat it as
+		// a miss.
+		m_misses++;
+		m_failures++;
+		return nullptr;
+	}
+
+	// Touch the file, so that it is considered to be recently
+	// used when `limitCost()` is called by this or any other process.
+	std::error_code e;
+	std::filesystem::last_write_time( path, std::filesystem::file_time_type::clock::now(), e );
+
+	m_hits++;
+	return result;
+}
+
+void PersistentCache::set( const IECore::MurmurHash &key, const IECore::MurmurHash &signature, const IECore::ConstObjectPtr &value )
+{
+	{
+		std::lock_guard<std::mutex> lock( m_maintenanceMutex );
+		if( m_pendingWrites.size() < g_maxPendingWrites )
+		{
+			m_pendingWrites.push_back( { key, signature, value } );
+			startMaintenanceThread();
+			m_maintenanceCondition.notify_one();
+			return;
+		}
+	}
+
+	write( key, signature, value.get() );
+}
+
+void PersistentCache::flush()
+{
+	std::unique_lock<std::mutex> lock( m_maintenanceMutex );
+	m_flushCondition.wait( lock, [this] { return m_pendingWrites.empty() && !m_writing; } );
+}
+
+bool PersistentCache::write( const IECore::MurmurHash &key, const IECore::MurmurHash &signature, const IECore::Object *value )
+{
+	const std::filesystem::path directory = versionDirectory();
+	if( directory.empty() )
+	{
+		return false;
+	}
+
+	ConstCharVectorDataPtr buffer;
+	try
+	{
+		MemoryIndexedIOPtr io = new MemoryIndexedIO( nullptr, {}, IndexedIO::Write );
+		value->save( io, g_valueEntry );
+		buffer = io->buffer();
+	}
+	catch( ... )
+	{
+		// Not all objects support serialisation.
+		m_failures++;
+		return false;
+	}
+
+	const std::filesystem::path path = entryPath( directory, key );
+	std::error_code e;
+	std::filesystem::create_directories( path.parent_path(), e );
+
+	// Write to a temporary file and then rename, so that readers
+	// never see a partially written entry.
+	const std::filesystem::path temporaryPath = path.string() + temporarySuffix();
+	{
+		std::ofstream stream( temporaryPath, std::ios::binary );
+		stream.write( buffer->readable().data(), buffer->readable().size() );
+		if( !stream.good() )
+		{
+			stream.close();
+			std::filesystem::remove( temporaryPath, e );
+			m_failures++;
+			return false;
+		}
+	}
+
+	std::filesystem::rename( temporaryPath, path, e );
+	if( e )
+	{
+		std::filesystem::remove( temporaryPath, e );
+		m_failures++;
+		return false;
+	}
+
+	m_writes++;
+	addSignature( directory, signature );
+
+	m_bytesWritten += buffer->readable().size();
+	if( ( m_currentCost += buffer->readable().size() ) > m_maxCost )
+	{
+		// Trim a little further than necessary, so that we
+		// aren't scanning the directory on every subsequent write.
+		requestLimitCost( m_maxCost - m_maxCost / 10 );
+	}
+
+	return true;
+}
+
+void PersistentCache::clear()
+{
+	flush();
+
+	const std::filesystem::path directory = versionDirectory();
+	if( directory.empty() )
+	{
+		return;
+	}
+
+	// Wait for any scan in progress, so that it doesn't overwrite
+	// `m_currentCost` with a stale value.
+	std::lock_guard<std::mutex> limitLock( m_limitCostMutex );
+
+	std::error_code e;
+	std::filesystem::remove_all( directory, e );
+	std::filesystem::create_directories( directory, e );
+	m_currentCost = 0;
+
+	SignatureMutex::scoped_lock signatureLock( m_signatureMutex, /* write = */ true );
+	m_signatures.clear();
+}
+
+void PersistentCache::setMaxCost( size_t maxCost )
+{
+	const size_t oldMaxCost = m_maxCost.exchange( maxCost );
+	if( maxCost < oldMaxCost && enabled() )
+	{
+		requestLimitCost( maxCost );
+	}
+}
+
+size_t PersistentCache::getMaxCost() const
+{
+	return m_maxCost;
+}
+
+size_t PersistentCache::currentCost() const
+{
+	return m_currentCost;
+}
+
+PersistentCache::Statistics PersistentCache::statistics() const
+{
+	Statistics result;
+	result.hits = m_hits;
+	result.misses = m_misses;
+	result.writes = m_writes;
+	result.failures = m_failures;
+	result.evictions = m_evictions;
+	return result;
+}
+
+void PersistentCache::resetStatistics()
+{
+	m_hits = 0;
+	m_misses = 0;
+	m_writes = 0;
+	m_failures = 0;
+	m_evictions = 0;
+}
+
+std::filesystem::path PersistentCache::entryPath( const std::filesystem::path &versionDirectory, const IECore::MurmurHash &key ) const
+{
+	// Use the first two characters of the hash to shard entries
+	// into subdirectories, to keep directory sizes manageable.
+	const std::string name = key.toString();
+	return versionDirectory / name.substr( 0, 2 ) / name;
+}
+
+std::filesystem::path PersistentCache::versionDirectory() const
+{
+	DirectoryMutex::scoped_lock lock( m_directoryMutex, /* write = */ false );
+	return m_versionDirectory;
+}
+
+bool PersistentCache::hasSignature( const IECore::MurmurHash &signature ) const
+{
+	SignatureMutex::scoped_lock lock( m_signatureMutex, /* write = */ false );
+	return m_signatures.find( signature ) != m_signatures.end();
+}
+
+void PersistentCache::addSignature( const std::filesystem::path &versionDirectory, const IECore::MurmurHash &signature )
+{
+	if( hasSignature( signature ) )
+	{
+		return;
+	}
+
+	{
+		SignatureMutex::scoped_lock lock( m_signatureMutex, /* write = */ true );
+		if( !m_signatures.insert( signature ).second )
+		{
+			return;
+		}
+	}
+
+	// Record the signature on disk, so that other processes can find it.
+	const std::filesystem::path directory = versionDirectory / g_signaturesDirectory;
+	std::error_code e;
+	std::filesystem::create_directories( directory, e );
+	const uint64_t h[2] = { signature.h1(), signature.h2() };
+	std::ofstream stream( directory / signature.toString(), std::ios::binary );
+	stream.write( reinterpret_cast<const char *>( h ), sizeof( h ) );
+}
+
+void PersistentCache::loadSignatures( const std::filesystem::path &versionDirectory )
+{
+	std::vector<IECore::MurmurHash> signatures;
+	std::error_code e;
+	for( std::filesystem::directory_iterator it( versionDirectory / g_signaturesDirectory, e ), eIt; !e && it != eIt; it.increment( e ) )
+	{
+		uint64_t h[2];
+		std::ifstream stream( it->path(), std::ios::binary );
+		if( stream.read( reinterpret_cast<char *>( h ), sizeof( h ) ) )
+		{
+			signatures.push_back( IECore::MurmurHash( h[0], h[1] ) );
+		}
+	}
+
+	SignatureMutex::scoped_lock lock( m_signatureMutex, /* write = */ true );
+	m_signatures.insert( signatures.begin(), signatures.end() );
+}
+
+void PersistentCache::requestLimitCost( size_t cost )
+{
+	{
+		std::lock_guard<std::mutex> lock( m_maintenanceMutex );
+		m_pendingLimit = m_pendingLimit == g_noPendingLimit ? cost : std::min( m_pendingLimit, cost );
+		startMaintenanceThread();
+	}
+	m_maintenanceCondition.notify_one();
+}
+
+void PersistentCache::startMaintenanceThread()
+{
+	if( !m_maintenanceThread.joinable() )
+	{
+		m_maintenanceThread = std::thread( &PersistentCache::maintenanceThread, this );
+	}
+}
+
+void PersistentCache::maintenanceThread()
+{
+	std::unique_lock<std::mutex> lock( m_maintenanceMutex );
+	while( true )
+	{
+		m_maintenanceCondition.wait(
+			lock, [this] { return m_stopMaintenance || m_pendingLimit != g_noPendingLimit || m_pendingWrites.size(); }
+		);
+
+		if( m_pendingLimit != g_noPendingLimit && !m_stopMaintenance )
+		{
+			const size_t cost = m_pendingLimit;
+			m_pendingLimit = g_noPendingLimit;
+			lock.unlock();
+
+			limitCost( cost );
+			// Pick up signatures written by other processes since
+			// we last looked.
+			const std::filesystem::path directory = versionDirectory();
+			if( !directory.empty() )
+			{
+				loadSignatures( directory );
+			}
+
+			lock.lock();
+		}
+		else if( m_pendingWrites.size() )
+		{
+			// Writes are completed even if we've been asked
+			// to stop, so that they aren't lost on exit.
+			PendingWrite pendingWrite = std::move( m_pendingWrites.front() );
+			m_pendingWrites.pop_front();
+			m_writing = true;
+			lock.unlock();
+
+			write( pendingWrite.key, pendingWrite.signature, pendingWrite.value.get() );
+			// Release the value before reacquiring the lock, since
+			// it may be expensive to destroy.
+			pendingWrite.value.reset();
+
+			lock.lock();
+			m_writing = false;
+			if( m_pendingWrites.empty() )
+			{
+				m_flushCondition.notify_all();
+			}
+		}
+		else
+		{
+			// Nothing left to do, and we've been asked to stop.
+			return;
+		}
+	}
+}
+
+void PersistentCache::limitCost( size_t cost )
+{
+	std::lock_guard<std::mutex> limitLock( m_limitCostMutex );
+
+	const std::filesystem::path directory = versionDirectory();
+	if( directory.empty() )
+	{
+		return;
+	}
+
+	const size_t bytesWrittenBeforeScan = m_bytesWritten;
+
+	struct Entry
+	{
+		std::filesystem::path path;
+		std::filesystem::file_time_type time;
+		size_t size;
+	};
+
+	std::vector<Entry> entries;
+	size_t totalCost = 0;
+
+	std::error_code e;
+	for( std::filesystem::recursive_directory_iterator it( directory, e ), eIt; !e && it != eIt; it.increment( e ) )
+	{
+		if( it->is_directory( e ) && it->path().filename() == g_signaturesDirectory )
+		{
+			it.disable_recursion_pending();
+			continue;
+		}
+		if( !it->is_regular_file( e ) || it->path().extension() == ".tmp" )
+		{
+			continue;
+		}
+		const size_t size = it->file_size( e );
+		const auto time = it->last_write_time( e );
+		if( e )
+		{
+			// Removed by another process while we were iterating.
+			e.clear();
+			continue;
+		}
+		entries.push_back( { it->path(), time, size } );
+		totalCost += size;
+	}
+
+	if( totalCost > cost )
+	{
+		// Remove least recently used entries first.
+		std::sort(
+			entries.begin(), entries.end(),
+			[] ( const Entry &a, const Entry &b ) { return a.time < b.time; }
+		);
+
+		for( const auto &entry : entries )
+		{
+			if( totalCost <= cost )
+			{
+				break;
+			}
+			if( std::filesystem::remove( entry.path, e ) )
+			{
+				m_evictions++;
+			}
+			totalCost -= entry.size;
+		}
+	}
+
+	if( versionDirectory() != directory )
+	{
+		// Directory changed while we were scanning, so our
+		// total is no longer relevant.
+		return;
+	}
+
+	// Account for any entries written while we were scanning. These may
+	// have been counted by the scan already, but erring on the side of
+	// overestimation just means we'll trim a little sooner.
+	m_currentCost = totalCost + ( m_bytesWritten - bytesWrittenBeforeScan );
+}
@@ -56,6 +56,9 @@
 
 #include "fmt/format.h"
 
+#include <atomic>
+#include <unordered_map>
+
 using namespace boost;
 using namespace Gaffer;
 
@@ -94,6 +97,7 @@ Plug::Plug( const std::string &name, Direction direction, unsigned flags )
 
 Plug::~Plug()
 {
+	invalidateDirtyPropagationCache();
 	setInputInternal( nullptr, false );
 	for( OutputContainer::iterator it=m_outputs.begin(); it!=m_outputs.end(); )
 	{
@@ -182,6 +186,10 @@ void Plug::setFlags( unsigned flags, bool enable )
 
 void Plug::setFlagsInternal( unsigned flags )
 {
+	if( ( flags ^ m_flags ) & AcceptsDependencyCycles )
+	{
+		invalidateDirtyPropagationCache();
+	}
 	m_flags = flags;
 }
 
@@ -427,6 +435,7 @@ void Plug::setInput( PlugPtr input, bool setChildInputs, bool updateParentInput
 
 void Plug::setInputInternal( PlugPtr input, bool emit )
 {
+	invalidateDirtyPropagationCache();
 	if( m_input )
 	{
 		m_input->m_outputs.remove( this );
@@ -558,6 +567,8 @@ void Plug::nameChanged( IECore::InternedString oldName )
 
 void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 {
+	invalidateDirtyPropagationCache();
+
 	// When a plug is removed from a node, we need to propagate dirtiness for
 	// it. We must call `DependencyNode::affects()` now, while the plug is still
 	// a child of the node.
@@ -649,6 +660,7 @@ void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 void Plug::parentChanged( Gaffer::GraphComponent *oldParent )
 {
 	GraphComponent::parentChanged( oldParent );
+	invalidateDirtyPropagationCache();
 
 	if( node() )
 	{
@@ -660,6 +672,8 @@ void Plug::parentChanged( Gaffer::GraphComponent *oldParent )
 
 void Plug::childrenReordered( const std::vector<size_t> &oldIndices )
 {
+	invalidateDirtyPropagationCache();
+
 	// Reorder the children of our outputs to match our new order. We disable
 	// undo while we do this, because `childrenReordered()` will be called again
 	// when the original action is undone anyway.
@@ -728,13 +742,22 @@ void Plug::propagateDirtinessAtLeaves( Plug *plugToDirty )
 // The container used is stored per-thread as although it's illegal to be
 // monkeying with a script from multiple threads, it's perfectly legal to
 // be monkeying with a different script in each thread.
+//
+// Editing the same plug repeatedly (for instance, dragging a slider) generates
+// the same dirty closure every time, and for large graphs the traversal is
+// expensive because it calls `DependencyNode::affects()` for every plug
+// visited. We therefore cache the closure for each plug that has been the sole
+// root of a propagation, and replay it until something changes the structure
+// of the graph. Any such change increments `g_graphEpoch`, invalidating all
+// cached closures.
 class Plug::DirtyPlugs
 {
 
 	public :
 
 		DirtyPlugs()
-			:	m_scopeCount( 0 ), m_emitting( false )
+			:	m_scopeCount( 0 ), m_flushPending( false ), m_emitting( false ), m_root( nullptr ), m_rootEpoch( 0 ), m_rootCacheable( false ),
+				m_replaying( nullptr ), m_cacheEpoch( 0 ), m_cacheSize( 0 )
 		{
 		}
 
@@ -747,6 +770,33 @@ class Plug::DirtyPlugs
 
 			m_flushPending = true;
 
+			if( m_replaying )
+			{
+				if( plugToDirty == m_root )
+				{
+					return;
+				}
+				// A second root within the same scope. Populate the
+				// graph from the cached closure and continue as normal.
+				materialise( *m_replaying );
+				m_replaying = nullptr;
+				m_replayPlugs.clear();
+			}
+
+			if( !m_root )
+			{
+				m_root = plugToDirty;
+				m_rootEpoch = g_graphEpoch;
+				if( const Closure *closure = cachedClosure( plugToDirty ) )
+				{
+					m_replaying = closure;
+					// Hold references for the same reasons we do in `m_graph`.
+					m_replayPlugs.assign( closure->plugs.begin(), closure->plugs.end() );
+					return;
+				}
+				m_rootCacheable = true;
+			}
+
 			if( !insertVertex( plugToDirty ).second )
 			{
 				// Previously inserted, so we'll already
@@ -754,7 +804,15 @@ class Plug::DirtyPlugs
 				return;
 			}
 
-			for( DownstreamIterator it( plugToDirty ); !it.done(); ++it )
+			if( plugToDirty != m_root )
+			{
+				// The closure now contains more than the dependents
+				// of `m_root`, so can't be cached for it.
+				m_rootCacheable = false;
+			}
+
+			DownstreamIterator it( plugToDirty );
+			for( ; !it.done(); ++it )
 			{
 				// The `const_casts()` are harmless because we're starting iteration from
 				// a non-const plug. But they are necessary because DownstreamIterator
@@ -776,6 +834,13 @@ class Plug::DirtyPlugs
 					it.prune();
 				}
 			}
+
+			if( it.errors() )
+			{
+				// An `affects()` implementation failed, so the closure may be
+				// incomplete. Don't cache it, so that we try again next time.
+				m_rootCacheable = false;
+			}
 		}
 
 		void pushScope()
@@ -803,9 +868,19 @@ class Plug::DirtyPlugs
 				return;
 			}
 			m_flushPending = false;
-			for( const auto &[ plug, vertex ] : m_plugs )
+			if( m_replaying )
+			{
+				for( const auto &plug : m_replayPlugs )
+				{
+					plug->dirty();
+				}
+			}
+			else
 			{
-				plug->dirty();
+				for( const auto &[ plug, vertex ] : m_plugs )
+				{
+					plug->dirty();
+				}
 			}
 		}
 
@@ -815,6 +890,10 @@ class Plug::DirtyPlugs
 			return g_dirtyPlugs.local();
 		}
 
+		// Incremented whenever the graph is edited in a way that could change
+		// the result of a DownstreamIterator traversal.
+		static std::atomic<uint64_t> g_graphEpoch;
+
 	private :
 
 		// We use this graph structure to keep track of the dirty propagation.
@@ -856,6 +935,17 @@ class Plug::DirtyPlugs
 			m_graph[result] = plug;
 			m_plugs[plug] = result;
 
+			if( const Node *node = plug->node() )
+			{
+				if( !node->refCount() )
+				{
+					// DownstreamIterator ignores nodes under construction,
+					// so the closure will change when construction completes,
+					// without any edit to invalidate the cache.
+					m_rootCacheable = false;
+				}
+			}
+
 			// Insert parent plug.
 			if( auto parent = plug->parent<Plug>() )
 			{
@@ -873,15 +963,116 @@ class Plug::DirtyPlugs
 					// it in emit(). And there's no point signalling dirtiness
 					// because the plug has no parent and therefore can have
 					// no observers.
+					m_rootCacheable = false;
 				}
 			}
 
 			return InsertedVertex( result, true );
 		}
 
+		// Closure cache
+		// =============
+
+		struct Closure
+		{
+			// Indexed by vertex descriptor, so that `edges` can be
+			// reconstructed exactly.
+			std::vector<Plug *> plugs;
+			std::vector<std::pair<VertexDescriptor, VertexDescriptor>> edges;
+			// Vertices in the order that `plugDirtiedSignal()` should
+			// be emitted.
+			std::vector<VertexDescriptor> emitOrder;
+		};
+
+		using ClosureCache = std::unordered_map<const Plug *, Closure>;
+
+		const Closure *cachedClosure( const Plug *root )
+		{
+			const uint64_t epoch = g_graphEpoch;
+			if( epoch != m_cacheEpoch )
+			{
+				clearCache();
+				m_cacheEpoch = epoch;
+				return nullptr;
+			}
+
+			auto it = m_cache.find( root );
+			return it != m_cache.end() ? &it->second : nullptr;
+		}
+
+		void clearCache()
+		{
+			ClosureCache emptyCache;
+			m_cache.swap( emptyCache );
+			m_cacheSize = 0;
+		}
+
+		// Stores the closure currently in `m_graph`, emitted in `emitOrder`.
+		void cacheClosure( const std::vector<VertexDescriptor> &emitOrder )
+		{
+			const size_t size = num_vertices( m_graph ) + num_edges( m_graph );
+			if( size > g_maxCacheSize )
+			{
+				return;
+			}
+
+			if( m_cacheEpoch != m_rootEpoch || m_rootEpoch != g_graphEpoch )
+			{
+				// Graph edited since traversal, or cache belongs to
+				// a different epoch. In the latter case, start afresh.
+				clearCache();
+				m_cacheEpoch = m_rootEpoch;
+				if( m_rootEpoch != g_graphEpoch )
+				{
+					return;
+				}
+			}
+
+			if( m_cacheSize + size > g_maxCacheSize )
+			{
+				clearCache();
+			}
+
+			Closure &closure = m_cache[m_root];
+			closure.plugs.reserve( num_vertices( m_graph ) );
+			for( VertexDescriptor v = 0, e = num_vertices( m_graph ); v < e; ++v )
+			{
+				closure.plugs.push_back( m_graph[v].get() );
+			}
+			closure.edges.reserve( num_edges( m_graph ) );
+			for( const auto &edge : boost::make_iterator_range( boost::edges( m_graph ) ) )
+			{
+				closure.edges.push_back( { boost::source( edge, m_graph ), boost::target( edge, m_graph ) } );
+			}
+			closure.emitOrder = emitOrder;
+			m_cacheSize += size;
+		}
+
+		// Populates `m_graph` and `m_plugs` from a cached closure.
+		void materialise( const Closure &closure )
+		{
+			assert( !num_vertices( m_graph ) );
+			for( Plug *plug : closure.plugs )
+			{
+				VertexDescriptor v = add_vertex( m_graph );
+				m_graph[v] = plug;
+				m_plugs[plug] = v;
+			}
+			for( const auto &[source, target] : closure.edges )
+			{
+				add_edge( source, target, m_graph );
+			}
+			m_rootCacheable = false;
+		}
+
 		struct EmitVisitor : public default_dfs_visitor
 		{
 
+			EmitVisitor( std::vector<VertexDescriptor> &emitOrder, bool &cycles )
+				:	emitOrder( emitOrder ), cycles( cycles )
+			{
+			}
+
 			void back_edge( const EdgeDescriptor &e, const Graph &graph )
 			{
 				IECore::msg(
@@ -892,10 +1083,12 @@ class Plug::DirtyPlugs
 						graph[boost::source( e, graph )]->fullName()
 					)
 				);
+				cycles = true;
 			}
 
 			void finish_vertex( const VertexDescriptor &u, const Graph &graph )
 			{
+				emitOrder.push_back( u );
 				Plug *plug = graph[u].get();
 				if( Node *node = plug->node() )
 				{
@@ -903,8 +1096,38 @@ class Plug::DirtyPlugs
 				}
 			}
 
+			std::vector<VertexDescriptor> &emitOrder;
+			bool &cycles;
+
 		};
 
+		// Emits `Node::plugsDirtiedSignal()` once for each node with
+		// dirtied plugs, in the order their first plug was dirtied.
+		static void emitCoalesced( const std::vector<Plug *> &plugs )
+		{
+			std::vector<std::pair<Node *, std::vector<Plug *>>> nodePlugs;
+			std::unordered_map<Node *, size_t> nodeIndices;
+			for( Plug *plug : plugs )
+			{
+				Node *node = plug->node();
+				if( !node || node->plugsDirtiedSignal().empty() )
+				{
+					continue;
+				}
+				auto [indexIt, inserted] = nodeIndices.try_emplace( node, nodePlugs.size() );
+				if( inserted )
+				{
+					nodePlugs.push_back( { node, {} } );
+				}
+				nodePlugs[indexIt->second].second.push_back( plug );
+			}
+
+			for( const auto &[node, plugs] : nodePlugs )
+			{
+				node->plugsDirtiedSignal()( plugs );
+			}
+		}
+
 		void emit()
 		{
 			// Because we hold a reference to the plugs via m_graph,
@@ -929,15 +1152,60 @@ class Plug::DirtyPlugs
 
 			Private::ScopedAssignment<bool> scopedAssignment( m_emitting, true );
 
+			if( m_replaying )
+			{
+				emitReplay();
+				m_replaying = nullptr;
+				m_root = nullptr;
+				// May destroy plugs, if we were the last owner.
+				m_replayPlugs.clear();
+				// Nothing should have been added to the graph while replaying,
+				// but we clear it anyway so that nothing left behind can leak
+				// into the closure for the next root.
+				clearGraph();
+				return;
+			}
+
+			std::vector<VertexDescriptor> emitOrder;
+			emitOrder.reserve( num_vertices( m_graph ) );
+			bool cycles = false;
+			bool exception = false;
+			try
+			{
+				depth_first_search( m_graph, visitor( EmitVisitor( emitOrder, cycles ) ) );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Error, "Plug dirty propagation", e.what() );
+				exception = true;
+			}
+
 			try
 			{
-				depth_first_search( m_graph, visitor( EmitVisitor() ) );
+				std::vector<Plug *> orderedPlugs; orderedPlugs.reserve( emitOrder.size() );
+				for( auto v : emitOrder )
+				{
+					orderedPlugs.push_back( m_graph[v].get() );
+				}
+				emitCoalesced( orderedPlugs );
 			}
 			catch( const std::exception &e )
 			{
 				IECore::msg( IECore::Msg::Error, "Plug dirty propagation", e.what() );
 			}
 
+			if( m_root && m_rootCacheable && !cycles && !exception )
+			{
+				cacheClosure( emitOrder );
+			}
+			m_root = nullptr;
+			m_rootCacheable = false;
+
+			clearGraph();
+		}
+
+		void clearGraph()
+		{
 			m_graph.clear();
 			// Using swap instead of `clear()` because libstdc++'s `clear()`
 			// method is linear in the number of buckets, _not_ in `size()` as
@@ -959,14 +1227,64 @@ class Plug::DirtyPlugs
 			m_plugs.swap( emptyPlugs );
 		}
 
+		void emitReplay()
+		{
+			std::vector<Plug *> orderedPlugs;
+			orderedPlugs.reserve( m_replaying->emitOrder.size() );
+			for( auto v : m_replaying->emitOrder )
+			{
+				orderedPlugs.push_back( m_replayPlugs[v].get() );
+			}
+
+			try
+			{
+				for( Plug *plug : orderedPlugs )
+				{
+					if( Node *node = plug->node() )
+					{
+						node->plugDirtiedSignal()( plug );
+					}
+				}
+				emitCoalesced( orderedPlugs );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Error, "Plug dirty propagation", e.what() );
+			}
+		}
+
 		Graph m_graph;
 		PlugMap m_plugs;
 		size_t m_scopeCount;
 		bool m_flushPending;
 		bool m_emitting;
 
+		// The first plug inserted in the current scope, and the
+		// epoch at that time.
+		Plug *m_root;
+		uint64_t m_rootEpoch;
+		// True if `m_graph` contains exactly the closure of `m_root`.
+		bool m_rootCacheable;
+		// Non-null when replaying a cached closure for `m_root`
+		// instead of using `m_graph`.
+		const Closure *m_replaying;
+		std::vector<PlugPtr> m_replayPlugs;
+
+		ClosureCache m_cache;
+		uint64_t m_cacheEpoch;
+		// Total number of vertices and edges held in `m_cache`.
+		size_t m_cacheSize;
+		static const size_t g_maxCacheSize = 1000000;
+
 };
 
+std::atomic<uint64_t> Plug::DirtyPlugs::g_graphEpoch( 0 );
+
+void Plug::invalidateDirtyPropagationCache()
+{
+	DirtyPlugs::g_graphEpoch++;
+}
+
 void Plug::propagateDirtiness( Plug *plugToDirty )
 {
 	DirtyPropagationScope scope;
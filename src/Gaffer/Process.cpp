@@ -231,6 +231,33 @@ bool Process::forceMonitoringInternal( const ThreadState &s, const Plug *plug, c
 	return false;
 }
 
+void Process::cacheEventInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheEvent event, size_t cost )
+{
+	for( const auto &m : *s.m_monitors )
+	{
+		m->cacheEvent( plug, processType, event, cost );
+	}
+}
+
+void Process::collaborativeWaitInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, bool finished )
+{
+	if( !s.m_monitors )
+	{
+		return;
+	}
+
+	for( const auto &m : *s.m_monitors )
+	{
+		if( finished )
+		{
+			m->collaborativeWaitFinished( plug, processType );
+		}
+		else
+		{
+			m->collaborativeWaitStarted( plug, processType );
+		}
+	}
+}
 
 //////////////////////////////////////////////////////////////////////////
 // ProcessException
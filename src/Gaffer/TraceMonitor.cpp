@@ -0,0 +1,302 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/TraceMonitor.h"
+
+#include "Gaffer/Context.h"
+#include "Gaffer/Process.h"
+#include "Gaffer/ThreadMonitor.h"
+
+#include "IECore/Exception.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+string jsonEscape( const string &s )
+{
+	string result;
+	result.reserve( s.size() );
+	for( char c : s )
+	{
+		switch( c )
+		{
+			case '"' :
+				result += "\\\"";
+				break;
+			case '\\' :
+				result += "\\\\";
+				break;
+			case '\n' :
+				result += "\\n";
+				break;
+			case '\t' :
+				result += "\\t";
+				break;
+			default :
+				if( (unsigned char)c < 0x20 )
+				{
+					result += fmt::format( "\\u{:04x}", (unsigned)c );
+				}
+				else
+				{
+					result += c;
+				}
+		}
+	}
+	return result;
+}
+
+const char *cacheEventName( Monitor::CacheEvent event )
+{
+	switch( event )
+	{
+		case Monitor::CacheEvent::Hit :
+			return "Hit";
+		case Monitor::CacheEvent::Miss :
+			return "Miss";
+		case Monitor::CacheEvent::CollaborativeWait :
+			return "CollaborativeWait";
+		case Monitor::CacheEvent::Store :
+			return "Store";
+		case Monitor::CacheEvent::PersistentHit :
+			return "PersistentHit";
+	}
+	return "Unknown";
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// TraceMonitor
+//////////////////////////////////////////////////////////////////////////
+
+TraceMonitor::ThreadData::ThreadData()
+	:	threadId( ThreadMonitor::thisThreadId() ), numRecorded( 0 )
+{
+}
+
+TraceMonitor::TraceMonitor( size_t eventsPerThread )
+	:	m_eventsPerThread( std::max<size_t>( eventsPerThread, 1 ) ), m_startTime( std::chrono::steady_clock::now() )
+{
+}
+
+TraceMonitor::~TraceMonitor()
+{
+}
+
+size_t TraceMonitor::numEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.events.size();
+	}
+	return result;
+}
+
+size_t TraceMonitor::numDiscardedEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.numRecorded - threadData.events.size();
+	}
+	return result;
+}
+
+void TraceMonitor::writeTrace( std::ostream &stream ) const
+{
+	std::unordered_map<const Plug *, string> plugNames;
+	auto plugName = [&plugNames] ( const Plug *plug ) -> const string & {
+		auto [it, inserted] = plugNames.try_emplace( plug );
+		if( inserted )
+		{
+			it->second = jsonEscape( plug->fullName() );
+		}
+		return it->second;
+	};
+
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool first = true;
+	auto separator = [&first, &stream] {
+		stream << ( first ? "\n" : ",\n" );
+		first = false;
+	};
+
+	for( const auto &threadData : m_threadData )
+	{
+		separator();
+		stream << fmt::format(
+			"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"Thread {}\"}}}}",
+			threadData.threadId, threadData.threadId
+		);
+
+		// When the ring buffer has wrapped, the oldest event is the
+		// one that would be overwritten next.
+		const size_t size = threadData.events.size();
+		const size_t start = threadData.numRecorded > size ? threadData.numRecorded % size : 0;
+
+		// Processes that started before the oldest retained event have
+		// lost their begin events. We omit their end events, so that
+		// the remaining events are balanced.
+		size_t depth = 0;
+		for( size_t i = 0; i < size; ++i )
+		{
+			const Event &event = threadData.events[(start+i)%size];
+			const double time = (double)event.time / 1000.0;
+			switch( event.type )
+			{
+				case EventType::ProcessBegin :
+					depth++;
+					separator();
+					stream << fmt::format(
+						"{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"B\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"args\":{{\"context\":\"{}\"}}}}",
+						plugName( event.plug ), event.processType.string(), threadData.threadId, time, event.contextHash.toString()
+					);
+					break;
+				case EventType::WaitBegin :
+					depth++;
+					separator();
+					stream << fmt::format(
+						"{{\"name\":\"{}\",\"cat\":\"collaborativeWait\",\"ph\":\"B\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"args\":{{\"processType\":\"{}\"}}}}",
+						plugName( event.plug ), threadData.threadId, time, event.processType.string()
+					);
+					break;
+				case EventType::ProcessEnd :
+				case EventType::WaitEnd :
+					if( !depth )
+					{
+						continue;
+					}
+					depth--;
+					separator();
+					stream << fmt::format(
+						"{{\"ph\":\"E\",\"pid\":0,\"tid\":{},\"ts\":{:.3f}}}",
+						threadData.threadId, time
+					);
+					break;
+				case EventType::Cache :
+					separator();
+					stream << fmt::format(
+						"{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"args\":{{\"plug\":\"{}\",\"context\":\"{}\"}}}}",
+						cacheEventName( event.cacheEvent ), event.processType.string(), threadData.threadId, time,
+						plugName( event.plug ), event.contextHash.toString()
+					);
+					break;
+			}
+		}
+	}
+
+	stream << "\n]}\n";
+}
+
+void TraceMonitor::writeTrace( const std::string &fileName ) const
+{
+	std::ofstream stream( fileName );
+	if( !stream.is_open() )
+	{
+		throw IECore::Exception( fmt::format( "Unable to open file \"{}\"", fileName ) );
+	}
+	writeTrace( stream );
+}
+
+void TraceMonitor::processStarted( const Process *process )
+{
+	record( EventType::ProcessBegin, process->plug(), process->type(), process->context()->hash() );
+}
+
+void TraceMonitor::processFinished( const Process *process )
+{
+	record( EventType::ProcessEnd, process->plug(), process->type(), MurmurHash() );
+}
+
+void TraceMonitor::cacheEvent( const Plug *plug, const IECore::InternedString &processType, CacheEvent event, size_t cost )
+{
+	record( EventType::Cache, plug, processType, Context::current()->hash(), event );
+}
+
+void TraceMonitor::collaborativeWaitStarted( const Plug *plug, const IECore::InternedString &processType )
+{
+	record( EventType::WaitBegin, plug, processType, MurmurHash() );
+}
+
+void TraceMonitor::collaborativeWaitFinished( const Plug *plug, const IECore::InternedString &processType )
+{
+	record( EventType::WaitEnd, plug, processType, MurmurHash() );
+}
+
+void TraceMonitor::record( EventType type, const Plug *plug, const IECore::InternedString &processType, const IECore::MurmurHash &contextHash, CacheEvent cacheEvent )
+{
+	const int64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_startTime ).count();
+
+	ThreadData &threadData = m_threadData.local();
+	if( type != EventType::ProcessEnd && type != EventType::WaitEnd )
+	{
+		// End events always follow a begin event for the same plug, so
+		// we only need to keep the plug alive once.
+		auto it = threadData.plugs.find( plug );
+		if( it == threadData.plugs.end() )
+		{
+			threadData.plugs.emplace( plug, plug );
+		}
+	}
+
+	Event event = { type, cacheEvent, time, plug, processType, contextHash };
+	if( threadData.events.size() < m_eventsPerThread )
+	{
+		threadData.events.push_back( event );
+	}
+	else
+	{
+		threadData.events[threadData.numRecorded % m_eventsPerThread] = event;
+	}
+	threadData.numRecorded++;
+}
@@ -41,17 +41,25 @@
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/Private/PersistentCache.h"
 #include "Gaffer/Process.h"
 
 #include "IECore/MessageHandler.h"
 
 #include "boost/bind/bind.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/concurrent_hash_map.h"
 #include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
 
 #include "fmt/format.h"
 
 #include <atomic>
+#include <chrono>
+#include <optional>
 #include <unordered_set>
 
 using namespace Gaffer;
@@ -104,6 +112,23 @@ const uint64_t DIRTY_COUNT_RANGE_MAX = std::numeric_limits<uint64_t>::max() / 2;
 namespace
 {
 
+// The 64-bit finalizer from MurmurHash3. This is a bijection, so
+// distinct inputs are guaranteed to produce distinct outputs.
+inline uint64_t fmix64( uint64_t k )
+{
+	k ^= k >> 33;
+	k *= 0xff51afd7ed558ccdULL;
+	k ^= k >> 33;
+	k *= 0xc4ceb9fe1a85ec53ULL;
+	k ^= k >> 33;
+	return k;
+}
+
+inline uint64_t rotl64( uint64_t x, int r )
+{
+	return ( x << r ) | ( x >> ( 64 - r ) );
+}
+
 // Key used to index into a cache of hashes. This is specified by
 // the plug the hash was for and the context it was hashed in.
 struct HashCacheKey
@@ -119,8 +144,21 @@ struct HashCacheKey
 		return other.plug == plug && other.contextHash == contextHash && dirtyCount == other.dirtyCount;
 	}
 
-	/// \todo Could we merge all three fields into a single
-	/// MurmurHash, or would hash collisions be too likely?
+	// Folds all three fields into a single 128-bit digest, for use as
+	// the key in `HashCacheMode::Compact`. The context hash is already
+	// well distributed, so rather than paying for two full
+	// `MurmurHash::append()` calls, we just mix the plug and dirty count
+	// and fold them into both halves.
+	IECore::MurmurHash digest() const
+	{
+		const uint64_t p = fmix64( (uint64_t)plug + 0x9e3779b97f4a7c15ULL );
+		const uint64_t d = fmix64( dirtyCount + 0xbf58476d1ce4e5b9ULL );
+		return IECore::MurmurHash(
+			contextHash.h1() ^ p ^ rotl64( d, 32 ),
+			contextHash.h2() ^ d ^ rotl64( p, 32 )
+		);
+	}
+
 	const ValuePlug *plug;
 	IECore::MurmurHash contextHash;
 	uint64_t dirtyCount;
@@ -147,6 +185,144 @@ size_t tbb_hasher( const HashCacheKey &key )
 	return hash_value( key );
 }
 
+// Thread-local cache of hashes used in `HashCacheMode::Compact`, indexed
+// by `HashCacheKey::digest()`. This is a fixed-size open-addressing table,
+// so lookups involve no allocation, no locking and no pointer chasing.
+// Probing is limited to a small neighbourhood of slots, and when the
+// neighbourhood is full we replace its least recently used entry. This
+// approximates the LRU behaviour of the standard cache without needing
+// to maintain a list.
+class CompactHashCache : boost::noncopyable
+{
+
+	public :
+
+		CompactHashCache()
+			:	m_mask( 0 ), m_maxEntries( 0 ), m_clock( 0 ), m_size( 0 ), m_evictions( 0 )
+		{
+		}
+
+		const IECore::MurmurHash *get( const IECore::MurmurHash &key )
+		{
+			for( size_t i = 0, e = std::min( g_probeLength, m_slots.size() ); i < e; ++i )
+			{
+				Slot &slot = m_slots[(key.h1() + i) & m_mask];
+				if( !slot.lastUsed )
+				{
+					// We never erase individual slots, so an empty
+					// slot means the key can't be further along.
+					return nullptr;
+				}
+				if( slot.key == key )
+				{
+					slot.lastUsed = ++m_clock;
+					return &slot.value;
+				}
+			}
+			return nullptr;
+		}
+
+		void set( const IECore::MurmurHash &key, const IECore::MurmurHash &value )
+		{
+			Slot *victim = nullptr;
+			for( size_t i = 0, e = std::min( g_probeLength, m_slots.size() ); i < e; ++i )
+			{
+				Slot &slot = m_slots[(key.h1() + i) & m_mask];
+				if( !slot.lastUsed )
+				{
+					m_size++;
+					victim = &slot;
+					break;
+				}
+				if( slot.key == key )
+				{
+					victim = &slot;
+					break;
+				}
+				if( !victim || slot.lastUsed < victim->lastUsed )
+				{
+					victim = &slot;
+				}
+				if( i == e - 1 )
+				{
+					m_evictions++;
+				}
+			}
+
+			if( victim )
+			{
+				victim->key = key;
+				victim->value = value;
+				victim->lastUsed = ++m_clock;
+			}
+		}
+
+		void clear()
+		{
+			std::fill( m_slots.begin(), m_slots.end(), Slot() );
+			m_size = 0;
+		}
+
+		// The capacity is rounded up to the next power of two, so
+		// the limit is approximate.
+		void setMaxEntries( size_t maxEntries )
+		{
+			if( maxEntries == m_maxEntries )
+			{
+				return;
+			}
+			size_t capacity = 0;
+			if( maxEntries )
+			{
+				capacity = 1;
+				while( capacity < maxEntries )
+				{
+					capacity <<= 1;
+				}
+			}
+			m_slots.assign( capacity, Slot() );
+			m_slots.shrink_to_fit();
+			m_mask = capacity ? capacity - 1 : 0;
+			m_maxEntries = maxEntries;
+			m_size = 0;
+		}
+
+		size_t getMaxEntries() const
+		{
+			return m_maxEntries;
+		}
+
+		size_t size() const
+		{
+			return m_size;
+		}
+
+		size_t evictions() const
+		{
+			return m_evictions;
+		}
+
+	private :
+
+		struct Slot
+		{
+			IECore::MurmurHash key;
+			IECore::MurmurHash value;
+			// Zero for empty slots.
+			uint64_t lastUsed = 0;
+		};
+
+		static constexpr size_t g_probeLength = 8;
+
+		std::vector<Slot> m_slots;
+		size_t m_mask;
+		size_t m_maxEntries;
+		uint64_t m_clock;
+		size_t m_size;
+		size_t m_evictions;
+
+};
+
 ValuePlug::HashCacheMode defaultHashCacheMode()
 {
 	/// \todo Remove
@@ -166,9 +342,13 @@ ValuePlug::HashCacheMode defaultHashCacheMode()
 		{
 			return ValuePlug::HashCacheMode::Standard;
 		}
+		else if( !strcmp( e, "Compact" ) )
+		{
+			return ValuePlug::HashCacheMode::Compact;
+		}
 		else
 		{
-			IECore::msg( IECore::Msg::Warning, "ValuePlug", "Invalid value for GAFFER_HASHCACHE_MODE. Must be Standard, Checked or Legacy." );
+			IECore::msg( IECore::Msg::Warning, "ValuePlug", "Invalid value for GAFFER_HASHCACHE_MODE. Must be Standard, Compact, Checked or Legacy." );
 		}
 	}
 	return ValuePlug::HashCacheMode::Standard;
@@ -230,10 +410,18 @@ class ValuePlug::HashProcess : public Process
 			if( threadData.clearCache.load( std::memory_order_acquire ) )
 			{
 				threadData.cache.clear();
+				threadData.compactCache.clear();
 				threadData.clearCache.store( 0, std::memory_order_release );
 			}
 
-			if( threadData.cache.getMaxCost() != g_cacheSizeLimit )
+			const bool compact = g_hashCacheMode == HashCacheMode::Compact;
+			if( compact )
+			{
+				// Allocated lazily, so there is no overhead for threads
+				// that don't use compact mode.
+				threadData.compactCache.setMaxEntries( g_cacheSizeLimit );
+			}
+			else if( threadData.cache.getMaxCost() != g_cacheSizeLimit )
 			{
 				threadData.cache.setMaxCost( g_cacheSizeLimit );
 			}
@@ -255,10 +443,20 @@ class ValuePlug::HashProcess : public Process
 				}
 
 				// Check for an already-cached value in our thread-local cache, and return it if we have one.
+				const IECore::MurmurHash compactKey = compact ? cacheKey.digest() : IECore::MurmurHash();
 				if( !forceMonitoring )
 				{
-					if( auto result = threadData.cache.getIfCached( cacheKey ) )
+					if( compact )
 					{
+						if( const IECore::MurmurHash *result = threadData.compactCache.get( compactKey ) )
+						{
+							Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Hit );
+							return *result;
+						}
+					}
+					else if( auto result = threadData.cache.getIfCached( cacheKey ) )
+					{
+						Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Hit );
 						return *result;
 					}
 				}
@@ -268,6 +466,7 @@ class ValuePlug::HashProcess : public Process
 				IECore::MurmurHash result;
 				if( cachePolicy == CachePolicy::Default || cachePolicy == CachePolicy::Standard )
 				{
+					Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Miss );
 					result = HashProcess( p, plug, computeNode ).run();
 				}
 				else
@@ -279,20 +478,29 @@ class ValuePlug::HashProcess : public Process
 					}
 					if( cachedValue )
 					{
+						Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Hit );
 						result = *cachedValue;
 					}
 					else
 					{
+						Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Miss );
 						result = Process::acquireCollaborativeResult<HashProcess>( cacheKey, p, plug, computeNode );
 					}
 				}
 				// Update local cache and return result
-				threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
+				if( compact )
+				{
+					threadData.compactCache.set( compactKey, result );
+				}
+				else
+				{
+					threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
+				}
 				return result;
 			};
 
 			const HashCacheKey cacheKey( p, currentContext, p->m_dirtyCount );
-			if( g_hashCacheMode == HashCacheMode::Standard )
+			if( g_hashCacheMode == HashCacheMode::Standard || compact )
 			{
 				return acquireHash( cacheKey );
 			}
@@ -354,6 +562,7 @@ class ValuePlug::HashProcess : public Process
 					// Not thread-safe - caller is responsible for ensuring there
 					// are no concurrent computes.
 					it->cache.clear();
+					it->compactCache.clear();
 				}
 				else
 				{
@@ -372,14 +581,24 @@ class ValuePlug::HashProcess : public Process
 			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
 			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
 			{
-				usage += it->cache.currentCost();
+				usage += it->cache.currentCost() + it->compactCache.size();
 			}
 			return usage;
 		}
 
+		static size_t totalCacheEvictions()
+		{
+			size_t evictions = g_cache.evictions();
+			for( const auto &threadData : g_threadData )
+			{
+				evictions += threadData.cache.evictions() + threadData.compactCache.evictions();
+			}
+			return evictions;
+		}
+
 		static void dirtyLegacyCache()
 		{
-			if( g_hashCacheMode != HashCacheMode::Standard )
+			if( g_hashCacheMode != HashCacheMode::Standard && g_hashCacheMode != HashCacheMode::Compact )
 			{
 				uint64_t count = g_legacyGlobalDirtyCount;
 				uint64_t newCount;
@@ -458,6 +677,8 @@ class ValuePlug::HashProcess : public Process
 			ThreadData() : cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false ), clearCache( 0 ) {}
 			using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Serial>;
 			CacheType cache;
+			// Used instead of `cache` in `HashCacheMode::Compact`.
+			CompactHashCache compactCache;
 			// Flag to request that hashCache be cleared.
 			std::atomic_int clearCache;
 		};
@@ -486,6 +707,15 @@ class ValuePlug::ComputeProcess : public Process
 
 	public :
 
+		// Identifies an entry in the persistent cache. The signature
+		// identifies the node type and plug, so that we can avoid
+		// lookups for plugs that have never been expensive to compute.
+		struct PersistentCacheKey
+		{
+			IECore::MurmurHash hash;
+			IECore::MurmurHash signature;
+		};
+
 		// Interface used by ValuePlug.
 
 		static size_t getCacheMemoryLimit()
@@ -508,6 +738,33 @@ class ValuePlug::ComputeProcess : public Process
 			g_cache.clear();
 		}
 
+		static size_t cacheEvictions()
+		{
+			return g_cache.evictions();
+		}
+
+		static void setCacheEvictionPolicy( CacheEvictionPolicy policy )
+		{
+			g_cache.setEvictionPolicy(
+				policy == CacheEvictionPolicy::CostAware ? CacheType::EvictionPolicy::CostAware : CacheType::EvictionPolicy::LRU
+			);
+		}
+
+		static CacheEvictionPolicy getCacheEvictionPolicy()
+		{
+			return g_cache.getEvictionPolicy() == CacheType::EvictionPolicy::CostAware ? CacheEvictionPolicy::CostAware : CacheEvictionPolicy::LRU;
+		}
+
+		static void setPersistentCacheComputeThreshold( double seconds )
+		{
+			g_persistentCacheComputeThreshold = seconds;
+		}
+
+		static double getPersistentCacheComputeThreshold()
+		{
+			return g_persistentCacheComputeThreshold;
+		}
+
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
 		{
 			const ValuePlug *p = sourcePlug( plug );
@@ -569,27 +826,55 @@ class ValuePlug::ComputeProcess : public Process
 			// > calling `getValueInternal()`.
 			const IECore::MurmurHash hash = precomputedHash ? *precomputedHash : p->ValuePlug::hash();
 
-			if( !Process::forceMonitoring( threadState, plug, staticType ) )
+			const bool forceMonitoring = Process::forceMonitoring( threadState, plug, staticType );
+			if( !forceMonitoring )
 			{
 				if( auto result = g_cache.getIfCached( hash ) )
 				{
+					Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Hit );
 					// Move avoids unnecessary additional addRef/removeRef.
 					owner = std::move( *result );
 					return owner.get();
 				}
 			}
 
+			// The value isn't in memory, but it may have been stored in the
+			// persistent cache by a previous compute, either in this process
+			// or another. The persistent cache only goes to disk for plugs
+			// whose computes have previously been expensive enough to store,
+			// so the vast majority of misses remain cheap.
+
+			std::optional<PersistentCacheKey> persistentCacheKey;
+			if( computeNode && !forceMonitoring && g_persistentCache.enabled() )
+			{
+				persistentCacheKey = PersistentCacheKey{ hash, persistentCacheSignature( p, computeNode ) };
+				if( auto result = g_persistentCache.get( hash, persistentCacheKey->signature ) )
+				{
+					Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::PersistentHit );
+					storeInCache( threadState, p, hash, result, /* recomputeCost = */ 0 );
+					owner = std::move( result );
+					return owner.get();
+				}
+			}
+
 			// The value isn't in the cache, so we'll need to compute it,
 			// taking account of the cache policy.
 
-			if( cachePolicy == CachePolicy::Default )
+			Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Miss );
+
+			if( cachePolicy == CachePolicy::Default && !isPrefetching( hash ) )
 			{
 				// Do the compute ourselves, without worrying if the same
 				// compute is in flight elsewhere. We assume the compute is
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
-				// before it gets cached.
-				owner = ComputeProcess( p, plug, computeNode ).run();
+				// before it gets cached. The exception is values being
+				// prefetched, which are very likely to be shared with the
+				// `compute()` that requested them, so are computed
+				// collaboratively below.
+				const bool costAware = g_cache.getEvictionPolicy() == CacheType::EvictionPolicy::CostAware;
+				const auto startTime = costAware ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+				owner = ComputeProcess( p, plug, computeNode, persistentCacheKey ? &*persistentCacheKey : nullptr ).run();
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
 				// triggered by us to have already done the work, and calling
@@ -600,18 +885,51 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				const std::chrono::nanoseconds recomputeCost = costAware ? std::chrono::steady_clock::now() - startTime : std::chrono::nanoseconds( 0 );
+				storeInCache( threadState, p, hash, owner, recomputeCost.count() );
 				return owner.get();
 			}
 			else
 			{
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					hash, p, plug, computeNode, persistentCacheKey ? &*persistentCacheKey : nullptr
 				);
 				return owner.get();
 			}
 		}
 
+		static void values( const std::vector<const ValuePlug *> &plugs, const std::vector<const Context *> &contexts, std::vector<IECore::ConstObjectPtr> &values, const std::vector<IECore::MurmurHash> &precomputedHashes = {} )
+		{
+			if( contexts.size() && contexts.size() != plugs.size() )
+			{
+				throw IECore::Exception( fmt::format( "Expected {} contexts but got {}", plugs.size(), contexts.size() ) );
+			}
+			if( precomputedHashes.size() && precomputedHashes.size() != plugs.size() )
+			{
+				throw IECore::Exception( fmt::format( "Expected {} hashes but got {}", plugs.size(), precomputedHashes.size() ) );
+			}
+
+			const std::vector<Miss> misses = cachedValues( plugs, contexts, values, precomputedHashes );
+			computeMisses( plugs, contexts, misses, values );
+		}
+
+		static void storeInCache( const ThreadState &threadState, const ValuePlug *plug, const IECore::MurmurHash &hash, const IECore::ConstObjectPtr &value, size_t recomputeCost )
+		{
+			size_t cost = 0;
+			if(
+				g_cache.setIfUncached(
+					hash, value,
+					[&cost] ( const IECore::ConstObjectPtr &v ) {
+						return cost = cacheCostFunction( v );
+					},
+					recomputeCost
+				)
+			)
+			{
+				Process::cacheEvent( threadState, plug, staticType, Monitor::CacheEvent::Store, cost );
+			}
+		}
+
 		static void receiveResult( const ValuePlug *plug, IECore::ConstObjectPtr result )
 		{
 			const Process *process = Process::current();
@@ -633,8 +951,8 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, const PersistentCacheKey *persistentCacheKey = nullptr )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_persistentCacheKey( persistentCacheKey )
 		{
 		}
 
@@ -642,6 +960,7 @@ class ValuePlug::ComputeProcess : public Process
 		{
 			try
 			{
+				const auto startTime = std::chrono::steady_clock::now();
 				// Cast is safe because our constructor takes ValuePlugs.
 				const ValuePlug *valuePlug = static_cast<const ValuePlug *>( plug() );
 				if( const ValuePlug *input = valuePlug->getInput<ValuePlug>() )
@@ -657,7 +976,14 @@ class ValuePlug::ComputeProcess : public Process
 						throw IECore::Exception( "Plug has no ComputeNode." );
 					}
 					// Cast is ok - see comment above.
-					m_computeNode->compute( const_cast<ValuePlug *>( valuePlug ), context() );
+					if( ComputeNode::getPrefetchEnabled() )
+					{
+						computeWithPrefetch( const_cast<ValuePlug *>( valuePlug ) );
+					}
+					else
+					{
+						m_computeNode->compute( const_cast<ValuePlug *>( valuePlug ), context() );
+					}
 				}
 				// The calls above should cause setValue() to be called on the result plug, which in
 				// turn will call ValuePlug::setObjectValue(), which will then store the result in
@@ -667,6 +993,17 @@ class ValuePlug::ComputeProcess : public Process
 				{
 					throw IECore::Exception( "Compute did not set plug value." );
 				}
+				// If the compute was expensive, store the result in the persistent
+				// cache so that it can be reused after eviction from the in-memory
+				// cache, or by other processes.
+				if( m_persistentCacheKey )
+				{
+					const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+					if( duration.count() >= g_persistentCacheComputeThreshold )
+					{
+						g_persistentCache.set( m_persistentCacheKey->hash, m_persistentCacheKey->signature, m_result );
+					}
+				}
 				// Move to avoid unnecessary reference count increment/decrement - we don't
 				// need `m_result` any more.
 				return std::move( m_result );
@@ -686,17 +1023,289 @@ class ValuePlug::ComputeProcess : public Process
 			return v->memoryUsage();
 		}
 
+		static Private::PersistentCache g_persistentCache;
+
 	private :
 
+		// A value that `cachedValues()` couldn't find in the cache.
+		struct Miss
+		{
+			size_t index;
+			IECore::MurmurHash hash;
+			bool hashValid;
+		};
+
+		// First pass of `values()` : resolves static values, computes hashes and
+		// looks them up in the cache. This is all cheap enough to do serially,
+		// and saves us from launching tasks for the common case where everything
+		// is cached already. If `prefetching` is true, uncached values are
+		// ignored, since there is no way of sharing them with `compute()`.
+		static std::vector<Miss> cachedValues( const std::vector<const ValuePlug *> &plugs, const std::vector<const Context *> &contexts, std::vector<IECore::ConstObjectPtr> &values, const std::vector<IECore::MurmurHash> &precomputedHashes, bool prefetching = false )
+		{
+			values.resize( plugs.size() );
+			const ThreadState &threadState = ThreadState::current();
+
+			std::vector<Miss> misses;
+			for( size_t i = 0; i < plugs.size(); ++i )
+			{
+				Context::Scope contextScope( contexts.size() ? contexts[i] : nullptr );
+				const ValuePlug *p = sourcePlug( plugs[i] );
+
+				const ComputeNode *computeNode = nullptr;
+				if( !p->getInput() )
+				{
+					if( p->direction()==In || !(computeNode = IECore::runTimeCast<const ComputeNode>( p->node() )) )
+					{
+						values[i] = p->m_staticValue;
+						continue;
+					}
+				}
+
+				const CachePolicy cachePolicy = p->getInput() ? CachePolicy::Default : computeNode->computeCachePolicy( p );
+				if( cachePolicy == CachePolicy::Uncached )
+				{
+					if( !prefetching )
+					{
+						misses.push_back( { i, IECore::MurmurHash(), false } );
+					}
+					continue;
+				}
+
+				// See `value()` for why we call `ValuePlug::hash()` directly.
+				const IECore::MurmurHash hash = precomputedHashes.size() ? precomputedHashes[i] : p->ValuePlug::hash();
+				if( !Process::forceMonitoring( threadState, plugs[i], staticType ) )
+				{
+					if( auto result = g_cache.getIfCached( hash ) )
+					{
+						Process::cacheEvent( threadState, p, staticType, Monitor::CacheEvent::Hit );
+						values[i] = std::move( *result );
+						continue;
+					}
+				}
+
+				misses.push_back( { i, hash, true } );
+			}
+
+			return misses;
+		}
+
+		// Second pass of `values()` : computes everything that wasn't cached, in
+		// parallel. We reuse `value()` so that cache policies, collaboration and
+		// the persistent cache are all dealt with exactly as for a single
+		// `getValue()` call. If `prefetchContext` is provided, values are computed
+		// within it, so that cancelling it stops any further values from being
+		// started.
+		static void computeMisses( const std::vector<const ValuePlug *> &plugs, const std::vector<const Context *> &contexts, const std::vector<Miss> &misses, std::vector<IECore::ConstObjectPtr> &values, tbb::task_group_context *prefetchContext = nullptr )
+		{
+			const ThreadState &threadState = ThreadState::current();
+
+			auto computeMiss = [&] ( const Miss &miss ) {
+				if( prefetchContext && prefetchContext->is_group_execution_cancelled() )
+				{
+					return;
+				}
+				Context::Scope contextScope( contexts.size() ? contexts[miss.index] : nullptr );
+				IECore::ConstObjectPtr owner;
+				const IECore::Object *result = value( plugs[miss.index], owner, miss.hashValid ? &miss.hash : nullptr );
+				values[miss.index] = owner ? std::move( owner ) : IECore::ConstObjectPtr( result );
+			};
+
+			if( misses.empty() )
+			{
+				return;
+			}
+			else if( misses.size() == 1 )
+			{
+				computeMiss( misses.front() );
+				return;
+			}
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, misses.size(), 1 ),
+				[&] ( const tbb::blocked_range<size_t> &range ) {
+					ThreadState::Scope threadStateScope( threadState );
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						computeMiss( misses[i] );
+					}
+				},
+				prefetchContext ? *prefetchContext : taskGroupContext
+			);
+		}
+
+		// Hashes of the values currently being prefetched by `computeWithPrefetch()`,
+		// with a count of the prefetches that requested them. Values with the
+		// `Default` policy are computed collaboratively while they are registered
+		// here, so that `compute()` waits for an in-flight prefetch rather than
+		// duplicating its work. `g_numPrefetchedHashes` allows `value()` to skip
+		// the lookup entirely when nothing is being prefetched.
+		using PrefetchedHashes = tbb::concurrent_hash_map<IECore::MurmurHash, size_t>;
+		static PrefetchedHashes g_prefetchedHashes;
+		static std::atomic_size_t g_numPrefetchedHashes;
+
+		static bool isPrefetching( const IECore::MurmurHash &hash )
+		{
+			return g_numPrefetchedHashes.load() && g_prefetchedHashes.count( hash );
+		}
+
+		// Registers the hashes for `misses` in `g_prefetchedHashes` for
+		// the lifetime of the scope.
+		class PrefetchScope : boost::noncopyable
+		{
+
+			public :
+
+				PrefetchScope( const std::vector<Miss> &misses )
+					:	m_misses( misses )
+				{
+					g_numPrefetchedHashes += m_misses.size();
+					for( const auto &miss : m_misses )
+					{
+						PrefetchedHashes::accessor accessor;
+						g_prefetchedHashes.insert( accessor, miss.hash );
+						accessor->second++;
+					}
+				}
+
+				~PrefetchScope()
+				{
+					for( const auto &miss : m_misses )
+					{
+						PrefetchedHashes::accessor accessor;
+						if( g_prefetchedHashes.find( accessor, miss.hash ) && !--accessor->second )
+						{
+							g_prefetchedHashes.erase( accessor );
+						}
+					}
+					g_numPrefetchedHashes -= m_misses.size();
+				}
+
+			private :
+
+				const std::vector<Miss> &m_misses;
+
+		};
+
+		void computeWithPrefetch( ValuePlug *valuePlug ) const
+		{
+			ComputeNode::PrefetchRequests requests;
+			m_computeNode->prefetch( valuePlug, context(), requests );
+			if( requests.empty() )
+			{
+				m_computeNode->compute( valuePlug, context() );
+				return;
+			}
+
+			std::vector<const ValuePlug *> plugs; plugs.reserve( requests.size() );
+			std::vector<const Context *> contexts; contexts.reserve( requests.size() );
+			for( const auto &request : requests )
+			{
+				plugs.push_back( request.plug );
+				contexts.push_back( request.context.get() );
+			}
+
+			// Look up the requested values in the cache before launching
+			// anything, and register the misses as being prefetched. This must
+			// be done before `compute()` is called, so that whichever of the
+			// prefetch and `compute()` gets to a value first is guaranteed to
+			// be joined by the other. The hashes are cached, so `compute()` will
+			// not need to recompute them.
+			std::vector<IECore::ConstObjectPtr> prefetched;
+			std::vector<Miss> misses;
+			try
+			{
+				misses = cachedValues( plugs, contexts, prefetched, {}, /* prefetching = */ true );
+			}
+			catch( ... )
+			{
+				// Prefetching is speculative, so we ignore errors.
+				// If the values are really needed, the error will be
+				// rethrown when `compute()` requests them.
+			}
+
+			if( misses.empty() )
+			{
+				m_computeNode->compute( valuePlug, context() );
+				return;
+			}
+
+			PrefetchScope prefetchScope( misses );
+
+			// Launch the prefetch as a task that idle workers can pick up while
+			// we get on with the compute. We isolate so that waiting for the task
+			// can't cause us to steal unrelated work. The prefetch runs in its
+			// own context, which we cancel as soon as the compute is done, so
+			// that we only wait for values already in flight, rather than for
+			// the whole speculative batch. Cancelling the context doesn't cancel
+			// the in-flight computes themselves, because they may have been
+			// joined by other threads that need their results.
+			const ThreadState &threadState = ThreadState::current();
+			tbb::task_group_context prefetchContext( tbb::task_group_context::isolated );
+			tbb::this_task_arena::isolate(
+				[&] {
+					tbb::task_group taskGroup;
+					taskGroup.run(
+						[&] {
+							ThreadState::Scope threadStateScope( threadState );
+							try
+							{
+								computeMisses( plugs, contexts, misses, prefetched, &prefetchContext );
+							}
+							catch( ... )
+							{
+								// As above.
+							}
+						}
+					);
+
+					try
+					{
+						m_computeNode->compute( valuePlug, context() );
+					}
+					catch( ... )
+					{
+						prefetchContext.cancel_group_execution();
+						taskGroup.cancel();
+						taskGroup.wait();
+						throw;
+					}
+
+					// Anything the prefetch hasn't started yet has either been
+					// computed by `compute()` already, or wasn't needed after all,
+					// so there is no need to run it.
+					prefetchContext.cancel_group_execution();
+					taskGroup.cancel();
+					taskGroup.wait();
+				}
+			);
+		}
+
+		static IECore::MurmurHash persistentCacheSignature( const ValuePlug *plug, const ComputeNode *computeNode )
+		{
+			IECore::MurmurHash result;
+			result.append( computeNode->typeName() );
+			result.append( plug->relativeName( computeNode ) );
+			return result;
+		}
+
 		const ComputeNode *m_computeNode;
+		const PersistentCacheKey *m_persistentCacheKey;
 		IECore::ConstObjectPtr m_result;
 
+		static std::atomic<double> g_persistentCacheComputeThreshold;
+
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
 ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+// Note : The persistent cache is disabled until a directory is provided by `startup/Gaffer/cache.py`.
+Private::PersistentCache ValuePlug::ComputeProcess::g_persistentCache( size_t( 1024 ) * 1024 * 1024 * 10 ); // 10 gigs
+ValuePlug::ComputeProcess::PrefetchedHashes ValuePlug::ComputeProcess::g_prefetchedHashes;
+std::atomic_size_t ValuePlug::ComputeProcess::g_numPrefetchedHashes( 0 );
+std::atomic<double> ValuePlug::ComputeProcess::g_persistentCacheComputeThreshold( 0.1 );
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1042,6 +1651,11 @@ const IECore::Object *ValuePlug::getValueInternal( IECore::ConstObjectPtr &owner
 	return ComputeProcess::value( this, owner, precomputedHash );
 }
 
+void ValuePlug::getObjectValues( const std::vector<const ValuePlug *> &plugs, const std::vector<const Context *> &contexts, std::vector<IECore::ConstObjectPtr> &values, const std::vector<IECore::MurmurHash> &precomputedHashes )
+{
+	ComputeProcess::values( plugs, contexts, values, precomputedHashes );
+}
+
 void ValuePlug::setObjectValue( IECore::ConstObjectPtr value )
 {
 	bool haveInput = getInput();
@@ -1156,6 +1770,80 @@ void ValuePlug::clearCache()
 	ComputeProcess::clearCache();
 }
 
+size_t ValuePlug::cacheEvictions()
+{
+	return ComputeProcess::cacheEvictions();
+}
+
+void ValuePlug::setCacheEvictionPolicy( CacheEvictionPolicy policy )
+{
+	ComputeProcess::setCacheEvictionPolicy( policy );
+}
+
+ValuePlug::CacheEvictionPolicy ValuePlug::getCacheEvictionPolicy()
+{
+	return ComputeProcess::getCacheEvictionPolicy();
+}
+
+void ValuePlug::setPersistentCacheDirectory( const std::string &directory )
+{
+	ComputeProcess::g_persistentCache.setDirectory( directory );
+}
+
+std::string ValuePlug::getPersistentCacheDirectory()
+{
+	return ComputeProcess::g_persistentCache.getDirectory();
+}
+
+void ValuePlug::setPersistentCacheSizeLimit( size_t bytes )
+{
+	ComputeProcess::g_persistentCache.setMaxCost( bytes );
+}
+
+size_t ValuePlug::getPersistentCacheSizeLimit()
+{
+	return ComputeProcess::g_persistentCache.getMaxCost();
+}
+
+void ValuePlug::setPersistentCacheComputeThreshold( double seconds )
+{
+	ComputeProcess::setPersistentCacheComputeThreshold( seconds );
+}
+
+double ValuePlug::getPersistentCacheComputeThreshold()
+{
+	return ComputeProcess::getPersistentCacheComputeThreshold();
+}
+
+size_t ValuePlug::persistentCacheUsage()
+{
+	ComputeProcess::g_persistentCache.flush();
+	return ComputeProcess::g_persistentCache.currentCost();
+}
+
+void ValuePlug::clearPersistentCache()
+{
+	ComputeProcess::g_persistentCache.clear();
+}
+
+ValuePlug::PersistentCacheStatistics ValuePlug::persistentCacheStatistics()
+{
+	ComputeProcess::g_persistentCache.flush();
+	const Private::PersistentCache::Statistics s = ComputeProcess::g_persistentCache.statistics();
+	PersistentCacheStatistics result;
+	result.hits = s.hits;
+	result.misses = s.misses;
+	result.writes = s.writes;
+	result.failures = s.failures;
+	result.evictions = s.evictions;
+	return result;
+}
+
+void ValuePlug::resetPersistentCacheStatistics()
+{
+	ComputeProcess::g_persistentCache.resetStatistics();
+}
+
 size_t ValuePlug::getHashCacheSizeLimit()
 {
 	return HashProcess::getCacheSizeLimit();
@@ -1176,6 +1864,11 @@ size_t ValuePlug::hashCacheTotalUsage()
 	return HashProcess::totalCacheUsage();
 }
 
+size_t ValuePlug::hashCacheEvictions()
+{
+	return HashProcess::totalCacheEvictions();
+}
+
 void ValuePlug::setHashCacheMode( ValuePlug::HashCacheMode hashCacheMode )
 {
 	HashProcess::setHashCacheMode( hashCacheMode );
@@ -36,6 +36,7 @@
 
 #include "GafferImage/Blur.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/FilterAlgo.h"
 #include "GafferImage/Resample.h"
 
@@ -265,3 +266,52 @@ IECore::ConstFloatVectorDataPtr Blur::computeChannelData( const std::string &cha
 		return inPlug()->channelDataPlug()->getValue();
 	}
 }
+
+void Blur::prefetch( const Gaffer::ValuePlug *output, const Gaffer::Context *context, PrefetchRequests &requests ) const
+{
+	FlatImageProcessor::prefetch( output, context, requests );
+
+	if( output != outPlug()->channelDataPlug() )
+	{
+		return;
+	}
+
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) )
+	{
+		return;
+	}
+
+	// Declare the input tiles within the support of the filter. These will
+	// be needed by the internal Resample, which would otherwise only discover
+	// them once it gets around to populating its Sampler.
+
+	const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+	const V2i support( (int)ceilf( radius.x ) + 1, (int)ceilf( radius.y ) + 1 );
+
+	Box2i window;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		window = BufferAlgo::intersection(
+			Box2i( tileOrigin - support, tileOrigin + V2i( ImagePlug::tileSize() ) + support ),
+			inPlug()->dataWindowPlug()->getValue()
+		);
+	}
+
+	if( BufferAlgo::empty( window ) )
+	{
+		return;
+	}
+
+	const V2i minTileOrigin = ImagePlug::tileOrigin( window.min );
+	const V2i maxTileOrigin = ImagePlug::tileOrigin( window.max - V2i( 1 ) );
+	for( int y = minTileOrigin.y; y <= maxTileOrigin.y; y += ImagePlug::tileSize() )
+	{
+		for( int x = minTileOrigin.x; x <= maxTileOrigin.x; x += ImagePlug::tileSize() )
+		{
+			ContextPtr tileContext = new Context( *context );
+			tileContext->set( ImagePlug::tileOriginContextName, V2i( x, y ) );
+			requests.push_back( { inPlug()->channelDataPlug(), tileContext } );
+		}
+	}
+}
@@ -157,6 +157,7 @@ void ColorProcessor::affects( const Gaffer::Plug *input, AffectedPlugsContainer
 	if(
 		input == inPlug()->channelDataPlug() ||
 		input == inPlug()->channelNamesPlug() ||
+		input == channelsPlug() ||
 		input == processUnpremultipliedPlug() ||
 		input == colorProcessorPlug()
 	)
@@ -184,18 +185,24 @@ void ColorProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Contex
 	}
 	else if( output == colorDataPlug() )
 	{
+		const string &layerName = context->get<string>( g_layerNameKey );
+
 		ConstStringVectorDataPtr channelNamesData;
 		bool unpremult;
+		const ImagePlug *fusedInPlug;
 		{
 			ImagePlug::GlobalScope globalScope( context );
-			channelNamesData = inPlug()->channelNamesPlug()->getValue();
+			vector<const ColorProcessor *> processors;
+			fusedInPlug = fusedChain( layerName, processors );
+			channelNamesData = fusedInPlug->channelNamesPlug()->getValue();
 			unpremult = processUnpremultipliedPlug()->getValue();
-			colorProcessorPlug()->hash( h );
+			for( const auto &processor : processors )
+			{
+				processor->colorProcessorPlug()->hash( h );
+			}
 		}
 		const vector<string> &channelNames = channelNamesData->readable();
 
-		const string &layerName = context->get<string>( g_layerNameKey );
-
 		ImagePlug::ChannelDataScope channelDataScope( context );
 		for( const auto &baseName : { "R", "G", "B" } )
 		{
@@ -203,7 +210,7 @@ void ColorProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Contex
 			if( ImageAlgo::channelExists( channelNames, channelName ) )
 			{
 				channelDataScope.setChannelName( &channelName );
-				inPlug()->channelDataPlug()->hash( h );
+				fusedInPlug->channelDataPlug()->hash( h );
 			}
 			else
 			{
@@ -214,7 +221,7 @@ void ColorProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Contex
 		if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
 		{
 			channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-			inPlug()->channelDataPlug()->hash( h );
+			fusedInPlug->channelDataPlug()->hash( h );
 		}
 	}
 }
@@ -230,19 +237,29 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	}
 	else if( output == colorDataPlug() )
 	{
+		const string &layerName = context->get<string>( g_layerNameKey );
+
 		ConstStringVectorDataPtr channelNamesData;
-		ConstColorProcessorDataPtr colorProcessorData;
+		vector<ConstColorProcessorDataPtr> colorProcessorDatas;
 		bool unpremult;
+		const ImagePlug *fusedInPlug;
 		{
 			ImagePlug::GlobalScope globalScope( context );
-			channelNamesData = inPlug()->channelNamesPlug()->getValue();
+			vector<const ColorProcessor *> processors;
+			fusedInPlug = fusedChain( layerName, processors );
+			channelNamesData = fusedInPlug->channelNamesPlug()->getValue();
 			unpremult = processUnpremultipliedPlug()->getValue();
-			colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
+			// Reverse iteration, so that `colorProcessorDatas` is in
+			// the order the processors need to be applied in.
+			for( auto it = processors.rbegin(); it != processors.rend(); ++it )
+			{
+				colorProcessorDatas.push_back(
+					boost::static_pointer_cast<const ColorProcessorData>( (*it)->colorProcessorPlug()->getValue() )
+				);
+			}
 		}
 		const vector<string> &channelNames = channelNamesData->readable();
 
-		const string &layerName = context->get<string>( g_layerNameKey );
-
 		FloatVectorDataPtr rgb[3];
 		ConstFloatVectorDataPtr alpha;
 		int samples = -1;
@@ -252,7 +269,7 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 			if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
 			{
 				channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-				alpha = inPlug()->channelDataPlug()->getValue();
+				alpha = fusedInPlug->channelDataPlug()->getValue();
 			}
 
 			int i = 0;
@@ -262,7 +279,7 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 				if( ImageAlgo::channelExists( channelNames, channelName ) )
 				{
 					channelDataScope.setChannelName( &channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
+					rgb[i] = fusedInPlug->channelDataPlug()->getValue()->copy();
 
 					samples = rgb[i]->readable().size();
 
@@ -304,7 +321,13 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 		}
 
-		colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+		for( const auto &colorProcessorData : colorProcessorDatas )
+		{
+			if( colorProcessorData->colorProcessor )
+			{
+				colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+			}
+		}
 
 		if( unpremult && alpha )
 		{
@@ -340,6 +363,66 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	ImageProcessor::compute( output, context );
 }
 
+const ImagePlug *ColorProcessor::fusedChain( const std::string &layerName, std::vector<const ColorProcessor *> &processors ) const
+{
+	processors.push_back( this );
+
+	const std::string channels = channelsPlug()->getValue();
+	const bool unpremult = processUnpremultipliedPlug()->getValue();
+
+	const ImagePlug *result = inPlug();
+
+	// Each node in the chain only outputs the channels it processes, passing
+	// the others through from its input, and substitutes black for missing
+	// channels without outputting them. Fusing is therefore only equivalent
+	// if every node processes all of R, G and B, and they all exist. Since
+	// ColorProcessors don't modify channel names, checking our own input
+	// suffices for the whole chain.
+	ConstStringVectorDataPtr channelNamesData = inPlug()->channelNamesPlug()->getValue();
+	for( const auto &baseName : { "R", "G", "B" } )
+	{
+		const string channelName = ImageAlgo::channelName( layerName, baseName );
+		if(
+			!ImageAlgo::channelExists( channelNamesData->readable(), channelName ) ||
+			!StringAlgo::matchMultiple( channelName, channels )
+		)
+		{
+			return result;
+		}
+	}
+
+	while( true )
+	{
+		// We can only fuse with an upstream ColorProcessor if it is directly
+		// providing our input, and it processes exactly the same channels in the
+		// same way. Since there are no intermediate nodes, the upstream node's
+		// plugs will be evaluated in the same context as ours.
+		const ImagePlug *source = result->channelDataPlug()->source()->parent<ImagePlug>();
+		const ColorProcessor *upstream = source ? runTimeCast<const ColorProcessor>( source->node() ) : nullptr;
+		if( !upstream || source != upstream->outPlug() )
+		{
+			break;
+		}
+
+		if( upstream->enabled() )
+		{
+			if(
+				upstream->channelsPlug()->getValue() != channels ||
+				upstream->processUnpremultipliedPlug()->getValue() != unpremult
+			)
+			{
+				break;
+			}
+			processors.push_back( upstream );
+		}
+		// Else upstream is passing through its input, and we can skip it.
+
+		result = upstream->inPlug();
+	}
+
+	return result;
+}
+
 Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer::ValuePlug *output ) const
 {
 	if( output == outPlug()->channelDataPlug() )
@@ -452,6 +452,21 @@ void ImageReader::compute( ValuePlug *output, const Context *context ) const
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy ImageReader::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		// Our channel data is just a redirect to the intermediate image. When
+		// the colour space conversion is a no-op, or for auxiliary channels, that
+		// is the OpenImageIOReader output, which converts tiles to float on demand
+		// from its cached native format. Caching here would store the float copy
+		// too, undoing the saving. When a conversion is applied, the converted data
+		// is already cached by the ColorSpace node.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageNode::computeCachePolicy( output );
+}
+
 void ImageReader::hashViewNames( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FrameMaskScope scope( context, this, /* clampBlack = */ true );
@@ -44,7 +44,14 @@
 #include "IECore/BoxOps.h"
 
 #include "fmt/format.h"
+
 #include <limits>
+#include <type_traits>
+
+#if defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define MERGE_HAVE_AVX2
+#include <immintrin.h>
+#endif
 
 using namespace std;
 using namespace Imath;
@@ -62,15 +69,126 @@ enum SingleInputMode
 	Copy
 };
 
+#ifdef MERGE_HAVE_AVX2
+
+// Types used to implement `operate()` for eight pixels at a time using AVX2.
+// They are chosen so that we get bit-identical results to the scalar
+// implementations :
+//
+// - Float8 is used by operations that use only float arithmetic.
+// - Double8 is used by operations that mix float and double arithmetic.
+//   Arithmetic on two floats gives the same result whether it is done in
+//   float, or in double and then rounded to float, so the only place we need
+//   to be careful is where a scalar implementation rounds an intermediate
+//   result to float. We use `roundToFloat()` for that.
+
+struct Float8
+{
+	__attribute__(( target( "avx2" ) )) static Float8 load( const float *f )
+	{
+		return { _mm256_loadu_ps( f ) };
+	}
+
+	__attribute__(( target( "avx2" ) )) void store( float *f ) const
+	{
+		_mm256_storeu_ps( f, v );
+	}
+
+	__m256 v;
+};
+
+__attribute__(( target( "avx2" ) )) inline Float8 roundToFloat( const Float8 &x )
+{
+	return x;
+}
+
+__attribute__(( target( "avx2" ) )) inline Float8 operator + ( const Float8 &x, const Float8 &y )
+{
+	return { _mm256_add_ps( x.v, y.v ) };
+}
+
+__attribute__(( target( "avx2" ) )) inline Float8 operator - ( const Float8 &x, const Float8 &y )
+{
+	return { _mm256_sub_ps( x.v, y.v ) };
+}
+
+__attribute__(( target( "avx2" ) )) inline Float8 operator * ( const Float8 &x, const Float8 &y )
+{
+	return { _mm256_mul_ps( x.v, y.v ) };
+}
+
+// Matches `std::min( x, y )`, including for NaNs and signed zeros.
+__attribute__(( target( "avx2" ) )) inline Float8 min( const Float8 &x, const Float8 &y )
+{
+	return { _mm256_min_ps( y.v, x.v ) };
+}
+
+// Matches `std::max( x, y )`, including for NaNs and signed zeros.
+__attribute__(( target( "avx2" ) )) inline Float8 max( const Float8 &x, const Float8 &y )
+{
+	return { _mm256_max_ps( y.v, x.v ) };
+}
+
+struct Double8
+{
+	__attribute__(( target( "avx2" ) )) static Double8 load( const float *f )
+	{
+		const __m256 v = _mm256_loadu_ps( f );
+		return { _mm256_cvtps_pd( _mm256_castps256_ps128( v ) ), _mm256_cvtps_pd( _mm256_extractf128_ps( v, 1 ) ) };
+	}
+
+	__attribute__(( target( "avx2" ) )) void store( float *f ) const
+	{
+		const __m256 r = _mm256_castps128_ps256( _mm256_cvtpd_ps( lo ) );
+		_mm256_storeu_ps( f, _mm256_insertf128_ps( r, _mm256_cvtpd_ps( hi ), 1 ) );
+	}
+
+	__m256d lo;
+	__m256d hi;
+};
+
+__attribute__(( target( "avx2" ) )) inline Double8 roundToFloat( const Double8 &x )
+{
+	return { _mm256_cvtps_pd( _mm256_cvtpd_ps( x.lo ) ), _mm256_cvtps_pd( _mm256_cvtpd_ps( x.hi ) ) };
+}
+
+__attribute__(( target( "avx2" ) )) inline Double8 operator + ( const Double8 &x, const Double8 &y )
+{
+	return { _mm256_add_pd( x.lo, y.lo ), _mm256_add_pd( x.hi, y.hi ) };
+}
+
+__attribute__(( target( "avx2" ) )) inline Double8 operator - ( double x, const Double8 &y )
+{
+	const __m256d xx = _mm256_set1_pd( x );
+	return { _mm256_sub_pd( xx, y.lo ), _mm256_sub_pd( xx, y.hi ) };
+}
+
+__attribute__(( target( "avx2" ) )) inline Double8 operator * ( const Double8 &x, const Double8 &y )
+{
+	return { _mm256_mul_pd( x.lo, y.lo ), _mm256_mul_pd( x.hi, y.hi ) };
+}
+
+#define MERGE_AVX2_OPERATE( TYPE, EXPRESSION ) \
+	using AVX2Type = TYPE; \
+	__attribute__(( target( "avx2" ) )) static TYPE operate( const TYPE &A, const TYPE &B, const TYPE &a, const TYPE &b ){ return EXPRESSION; }
+
+#else
+
+#define MERGE_AVX2_OPERATE( TYPE, EXPRESSION )
+
+#endif // MERGE_HAVE_AVX2
+
 struct OpAdd
 {
 	static float operate( float A, float B, float a, float b){ return A + B; }
+	MERGE_AVX2_OPERATE( Float8, A + B )
 	static const SingleInputMode onlyA = Copy;
 	static const SingleInputMode onlyB = Copy;
 };
 struct OpAtop
 {
 	static float operate( float A, float B, float a, float b){ return A*b + B*(1.-a); }
+	MERGE_AVX2_OPERATE( Double8, roundToFloat( A*b ) + B*(1.-a) )
 	static const SingleInputMode onlyA = Black;
 	static const SingleInputMode onlyB = Copy;
 };
@@ -105,42 +223,49 @@ struct OpDivide
 struct OpIn
 {
 	static float operate( float A, float B, float a, float b){ return A*b; }
+	MERGE_AVX2_OPERATE( Float8, A*b )
 	static const SingleInputMode onlyA = Black;
 	static const SingleInputMode onlyB = Black;
 };
 struct OpOut
 {
 	static float operate( float A, float B, float a, float b){ return A*(1.-b); }
+	MERGE_AVX2_OPERATE( Double8, A*(1.-b) )
 	static const SingleInputMode onlyA = Copy;
 	static const SingleInputMode onlyB = Black;
 };
 struct OpMask
 {
 	static float operate( float A, float B, float a, float b){ return B*a; }
+	MERGE_AVX2_OPERATE( Float8, B*a )
 	static const SingleInputMode onlyA = Black;
 	static const SingleInputMode onlyB = Black;
 };
 struct OpMatte
 {
 	static float operate( float A, float B, float a, float b){ return A*a + B*(1.-a); }
+	MERGE_AVX2_OPERATE( Double8, roundToFloat( A*a ) + B*(1.-a) )
 	static const SingleInputMode onlyA = Operate;
 	static const SingleInputMode onlyB = Copy;
 };
 struct OpMultiply
 {
 	static float operate( float A, float B, float a, float b){ return A * B; }
+	MERGE_AVX2_OPERATE( Float8, A * B )
 	static const SingleInputMode onlyA = Black;
 	static const SingleInputMode onlyB = Black;
 };
 struct OpOver
 {
 	static float operate( float A, float B, float a, float b){ return A + B*(1.-a); }
+	MERGE_AVX2_OPERATE( Double8, A + B*(1.-a) )
 	static const SingleInputMode onlyA = Copy;
 	static const SingleInputMode onlyB = Copy;
 };
 struct OpSubtract
 {
 	static float operate( float A, float B, float a, float b){ return A - B; }
+	MERGE_AVX2_OPERATE( Float8, A - B )
 	static const SingleInputMode onlyA = Copy;
 	static const SingleInputMode onlyB = Operate;
 };
@@ -165,18 +290,21 @@ struct OpDifference
 struct OpUnder
 {
 	static float operate( float A, float B, float a, float b){ return A*(1.-b) + B; }
+	MERGE_AVX2_OPERATE( Double8, A*(1.-b) + B )
 	static const SingleInputMode onlyA = Copy;
 	static const SingleInputMode onlyB = Copy;
 };
 struct OpMin
 {
 	static float operate( float A, float B, float a, float b){ return std::min( A, B ); }
+	MERGE_AVX2_OPERATE( Float8, min( A, B ) )
 	static const SingleInputMode onlyA = Operate;
 	static const SingleInputMode onlyB = Operate;
 };
 struct OpMax
 {
 	static float operate( float A, float B, float a, float b){ return std::max( A, B ); }
+	MERGE_AVX2_OPERATE( Float8, max( A, B ) )
 	static const SingleInputMode onlyA = Operate;
 	static const SingleInputMode onlyB = Operate;
 };
@@ -303,6 +431,112 @@ inline MergeRegion tileRegion( int i, const Box2i &boundA, const Box2i &boundB,
 	return (MergeRegion)(( InsideA * inA ) | ( InsideB * inB ));
 }
 
+// Kernels for applying `Op::operate()` to a run of pixels which are inside the
+// data windows of all inputs. The inputs are merged in order, with `channels[0]`
+// and `alphas[0]` being the base layer, giving the same result as merging them
+// pairwise. The outputs `R` and `r` may alias `channels[0]` and `alphas[0]`.
+using MergeKernel = void (*)( const float *const *channels, const float *const *alphas, int numInputs, float *R, float *r, int begin, int end );
+
+template<typename Op>
+void mergeScalar( const float *const *channels, const float *const *alphas, int numInputs, float *R, float *r, int begin, int end )
+{
+	if( numInputs == 2 )
+	{
+		// Common case of a single pair of inputs, where we can compute the result
+		// in one pass without first copying B into the result.
+		const float *A = channels[1];
+		const float *a = alphas[1];
+		const float *B = channels[0];
+		const float *b = alphas[0];
+		for( int j = begin; j < end; ++j )
+		{
+			R[j] = Op::operate( A[j], B[j], a[j], b[j] );
+			r[j] = Op::operate( a[j], b[j], a[j], b[j] );
+		}
+		return;
+	}
+
+	// We work through the pixels in blocks, so that the accumulated result stays
+	// in the cache while we loop over the inputs.
+	const int blockSize = 256;
+	for( int blockBegin = begin; blockBegin < end; blockBegin += blockSize )
+	{
+		const int blockEnd = std::min( blockBegin + blockSize, end );
+		if( R != channels[0] )
+		{
+			std::copy( channels[0] + blockBegin, channels[0] + blockEnd, R + blockBegin );
+			std::copy( alphas[0] + blockBegin, alphas[0] + blockEnd, r + blockBegin );
+		}
+
+		for( int k = 1; k < numInputs; ++k )
+		{
+			const float *A = channels[k];
+			const float *a = alphas[k];
+			for( int j = blockBegin; j < blockEnd; ++j )
+			{
+				const float b = r[j];
+				R[j] = Op::operate( A[j], R[j], a[j], b );
+				r[j] = Op::operate( a[j], b, a[j], b );
+			}
+		}
+	}
+}
+
+#ifdef MERGE_HAVE_AVX2
+
+template<typename Op, typename = void>
+struct HasAVX2Operate : std::false_type {};
+
+template<typename Op>
+struct HasAVX2Operate<Op, std::void_t<typename Op::AVX2Type>> : std::true_type {};
+
+template<typename Op>
+__attribute__(( target( "avx2" ) )) void mergeAVX2( const float *const *channels, const float *const *alphas, int numInputs, float *R, float *r, int begin, int end )
+{
+	using Type = typename Op::AVX2Type;
+
+	int j = begin;
+	for( ; j + 8 <= end; j += 8 )
+	{
+		Type B = Type::load( channels[0] + j );
+		Type b = Type::load( alphas[0] + j );
+		for( int k = 1; k < numInputs; ++k )
+		{
+			const Type A = Type::load( channels[k] + j );
+			const Type a = Type::load( alphas[k] + j );
+			// Round to float after each input, as would happen
+			// if we stored the result and merged pairwise.
+			const Type resultB = roundToFloat( Op::operate( A, B, a, b ) );
+			b = roundToFloat( Op::operate( a, b, a, b ) );
+			B = resultB;
+		}
+		B.store( R + j );
+		b.store( r + j );
+	}
+
+	mergeScalar<Op>( channels, alphas, numInputs, R, r, j, end );
+}
+
+#endif // MERGE_HAVE_AVX2
+
+template<typename Op>
+MergeKernel mergeKernel()
+{
+	static const MergeKernel g_kernel = [] () -> MergeKernel {
+#ifdef MERGE_HAVE_AVX2
+		if constexpr( HasAVX2Operate<Op>::value )
+		{
+			if( __builtin_cpu_supports( "avx2" ) )
+			{
+				return mergeAVX2<Op>;
+			}
+		}
+#endif
+		return mergeScalar<Op>;
+	}();
+	return g_kernel;
+}
+
 struct MergeFunctor
 {
 	using ReturnType = void;
@@ -497,14 +731,12 @@ struct MergeFunctor
 			else
 			{
 				// Within both data windows, this is when we actually need to run the full operate()
-				for( int j = 0; j < length; j++ )
-				{
-					*R = Op::operate( *A, *B, *a, *b );
-					*r = Op::operate( *a, *b, *a, *b );
-					++A; ++a;
-					++B; ++b;
-					++R; ++r;
-				}
+				const float *channels[2] = { B, A };
+				const float *alphas[2] = { b, a };
+				mergeKernel<Op>()( channels, alphas, 2, R, r, 0, length );
+				A += length; a += length;
+				B += length; b += length;
+				R += length; r += length;
 			}
 			i += length;
 		}
@@ -516,6 +748,30 @@ struct MergeFunctor
 
 };
 
+struct SinglePassMergeFunctor
+{
+	using ReturnType = FloatVectorDataPtr;
+
+	// Merges all inputs at once, for use when every input covers the whole tile.
+	// Returns the merged channel data.
+	template< class Op >
+	ReturnType operator()( const std::vector<const float *> &channels, const std::vector<const float *> &alphas )
+	{
+		FloatVectorDataPtr mergeChannelBuffer = new FloatVectorData();
+		FloatVectorDataPtr mergeAlphaBuffer = new FloatVectorData();
+		mergeChannelBuffer->writable().resize( ImagePlug::tilePixels() );
+		mergeAlphaBuffer->writable().resize( ImagePlug::tilePixels() );
+
+		mergeKernel<Op>()(
+			channels.data(), alphas.data(), (int)channels.size(),
+			mergeChannelBuffer->writable().data(), mergeAlphaBuffer->writable().data(),
+			0, ImagePlug::tilePixels()
+		);
+
+		return mergeChannelBuffer;
+	}
+};
+
 struct PassthroughHashFunctor
 {
 	using ReturnType = void;
@@ -916,7 +1172,13 @@ IECore::ConstFloatVectorDataPtr Merge::computeChannelData( const std::string &ch
 		finalTileDataWindowLocal = boxIntersection( fullBound, finalDataWindowLocal );
 	}
 
-	bool partialBound = false;
+	struct Input
+	{
+		Box2i validBound;
+		ConstFloatVectorDataPtr channelData;
+		ConstFloatVectorDataPtr alphaData;
+	};
+	std::vector<Input> inputs;
 
 	for( ImagePlug::Iterator it( inPlugs() ); !it.done(); ++it )
 	{
@@ -973,6 +1235,45 @@ IECore::ConstFloatVectorDataPtr Merge::computeChannelData( const std::string &ch
 			throw IECore::Exception( "Merge::computeChannelData : Cannot process deep data." );
 		}
 
+		inputs.push_back( { validBound, channelData, alphaData } );
+	}
+
+	// If every input covers the whole tile, then there are no pass-throughs or
+	// partial regions to deal with, and we can merge all the inputs in a single
+	// pass. This gives the same result as merging pairwise below, but avoids
+	// writing and rereading the intermediate result for every input.
+	if( inputs.size() > 2 )
+	{
+		const Box2i fullBound( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
+		std::vector<const float *> channels;
+		std::vector<const float *> alphas;
+		for( const auto &input : inputs )
+		{
+			if(
+				input.validBound != fullBound ||
+				( input.channelData == ImagePlug::blackTile() && input.alphaData == ImagePlug::blackTile() )
+			)
+			{
+				break;
+			}
+			channels.push_back( input.channelData->readable().data() );
+			alphas.push_back( input.alphaData->readable().data() );
+		}
+
+		if( channels.size() == inputs.size() )
+		{
+			return dispatchOperation( op, SinglePassMergeFunctor(), channels, alphas );
+		}
+	}
+
+	bool partialBound = false;
+
+	for( const auto &input : inputs )
+	{
+		const Box2i &validBound = input.validBound;
+		const ConstFloatVectorDataPtr &channelData = input.channelData;
+		const ConstFloatVectorDataPtr &alphaData = input.alphaData;
+
 		partialBound |= !BufferAlgo::empty( validBound ) && validBound != finalTileDataWindowLocal;
 
 		// MergeFunctor contains all the complexity, we just pass in the bounds and channel data,
@@ -53,6 +53,7 @@
 #include "IECore/FileSequence.h"
 #include "IECore/FileSequenceFunctions.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imagecache.h"
 #include "OpenImageIO/deepdata.h"
@@ -488,6 +489,87 @@ void blitOIIORectToTileBatch(
 	}
 }
 
+// Returns the type that tiles read from `spec` can be stored in without
+// loss, or `TypeDesc::UNKNOWN` if they must be stored as float. Tile batches
+// are what hold the cached data for the reader, so storing them in the native
+// format uses 2-4x less memory for half and 8 or 16 bit integer images. Tiles
+// are converted to float on demand in `computeChannelData()`.
+TypeDesc compactStorageType( const ImageSpec &spec )
+{
+	if( spec.deep || spec.channelformats.size() )
+	{
+		return TypeDesc::UNKNOWN;
+	}
+
+	if( spec.format == TypeDesc::HALF )
+	{
+		return TypeDesc::HALF;
+	}
+
+	if( ( spec.format == TypeDesc::UINT8 || spec.format == TypeDesc::UINT16 ) && spec.alpha_channel < 0 )
+	{
+		// OIIO premultiplies by alpha when converting unassociated integer
+		// data to float, after which the values are no longer exactly
+		// representable as integers. So we only do this when there is no alpha.
+		return spec.format;
+	}
+
+	return TypeDesc::UNKNOWN;
+}
+
+template<typename T>
+IECore::ObjectPtr compactTile( const std::vector<float> &tile, TypeDesc type )
+{
+	using DataType = IECore::TypedData<std::vector<T>>;
+	typename DataType::Ptr result = new DataType;
+	result->writable().resize( tile.size() );
+	OIIO::convert_pixel_values( TypeDesc::FLOAT, tile.data(), type, result->writable().data(), tile.size() );
+	return result;
+}
+
+IECore::ObjectPtr compactTile( const std::vector<float> &tile, TypeDesc type )
+{
+	if( type == TypeDesc::HALF )
+	{
+		return compactTile<half>( tile, type );
+	}
+	else if( type == TypeDesc::UINT8 )
+	{
+		return compactTile<unsigned char>( tile, type );
+	}
+	else
+	{
+		assert( type == TypeDesc::UINT16 );
+		return compactTile<unsigned short>( tile, type );
+	}
+}
+
+template<typename T>
+IECore::ConstFloatVectorDataPtr expandTile( const std::vector<T> &tile, TypeDesc type )
+{
+	FloatVectorDataPtr result = new FloatVectorData;
+	podVectorResizeUninitialized<float>( result->writable(), tile.size() );
+	OIIO::convert_pixel_values( type, tile.data(), TypeDesc::FLOAT, result->writable().data(), tile.size() );
+	return result;
+}
+
+IECore::ConstFloatVectorDataPtr expandTile( const IECore::Object *tile )
+{
+	switch( tile->typeId() )
+	{
+		case FloatVectorDataTypeId :
+			return static_cast<const FloatVectorData *>( tile );
+		case HalfVectorDataTypeId :
+			return expandTile( static_cast<const HalfVectorData *>( tile )->readable(), TypeDesc::HALF );
+		case UCharVectorDataTypeId :
+			return expandTile( static_cast<const UCharVectorData *>( tile )->readable(), TypeDesc::UINT8 );
+		case UShortVectorDataTypeId :
+			return expandTile( static_cast<const UShortVectorData *>( tile )->readable(), TypeDesc::UINT16 );
+		default :
+			throw IECore::Exception( fmt::format( "OpenImageIOReader : Unexpected tile type \"{}\"", tile->typeName() ) );
+	}
+}
+
 void blitOIIOSampleCountsToTileBatch(
 	const OIIO::DeepData &deepData, const Box2i &rect,
 	const V2i &tileBatchSize, const V3i &tileBatchOrigin, std::vector< int* > &tilePointers
@@ -1276,6 +1358,32 @@ class File
 
 			}
 
+			const TypeDesc storageType = compactStorageType( spec );
+			if( storageType != TypeDesc::UNKNOWN )
+			{
+				// Convert to native format for storage. This is lossless because
+				// the float values were themselves converted from the native format.
+				tbb::parallel_for(
+					tbb::blocked_range<int>( 0, tileBatchNumTileChannels ),
+					[&] ( const tbb::blocked_range<int> &range )
+					{
+						for( int i = range.begin(); i < range.end(); i++ )
+						{
+							if( !tileChannelPointers[i] )
+							{
+								// Shared black tile.
+								continue;
+							}
+							resultChannels->members()[i] = compactTile(
+								static_cast<const FloatVectorData *>( resultChannels->members()[i].get() )->readable(),
+								storageType
+							);
+						}
+					},
+					taskGroupContext
+				);
+			}
+
 			ObjectVectorPtr result = new ObjectVector();
 			result->members().resize( 2 );
 			result->members()[0] = resultChannels;
@@ -2235,7 +2343,10 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 			tileBatch->members()[0]
 	)->members()[ subIndex ];
 
-	return IECore::runTimeCast< const FloatVectorData >( curTileChannel );
+	// Tiles may be stored in a compact native format, in which
+	// case we convert them here. This is cheap enough that we don't
+	// need to cache the result.
+	return expandTile( curTileChannel.get() );
 }
 
 void OpenImageIOReader::plugSet( Gaffer::Plug *plug )
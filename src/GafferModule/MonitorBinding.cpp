@@ -38,6 +38,7 @@
 
 #include "MonitorBinding.h"
 
+#include "Gaffer/CacheMonitor.h"
 #include "Gaffer/ContextMonitor.h"
 #include "Gaffer/Monitor.h"
 #include "Gaffer/MonitorAlgo.h"
@@ -45,6 +46,7 @@
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TraceMonitor.h"
 #include "Gaffer/VTuneMonitor.h"
 
 #include "IECorePython/RefCountedBinding.h"
@@ -64,8 +66,9 @@ namespace
 std::string repr( PerformanceMonitor::Statistics &s )
 {
 	return fmt::format(
-		"Gaffer.PerformanceMonitor.Statistics( hashCount = {}, computeCount = {}, hashDuration = {}, computeDuration = {} )",
-			s.hashCount, s.computeCount, s.hashDuration.count(), s.computeDuration.count()
+		"Gaffer.PerformanceMonitor.Statistics( hashCount = {}, computeCount = {}, hashDuration = {}, computeDuration = {}, collaborativeWaitCount = {}, collaborativeWorkCount = {}, collaborativeWaitDuration = {}, collaborativeIdleDuration = {} )",
+			s.hashCount, s.computeCount, s.hashDuration.count(), s.computeDuration.count(),
+			s.collaborativeWaitCount, s.collaborativeWorkCount, s.collaborativeWaitDuration.count(), s.collaborativeIdleDuration.count()
 	);
 }
 
@@ -73,10 +76,18 @@ PerformanceMonitor::Statistics *statisticsConstructor(
 	size_t hashCount,
 	size_t computeCount,
 	boost::chrono::nanoseconds::rep hashDuration,
-	boost::chrono::nanoseconds::rep computeDuration
+	boost::chrono::nanoseconds::rep computeDuration,
+	size_t collaborativeWaitCount,
+	size_t collaborativeWorkCount,
+	boost::chrono::nanoseconds::rep collaborativeWaitDuration,
+	boost::chrono::nanoseconds::rep collaborativeIdleDuration
 )
 {
-	return new PerformanceMonitor::Statistics( hashCount, computeCount, boost::chrono::nanoseconds( hashDuration ), boost::chrono::nanoseconds( computeDuration ) );
+	return new PerformanceMonitor::Statistics(
+		hashCount, computeCount, boost::chrono::nanoseconds( hashDuration ), boost::chrono::nanoseconds( computeDuration ),
+		collaborativeWaitCount, collaborativeWorkCount,
+		boost::chrono::nanoseconds( collaborativeWaitDuration ), boost::chrono::nanoseconds( collaborativeIdleDuration )
+	);
 }
 
 boost::chrono::nanoseconds::rep getHashDuration( PerformanceMonitor::Statistics &s )
@@ -99,6 +110,26 @@ void setComputeDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanos
 	s.computeDuration = boost::chrono::nanoseconds( v );
 }
 
+boost::chrono::nanoseconds::rep getCollaborativeWaitDuration( PerformanceMonitor::Statistics &s )
+{
+	return s.collaborativeWaitDuration.count();
+}
+
+void setCollaborativeWaitDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanoseconds::rep v )
+{
+	s.collaborativeWaitDuration = boost::chrono::nanoseconds( v );
+}
+
+boost::chrono::nanoseconds::rep getCollaborativeIdleDuration( PerformanceMonitor::Statistics &s )
+{
+	return s.collaborativeIdleDuration.count();
+}
+
+void setCollaborativeIdleDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanoseconds::rep v )
+{
+	s.collaborativeIdleDuration = boost::chrono::nanoseconds( v );
+}
+
 template<typename T>
 dict allStatistics( T &m )
 {
@@ -162,6 +193,26 @@ void removeContextAnnotationsWrapper( Node &root )
 	MonitorAlgo::removeContextAnnotations( root );
 }
 
+std::string cacheMonitorStatisticsRepr( CacheMonitor::Statistics &s )
+{
+	return fmt::format(
+		"Gaffer.CacheMonitor.Statistics( hashCacheHits = {}, hashCacheMisses = {}, hashCollaborativeWaits = {}, computeCacheHits = {}, computeCacheMisses = {}, computeCollaborativeWaits = {}, computeCacheStores = {}, computeCacheBytes = {}, computePersistentCacheHits = {} )",
+			s.hashCacheHits, s.hashCacheMisses, s.hashCollaborativeWaits,
+			s.computeCacheHits, s.computeCacheMisses, s.computeCollaborativeWaits,
+			s.computeCacheStores, s.computeCacheBytes, s.computePersistentCacheHits
+	);
+}
+
+dict cacheMonitorNodeTypeStatistics( const CacheMonitor &monitor )
+{
+	dict result;
+	for( const auto &[typeName, statistics] : monitor.nodeTypeStatistics() )
+	{
+		result[typeName] = statistics;
+	}
+	return result;
+}
+
 ThreadMonitor::Ptr threadMonitorConstructor( boost::python::object pythonProcessMask )
 {
 	std::vector<IECore::InternedString> processMask;
@@ -199,6 +250,12 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+void traceMonitorWriteTrace( const TraceMonitor &monitor, const std::string &fileName )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.writeTrace( fileName );
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -219,6 +276,10 @@ void GafferModule::bindMonitor()
 			.value( "HashCount", HashCount )
 			.value( "ComputeCount", ComputeCount )
 			.value( "HashesPerCompute", HashesPerCompute )
+			.value( "CollaborativeWaitCount", CollaborativeWaitCount )
+			.value( "CollaborativeWaitDuration", CollaborativeWaitDuration )
+			.value( "CollaborativeIdleDuration", CollaborativeIdleDuration )
+			.value( "CollaborativeWorkFraction", CollaborativeWorkFraction )
 		;
 
 		def(
@@ -283,7 +344,11 @@ void GafferModule::bindMonitor()
 						arg( "hashCount" ) = 0,
 						arg( "computeCount" ) = 0,
 						arg( "hashDuration" ) = 0,
-						arg( "computeDuration" ) = 0
+						arg( "computeDuration" ) = 0,
+						arg( "collaborativeWaitCount" ) = 0,
+						arg( "collaborativeWorkCount" ) = 0,
+						arg( "collaborativeWaitDuration" ) = 0,
+						arg( "collaborativeIdleDuration" ) = 0
 					)
 				)
 			)
@@ -291,6 +356,10 @@ void GafferModule::bindMonitor()
 			.def_readwrite( "computeCount", &PerformanceMonitor::Statistics::computeCount )
 			.add_property( "hashDuration", &getHashDuration, &setHashDuration )
 			.add_property( "computeDuration", &getComputeDuration, &setComputeDuration )
+			.def_readwrite( "collaborativeWaitCount", &PerformanceMonitor::Statistics::collaborativeWaitCount )
+			.def_readwrite( "collaborativeWorkCount", &PerformanceMonitor::Statistics::collaborativeWorkCount )
+			.add_property( "collaborativeWaitDuration", &getCollaborativeWaitDuration, &setCollaborativeWaitDuration )
+			.add_property( "collaborativeIdleDuration", &getCollaborativeIdleDuration, &setCollaborativeIdleDuration )
 			.def( self == self )
 			.def( self != self )
 			.def( "__repr__", &repr )
@@ -315,6 +384,31 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<CacheMonitor, Monitor>( "CacheMonitor" )
+			.def( init<>() )
+			.def( "allStatistics", &allStatistics<CacheMonitor> )
+			.def( "plugStatistics", &CacheMonitor::plugStatistics, return_value_policy<copy_const_reference>() )
+			.def( "combinedStatistics", &CacheMonitor::combinedStatistics, return_value_policy<copy_const_reference>() )
+			.def( "nodeTypeStatistics", &cacheMonitorNodeTypeStatistics )
+		;
+
+		class_<CacheMonitor::Statistics>( "Statistics" )
+			.def_readwrite( "hashCacheHits", &CacheMonitor::Statistics::hashCacheHits )
+			.def_readwrite( "hashCacheMisses", &CacheMonitor::Statistics::hashCacheMisses )
+			.def_readwrite( "hashCollaborativeWaits", &CacheMonitor::Statistics::hashCollaborativeWaits )
+			.def_readwrite( "computeCacheHits", &CacheMonitor::Statistics::computeCacheHits )
+			.def_readwrite( "computeCacheMisses", &CacheMonitor::Statistics::computeCacheMisses )
+			.def_readwrite( "computeCollaborativeWaits", &CacheMonitor::Statistics::computeCollaborativeWaits )
+			.def_readwrite( "computeCacheStores", &CacheMonitor::Statistics::computeCacheStores )
+			.def_readwrite( "computeCacheBytes", &CacheMonitor::Statistics::computeCacheBytes )
+			.def_readwrite( "computePersistentCacheHits", &CacheMonitor::Statistics::computePersistentCacheHits )
+			.def( self == self )
+			.def( self != self )
+			.def( "__repr__", &cacheMonitorStatisticsRepr )
+		;
+	}
+
 	{
 		scope s = IECorePython::RefCountedClass<ThreadMonitor, Monitor>( "ThreadMonitor" )
 			.def(
@@ -332,6 +426,15 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<TraceMonitor, Monitor>( "TraceMonitor" )
+			.def( init<size_t>( ( arg( "eventsPerThread" ) = 100000 ) ) )
+			.def( "numEvents", &TraceMonitor::numEvents )
+			.def( "numDiscardedEvents", &TraceMonitor::numDiscardedEvents )
+			.def( "writeTrace", &traceMonitorWriteTrace )
+		;
+	}
+
 #ifdef GAFFER_VTUNE
 	{
 		scope s = IECorePython::RefCountedClass<VTuneMonitor, Monitor>( "VTuneMonitor" )
@@ -49,6 +49,9 @@
 #include "Gaffer/ScriptNode.h"
 
 #include "IECorePython/ExceptionAlgo.h"
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "boost/python/suite/indexing/container_utils.hpp"
 
 using namespace boost::python;
 using namespace IECorePython;
@@ -89,6 +92,42 @@ struct BinaryPlugSlotCaller
 	}
 };
 
+struct PlugVectorSignalCaller
+{
+	static void call( Node::PlugVectorSignal &s, object pythonPlugs )
+	{
+		std::vector<PlugPtr> plugPtrs;
+		boost::python::container_utils::extend_container( plugPtrs, pythonPlugs );
+		std::vector<Plug *> plugs;
+		for( const auto &p : plugPtrs )
+		{
+			plugs.push_back( p.get() );
+		}
+		IECorePython::ScopedGILRelease gilRelease;
+		s( plugs );
+	}
+};
+
+struct PlugVectorSlotCaller
+{
+	void operator()( boost::python::object slot, const std::vector<Plug *> &plugs )
+	{
+		try
+		{
+			boost::python::list pythonPlugs;
+			for( auto plug : plugs )
+			{
+				pythonPlugs.append( PlugPtr( plug ) );
+			}
+			slot( pythonPlugs );
+		}
+		catch( const error_already_set & )
+		{
+			IECorePython::ExceptionAlgo::translatePythonException();
+		}
+	}
+};
+
 struct ErrorSlotCaller
 {
 	void operator()( boost::python::object slot, const Plug *plug, const Plug *source, const std::string &error )
@@ -116,11 +155,13 @@ void GafferModule::bindNode()
 			.def( "plugSetSignal", &Node::plugSetSignal, return_internal_reference<1>() )
 			.def( "plugInputChangedSignal", &Node::plugInputChangedSignal, return_internal_reference<1>() )
 			.def( "plugDirtiedSignal", &Node::plugDirtiedSignal, return_internal_reference<1>() )
+			.def( "plugsDirtiedSignal", &Node::plugsDirtiedSignal, return_internal_reference<1>() )
 			.def( "errorSignal", (Node::ErrorSignal &(Node::*)())&Node::errorSignal, return_internal_reference<1>() )
 		;
 
 		SignalClass<Node::UnaryPlugSignal, DefaultSignalCaller<Node::UnaryPlugSignal>, UnaryPlugSlotCaller >( "UnaryPlugSignal" );
 		SignalClass<Node::BinaryPlugSignal, DefaultSignalCaller<Node::BinaryPlugSignal>, BinaryPlugSlotCaller >( "BinaryPlugSignal" );
+		SignalClass<Node::PlugVectorSignal, PlugVectorSignalCaller, PlugVectorSlotCaller >( "PlugVectorSignal" );
 		SignalClass<Node::ErrorSignal, DefaultSignalCaller<Node::ErrorSignal>, ErrorSlotCaller >( "ErrorSignal" );
 	}
 
@@ -133,6 +174,11 @@ void GafferModule::bindNode()
 	DependencyNodeClass<DependencyNode, DependencyNodeWrapper>();
 
 	using ComputeNodeWrapper = ComputeNodeWrapper<ComputeNode>;
-	DependencyNodeClass<ComputeNode, ComputeNodeWrapper>();
+	DependencyNodeClass<ComputeNode, ComputeNodeWrapper>()
+		.def( "setPrefetchEnabled", &ComputeNode::setPrefetchEnabled )
+		.staticmethod( "setPrefetchEnabled" )
+		.def( "getPrefetchEnabled", &ComputeNode::getPrefetchEnabled )
+		.staticmethod( "getPrefetchEnabled" )
+	;
 
 }
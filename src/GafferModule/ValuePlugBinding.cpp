@@ -104,6 +104,12 @@ void hash2( ValuePlug *plug, IECore::MurmurHash &h )
 }
 
 
+void clearPersistentCache()
+{
+	IECorePython::ScopedGILRelease r;
+	ValuePlug::clearPersistentCache();
+}
+
 } // namespace
 
 void GafferModule::bindValuePlug()
@@ -131,6 +137,12 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "setCacheMemoryLimit" )
 		.def( "cacheMemoryUsage", &ValuePlug::cacheMemoryUsage )
 		.staticmethod( "cacheMemoryUsage" )
+		.def( "cacheEvictions", &ValuePlug::cacheEvictions )
+		.staticmethod( "cacheEvictions" )
+		.def( "setCacheEvictionPolicy", &ValuePlug::setCacheEvictionPolicy )
+		.staticmethod( "setCacheEvictionPolicy" )
+		.def( "getCacheEvictionPolicy", &ValuePlug::getCacheEvictionPolicy )
+		.staticmethod( "getCacheEvictionPolicy" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
@@ -139,20 +151,56 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "setHashCacheSizeLimit" )
 		.def( "hashCacheTotalUsage", &ValuePlug::hashCacheTotalUsage )
 		.staticmethod( "hashCacheTotalUsage" )
+		.def( "hashCacheEvictions", &ValuePlug::hashCacheEvictions )
+		.staticmethod( "hashCacheEvictions" )
 		.def( "clearHashCache", &ValuePlug::clearHashCache, arg( "now" ) = false )
 		.staticmethod( "clearHashCache" )
 		.def( "getHashCacheMode", &ValuePlug::getHashCacheMode )
 		.staticmethod( "getHashCacheMode" )
 		.def( "setHashCacheMode", &ValuePlug::setHashCacheMode )
 		.staticmethod( "setHashCacheMode" )
+		.def( "setPersistentCacheDirectory", &ValuePlug::setPersistentCacheDirectory )
+		.staticmethod( "setPersistentCacheDirectory" )
+		.def( "getPersistentCacheDirectory", &ValuePlug::getPersistentCacheDirectory )
+		.staticmethod( "getPersistentCacheDirectory" )
+		.def( "setPersistentCacheSizeLimit", &ValuePlug::setPersistentCacheSizeLimit )
+		.staticmethod( "setPersistentCacheSizeLimit" )
+		.def( "getPersistentCacheSizeLimit", &ValuePlug::getPersistentCacheSizeLimit )
+		.staticmethod( "getPersistentCacheSizeLimit" )
+		.def( "setPersistentCacheComputeThreshold", &ValuePlug::setPersistentCacheComputeThreshold )
+		.staticmethod( "setPersistentCacheComputeThreshold" )
+		.def( "getPersistentCacheComputeThreshold", &ValuePlug::getPersistentCacheComputeThreshold )
+		.staticmethod( "getPersistentCacheComputeThreshold" )
+		.def( "persistentCacheUsage", &ValuePlug::persistentCacheUsage )
+		.staticmethod( "persistentCacheUsage" )
+		.def( "clearPersistentCache", &clearPersistentCache )
+		.staticmethod( "clearPersistentCache" )
+		.def( "persistentCacheStatistics", &ValuePlug::persistentCacheStatistics )
+		.staticmethod( "persistentCacheStatistics" )
+		.def( "resetPersistentCacheStatistics", &ValuePlug::resetPersistentCacheStatistics )
+		.staticmethod( "resetPersistentCacheStatistics" )
 		.def( "dirtyCount", &ValuePlug::dirtyCount )
 		.def( "__repr__", &repr )
 	;
 
+	class_<ValuePlug::PersistentCacheStatistics>( "PersistentCacheStatistics" )
+		.def_readonly( "hits", &ValuePlug::PersistentCacheStatistics::hits )
+		.def_readonly( "misses", &ValuePlug::PersistentCacheStatistics::misses )
+		.def_readonly( "writes", &ValuePlug::PersistentCacheStatistics::writes )
+		.def_readonly( "failures", &ValuePlug::PersistentCacheStatistics::failures )
+		.def_readonly( "evictions", &ValuePlug::PersistentCacheStatistics::evictions )
+	;
+
+	enum_<ValuePlug::CacheEvictionPolicy>( "CacheEvictionPolicy" )
+		.value( "LRU", ValuePlug::CacheEvictionPolicy::LRU )
+		.value( "CostAware", ValuePlug::CacheEvictionPolicy::CostAware )
+	;
+
 	enum_<ValuePlug::HashCacheMode>( "HashCacheMode" )
 		.value( "Standard", ValuePlug::HashCacheMode::Standard )
 		.value( "Checked", ValuePlug::HashCacheMode::Checked )
 		.value( "Legacy", ValuePlug::HashCacheMode::Legacy )
+		.value( "Compact", ValuePlug::HashCacheMode::Compact )
 	;
 
 	enum_<ValuePlug::CachePolicy>( "CachePolicy" )
@@ -121,3 +121,17 @@ IECore::ConstCompoundObjectPtr AttributeProcessor::computeAttributes( const Scen
 		return inPlug()->attributesPlug()->getValue();
 	}
 }
+
+void AttributeProcessor::hashSubtree( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	if( filterValue( context ) & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::DescendantMatch ) )
+	{
+		FilteredSceneProcessor::hashSubtree( path, context, parent, h );
+	}
+	else
+	{
+		// Nothing is processed at or below this location,
+		// so the whole subtree is passed through.
+		h = inPlug()->subtreeHash( path );
+	}
+}
@@ -0,0 +1,261 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/BoundFilter.h"
+
+#include "GafferScene/BoundingVolumeHierarchy.h"
+#include "GafferScene/ScenePlug.h"
+
+#include "Gaffer/Context.h"
+#include "Gaffer/StringPlug.h"
+
+#include "IECoreScene/Camera.h"
+
+#include "fmt/format.h"
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace Gaffer;
+using namespace GafferScene;
+
+namespace
+{
+
+ScenePlug::ScenePath cameraPath( const ScenePlug *scene, const StringPlug *cameraPlug )
+{
+	const ScenePlug::ScenePath path = ScenePlug::stringToPath( cameraPlug->getValue() );
+	if( !scene->exists( path ) )
+	{
+		throw IECore::Exception( fmt::format( "Camera \"{}\" does not exist", ScenePlug::pathToString( path ) ) );
+	}
+	return path;
+}
+
+} // namespace
+
+GAFFER_NODE_DEFINE_TYPE( BoundFilter );
+
+size_t BoundFilter::g_firstPlugIndex = 0;
+
+BoundFilter::BoundFilter( const std::string &name )
+	:	Filter( name )
+{
+	storeIndexOfNextChild( g_firstPlugIndex );
+
+	addChild( new IntPlug( "mode", Plug::In, Bound, Bound, Camera ) );
+	addChild( new Box3fPlug( "bound", Plug::In, Box3f( V3f( -0.5 ), V3f( 0.5 ) ) ) );
+	addChild( new StringPlug( "camera" ) );
+	addChild( new PathMatcherDataPlug( "__matches", Gaffer::Plug::Out, new PathMatcherData ) );
+}
+
+BoundFilter::~BoundFilter()
+{
+}
+
+Gaffer::IntPlug *BoundFilter::modePlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::IntPlug *BoundFilter::modePlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex );
+}
+
+Gaffer::Box3fPlug *BoundFilter::boundPlug()
+{
+	return getChild<Box3fPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::Box3fPlug *BoundFilter::boundPlug() const
+{
+	return getChild<Box3fPlug>( g_firstPlugIndex + 1 );
+}
+
+Gaffer::StringPlug *BoundFilter::cameraPlug()
+{
+	return getChild<StringPlug>( g_firstPlugIndex + 2 );
+}
+
+const Gaffer::StringPlug *BoundFilter::cameraPlug() const
+{
+	return getChild<StringPlug>( g_firstPlugIndex + 2 );
+}
+
+Gaffer::PathMatcherDataPlug *BoundFilter::matchesPlug()
+{
+	return getChild<PathMatcherDataPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::PathMatcherDataPlug *BoundFilter::matchesPlug() const
+{
+	return getChild<PathMatcherDataPlug>( g_firstPlugIndex + 3 );
+}
+
+void BoundFilter::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	Filter::affects( input, outputs );
+
+	if(
+		input == modePlug() ||
+		boundPlug()->isAncestorOf( input ) ||
+		input == cameraPlug()
+	)
+	{
+		outputs.push_back( matchesPlug() );
+	}
+	else if( const ScenePlug *scene = input->parent<ScenePlug>() )
+	{
+		// The matches are keyed on `BoundingVolumeHierarchy::hash()`, which
+		// uses `ScenePlug::subtreeHash()`. That accounts for attributes too,
+		// even though they don't affect the result.
+		if(
+			input == scene->boundPlug() ||
+			input == scene->transformPlug() ||
+			input == scene->attributesPlug() ||
+			input == scene->childNamesPlug() ||
+			input == scene->objectPlug()
+		)
+		{
+			outputs.push_back( matchesPlug() );
+		}
+	}
+
+	if( input == matchesPlug() )
+	{
+		outputs.push_back( outPlug() );
+	}
+}
+
+void BoundFilter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	Filter::hash( output, context, h );
+
+	if( output == matchesPlug() )
+	{
+		const ScenePlug *scene = getInputScene( context );
+		ScenePlug::GlobalScope globalScope( context ); // Removes `scene:filter:inputScene`
+		if( !scene )
+		{
+			return;
+		}
+
+		const Mode mode = (Mode)modePlug()->getValue();
+		h.append( mode );
+		if( mode == Camera )
+		{
+			const ScenePlug::ScenePath path = cameraPath( scene, cameraPlug() );
+			h.append( scene->objectHash( path ) );
+			h.append( scene->fullTransformHash( path ) );
+		}
+		else
+		{
+			boundPlug()->hash( h );
+		}
+
+		h.append( BoundingVolumeHierarchy::hash( scene ) );
+	}
+}
+
+void BoundFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	Filter::compute( output, context );
+
+	if( output == matchesPlug() )
+	{
+		const ScenePlug *scene = getInputScene( context );
+		ScenePlug::GlobalScope globalScope( context ); // Removes `scene:filter:inputScene`
+		if( !scene )
+		{
+			static_cast<PathMatcherDataPlug *>( output )->setToDefault();
+			return;
+		}
+
+		PathMatcherDataPtr data = new PathMatcherData;
+		const Mode mode = (Mode)modePlug()->getValue();
+		if( mode == Camera )
+		{
+			const ScenePlug::ScenePath path = cameraPath( scene, cameraPlug() );
+			IECoreScene::ConstCameraPtr camera = runTimeCast<const IECoreScene::Camera>( scene->object( path ) );
+			if( !camera )
+			{
+				throw IECore::Exception( fmt::format( "Location \"{}\" is not a camera", ScenePlug::pathToString( path ) ) );
+			}
+			const vector<Plane3f> frustum = BoundingVolumeHierarchy::frustum( camera.get(), scene->fullTransform( path ) );
+			data->writable() = BoundingVolumeHierarchy::acquire( scene )->intersecting( frustum );
+		}
+		else
+		{
+			data->writable() = BoundingVolumeHierarchy::acquire( scene )->intersecting( boundPlug()->getValue() );
+		}
+
+		static_cast<PathMatcherDataPlug *>( output )->setValue( data );
+	}
+}
+
+void BoundFilter::hashMatch( const ScenePlug *scene, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	if( !scene )
+	{
+		return;
+	}
+
+	// See comments in `SetFilter::hashMatch()`.
+	h.append( context->variableHash( ScenePlug::scenePathContextName ) );
+
+	Gaffer::Context::EditableScope matchesScope( context );
+	matchesScope.remove( ScenePlug::scenePathContextName );
+
+	matchesPlug()->hash( h );
+}
+
+unsigned BoundFilter::computeMatch( const ScenePlug *scene, const Gaffer::Context *context ) const
+{
+	if( !scene )
+	{
+		return IECore::PathMatcher::NoMatch;
+	}
+
+	const ScenePlug::ScenePath &path = context->get<ScenePlug::ScenePath>( ScenePlug::scenePathContextName );
+
+	Gaffer::Context::EditableScope matchesScope( context );
+	matchesScope.remove( ScenePlug::scenePathContextName );
+
+	ConstPathMatcherDataPtr matches = matchesPlug()->getValue();
+
+	return matches->readable().match( path );
+}
@@ -0,0 +1,458 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/BoundingVolumeHierarchy.h"
+
+#include "GafferScene/SceneSnapshot.h"
+
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include "IECoreScene/Camera.h"
+
+#include "Imath/ImathBoxAlgo.h"
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+#include "tbb/parallel_reduce.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace Gaffer;
+using namespace GafferScene;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal structures
+//////////////////////////////////////////////////////////////////////////
+
+struct BoundingVolumeHierarchy::Node
+{
+	Box3f bound;
+	// For leaf nodes, the range of items is `[first, first + count)`. For
+	// internal nodes, `count` is 0 and the children are at `first` and
+	// `first + 1`.
+	size_t first;
+	size_t count;
+};
+
+struct BoundingVolumeHierarchy::Item
+{
+	Box3f bound;
+	// Index into `m_names` and `m_parents`.
+	size_t location;
+};
+
+namespace
+{
+
+// Nodes with this many items or fewer are not subdivided further.
+const size_t g_maxLeafSize = 4;
+// Ranges with more items than this are built in parallel.
+const size_t g_parallelBuildThreshold = 4096;
+
+// Transforms `plane` (in camera space) into world space, given the
+// inverse of the camera-to-world matrix.
+Plane3f transformPlane( const Plane3f &plane, const M44f &worldToCamera )
+{
+	const M44f &m = worldToCamera;
+	const V3f &n = plane.normal;
+	const V3f worldNormal(
+		m[0][0] * n.x + m[0][1] * n.y + m[0][2] * n.z,
+		m[1][0] * n.x + m[1][1] * n.y + m[1][2] * n.z,
+		m[2][0] * n.x + m[2][1] * n.y + m[2][2] * n.z
+	);
+	const float worldDistance = plane.distance - ( m[3][0] * n.x + m[3][1] * n.y + m[3][2] * n.z );
+	const float length = worldNormal.length();
+	return Plane3f( worldNormal / length, worldDistance / length );
+}
+
+bool outside( const Box3f &bound, const vector<Plane3f> &frustum )
+{
+	for( const auto &plane : frustum )
+	{
+		// Test the corner of the box that is furthest along the normal.
+		// If it is behind the plane, then the whole box is.
+		const V3f corner(
+			plane.normal.x >= 0 ? bound.max.x : bound.min.x,
+			plane.normal.y >= 0 ? bound.max.y : bound.min.y,
+			plane.normal.z >= 0 ? bound.max.z : bound.min.z
+		);
+		if( plane.distanceTo( corner ) < 0 )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+struct CacheGetterKey
+{
+
+	CacheGetterKey( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+		:	scene( scene ), root( root ), hash( BoundingVolumeHierarchy::hash( scene, root ) ), threadState( ThreadState::current() )
+	{
+	}
+
+	operator IECore::MurmurHash () const
+	{
+		return hash;
+	}
+
+	const ScenePlug *scene;
+	const ScenePlug::ScenePath &root;
+	const IECore::MurmurHash hash;
+	const ThreadState &threadState;
+
+};
+
+using HierarchyCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstBoundingVolumeHierarchyPtr, IECorePreview::LRUCachePolicy::TaskParallel, CacheGetterKey>;
+
+HierarchyCache &hierarchyCache()
+{
+	static HierarchyCache *g_cache = new HierarchyCache(
+		[] ( const CacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller ) {
+			ThreadState::Scope threadStateScope( key.threadState );
+			ConstBoundingVolumeHierarchyPtr result = new BoundingVolumeHierarchy( key.scene, key.root );
+			// Cost is measured in indexed locations, which dominate
+			// memory usage for large scenes.
+			cost = result->size();
+			return result;
+		},
+		// Enough for several hierarchies for scenes with millions of
+		// leaf locations.
+		20000000,
+		HierarchyCache::RemovalCallback(),
+		/* cacheErrors = */ false
+	);
+	return *g_cache;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// BoundingVolumeHierarchy
+//////////////////////////////////////////////////////////////////////////
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+	:	m_root( root )
+{
+	ConstSceneSnapshotPtr snapshot = new SceneSnapshot( scene, root, SceneSnapshot::Bound | SceneSnapshot::Transform );
+	m_names = snapshot->names();
+	m_parents = snapshot->parents();
+
+	// Gather world-space bounds for all leaf locations.
+
+	const vector<size_t> &subtreeEnds = snapshot->subtreeEnds();
+	const vector<Box3f> &bounds = snapshot->bounds();
+	const vector<M44f> &fullTransforms = snapshot->fullTransforms();
+
+	using ThreadItems = tbb::enumerable_thread_specific<vector<Item>>;
+	ThreadItems threadItems;
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, snapshot->size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			vector<Item> &items = threadItems.local();
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				if( subtreeEnds[i] != i + 1 || bounds[i].isEmpty() )
+				{
+					continue;
+				}
+				items.push_back( { Imath::transform( bounds[i], fullTransforms[i] ), i } );
+			}
+		},
+		taskGroupContext
+	);
+
+	snapshot = nullptr;
+
+	size_t numItems = 0;
+	for( const auto &items : threadItems )
+	{
+		numItems += items.size();
+	}
+	m_items.reserve( numItems );
+	for( auto &items : threadItems )
+	{
+		m_items.insert( m_items.end(), items.begin(), items.end() );
+		vector<Item>().swap( items );
+	}
+
+	if( m_items.empty() )
+	{
+		return;
+	}
+
+	// Build the node hierarchy. Since leaves always contain at least two
+	// items (unless the whole hierarchy contains only one), there can be
+	// no more nodes than there are items.
+
+	m_nodes.resize( m_items.size() );
+	std::atomic<size_t> nextNode( 1 );
+	build( 0, 0, m_items.size(), nextNode );
+	m_nodes.resize( nextNode );
+	m_nodes.shrink_to_fit();
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+IECore::MurmurHash BoundingVolumeHierarchy::hash( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+{
+	// The subtree hash covers the bounds, transforms and child names of
+	// every location below `root`, and is cached, so this is cheap to call
+	// repeatedly. It also covers attributes and objects, which the hierarchy
+	// doesn't depend on, so we may occasionally rebuild unnecessarily.
+	IECore::MurmurHash result = scene->subtreeHash( root );
+	result.append( scene->fullTransformHash( root ) );
+	return result;
+}
+
+ConstBoundingVolumeHierarchyPtr BoundingVolumeHierarchy::acquire( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+{
+	return hierarchyCache().get( CacheGetterKey( scene, root ) );
+}
+
+const ScenePlug::ScenePath &BoundingVolumeHierarchy::root() const
+{
+	return m_root;
+}
+
+size_t BoundingVolumeHierarchy::size() const
+{
+	return m_items.size();
+}
+
+Imath::Box3f BoundingVolumeHierarchy::bound() const
+{
+	return m_nodes.size() ? m_nodes[0].bound : Box3f();
+}
+
+IECore::PathMatcher BoundingVolumeHierarchy::intersecting( const Imath::Box3f &bound ) const
+{
+	return query(
+		[&bound] ( const Box3f &b ) {
+			return b.intersects( bound );
+		}
+	);
+}
+
+IECore::PathMatcher BoundingVolumeHierarchy::intersecting( const std::vector<Imath::Plane3f> &frustum ) const
+{
+	return query(
+		[&frustum] ( const Box3f &b ) {
+			return !outside( b, frustum );
+		}
+	);
+}
+
+IECore::PathMatcher BoundingVolumeHierarchy::intersecting( const Imath::Line3f &ray ) const
+{
+	return query(
+		[&ray] ( const Box3f &b ) {
+			V3f intersection;
+			return Imath::intersects( b, ray, intersection );
+		}
+	);
+}
+
+std::vector<Imath::Plane3f> BoundingVolumeHierarchy::frustum( const IECoreScene::Camera *camera, const Imath::M44f &cameraToWorld )
+{
+	const Box2f screenWindow = camera->frustum();
+	const V2f clippingPlanes = camera->getClippingPlanes();
+
+	// Planes in camera space, where the camera looks down -Z.
+	vector<Plane3f> result;
+	result.reserve( 6 );
+	if( camera->getProjection() == "perspective" )
+	{
+		// `screenWindow` is at a distance of 1 from the camera.
+		result.push_back( Plane3f( V3f( 1, 0, screenWindow.min.x ), 0 ) );
+		result.push_back( Plane3f( V3f( -1, 0, -screenWindow.max.x ), 0 ) );
+		result.push_back( Plane3f( V3f( 0, 1, screenWindow.min.y ), 0 ) );
+		result.push_back( Plane3f( V3f( 0, -1, -screenWindow.max.y ), 0 ) );
+	}
+	else
+	{
+		result.push_back( Plane3f( V3f( 1, 0, 0 ), screenWindow.min.x ) );
+		result.push_back( Plane3f( V3f( -1, 0, 0 ), -screenWindow.max.x ) );
+		result.push_back( Plane3f( V3f( 0, 1, 0 ), screenWindow.min.y ) );
+		result.push_back( Plane3f( V3f( 0, -1, 0 ), -screenWindow.max.y ) );
+	}
+	result.push_back( Plane3f( V3f( 0, 0, -1 ), clippingPlanes[0] ) );
+	result.push_back( Plane3f( V3f( 0, 0, 1 ), -clippingPlanes[1] ) );
+
+	const M44f worldToCamera = cameraToWorld.inverse();
+	for( auto &plane : result )
+	{
+		plane = transformPlane( plane, worldToCamera );
+	}
+
+	return result;
+}
+
+void BoundingVolumeHierarchy::build( size_t nodeIndex, size_t begin, size_t end, std::atomic<size_t> &nextNode )
+{
+	Node &node = m_nodes[nodeIndex];
+
+	node.bound = Box3f();
+	Box3f centroidBound;
+	for( size_t i = begin; i < end; ++i )
+	{
+		node.bound.extendBy( m_items[i].bound );
+		centroidBound.extendBy( m_items[i].bound.center() );
+	}
+
+	if( end - begin <= g_maxLeafSize )
+	{
+		node.first = begin;
+		node.count = end - begin;
+		return;
+	}
+
+	// Split at the median along the axis with the greatest spread
+	// of centroids.
+
+	const int axis = centroidBound.majorAxis();
+	const size_t middle = begin + ( end - begin ) / 2;
+	std::nth_element(
+		m_items.begin() + begin, m_items.begin() + middle, m_items.begin() + end,
+		[axis] ( const Item &a, const Item &b ) {
+			return a.bound.min[axis] + a.bound.max[axis] < b.bound.min[axis] + b.bound.max[axis];
+		}
+	);
+
+	const size_t firstChild = nextNode.fetch_add( 2 );
+	node.first = firstChild;
+	node.count = 0;
+
+	if( end - begin > g_parallelBuildThreshold )
+	{
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_invoke(
+			[&] { build( firstChild, begin, middle, nextNode ); },
+			[&] { build( firstChild + 1, middle, end, nextNode ); },
+			taskGroupContext
+		);
+	}
+	else
+	{
+		build( firstChild, begin, middle, nextNode );
+		build( firstChild + 1, middle, end, nextNode );
+	}
+}
+
+template<typename Predicate>
+IECore::PathMatcher BoundingVolumeHierarchy::query( Predicate &&predicate ) const
+{
+	vector<size_t> locations;
+	if( m_nodes.empty() )
+	{
+		return PathMatcher();
+	}
+
+	vector<size_t> stack;
+	stack.push_back( 0 );
+	while( stack.size() )
+	{
+		const Node &node = m_nodes[stack.back()];
+		stack.pop_back();
+		if( !predicate( node.bound ) )
+		{
+			continue;
+		}
+
+		if( node.count )
+		{
+			for( size_t i = node.first, e = node.first + node.count; i < e; ++i )
+			{
+				if( predicate( m_items[i].bound ) )
+				{
+					locations.push_back( m_items[i].location );
+				}
+			}
+		}
+		else
+		{
+			stack.push_back( node.first + 1 );
+			stack.push_back( node.first );
+		}
+	}
+
+	return paths( locations );
+}
+
+IECore::PathMatcher BoundingVolumeHierarchy::paths( std::vector<size_t> &locations ) const
+{
+	// Sorting puts the locations in depth-first order, so that each
+	// parallel task builds a PathMatcher for a compact region of the
+	// hierarchy, and the final merge is cheap.
+	std::sort( locations.begin(), locations.end() );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	return tbb::parallel_reduce(
+		tbb::blocked_range<size_t>( 0, locations.size(), 1000 ),
+		PathMatcher(),
+		[&] ( const tbb::blocked_range<size_t> &range, PathMatcher result ) {
+			ScenePlug::ScenePath path;
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				path.clear();
+				for( size_t l = locations[i]; l != 0; l = m_parents[l] )
+				{
+					path.push_back( m_names[l] );
+				}
+				path.insert( path.end(), m_root.rbegin(), m_root.rend() );
+				std::reverse( path.begin(), path.end() );
+				result.addPath( path );
+			}
+			return result;
+		},
+		[] ( PathMatcher a, const PathMatcher &b ) {
+			a.addPaths( b );
+			return a;
+		},
+		tbb::simple_partitioner(),
+		taskGroupContext
+	);
+}
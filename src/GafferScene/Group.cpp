@@ -37,6 +37,7 @@
 
 #include "GafferScene/Group.h"
 
+#include "GafferScene/FilterPlug.h"
 #include "GafferScene/Private/ChildNamesMap.h"
 #include "GafferScene/SceneAlgo.h"
 
@@ -197,12 +198,13 @@ void Group::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context )
 {
 	if( output == mappingPlug() )
 	{
-		vector<ConstInternedStringVectorDataPtr> inputChildNames; inputChildNames.reserve( inPlugs()->children().size() );
-		ScenePlug::PathScope scope( context, &g_root );
+		vector<const InternedStringVectorDataPlug *> childNamesPlugs; childNamesPlugs.reserve( inPlugs()->children().size() );
 		for( const auto &p : ScenePlug::Range( *inPlugs() ) )
 		{
-			inputChildNames.push_back( p->childNamesPlug()->getValue() );
+			childNamesPlugs.push_back( p->childNamesPlug() );
 		}
+		ScenePlug::PathScope scope( context, &g_root );
+		const vector<ConstInternedStringVectorDataPtr> inputChildNames = InternedStringVectorDataPlug::getValues( childNamesPlugs );
 		static_cast<Gaffer::ObjectPlug *>( output )->setValue( new Private::ChildNamesMap( inputChildNames ) );
 		return;
 	}
@@ -210,6 +212,42 @@ void Group::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context )
 	return SceneProcessor::compute( output, context );
 }
 
+void Group::prefetch( const Gaffer::ValuePlug *output, const Gaffer::Context *context, PrefetchRequests &requests ) const
+{
+	SceneProcessor::prefetch( output, context, requests );
+
+	if( output == outPlug()->boundPlug() )
+	{
+		// The bounds for "/" and "/group" are the union of the root bounds
+		// of all the inputs.
+		if( context->get<ScenePath>( ScenePlug::scenePathContextName ).size() <= 1 )
+		{
+			ContextPtr rootContext = new Context( *context );
+			rootContext->set( ScenePlug::scenePathContextName, g_root );
+			for( const auto &p : ScenePlug::Range( *inPlugs() ) )
+			{
+				requests.push_back( { p->boundPlug(), rootContext } );
+			}
+		}
+	}
+	else if( output == outPlug()->childNamesPlug() )
+	{
+		// The children of "/group" are determined by `mappingPlug()`, which
+		// requires the root child names of all the inputs.
+		if( context->get<ScenePath>( ScenePlug::scenePathContextName ).size() == 1 )
+		{
+			ContextPtr rootContext = new Context( *context );
+			rootContext->remove( FilterPlug::inputSceneContextName );
+			rootContext->remove( ScenePlug::setNameContextName );
+			rootContext->set( ScenePlug::scenePathContextName, g_root );
+			for( const auto &p : ScenePlug::Range( *inPlugs() ) )
+			{
+				requests.push_back( { p->childNamesPlug(), rootContext } );
+			}
+		}
+	}
+}
+
 void Group::hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	if( path.size() == 0 ) // "/"
@@ -467,11 +505,12 @@ void Group::hashSet( const IECore::InternedString &setName, const Gaffer::Contex
 
 IECore::ConstPathMatcherDataPtr Group::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	vector<ConstPathMatcherDataPtr> inputSets; inputSets.reserve( inPlugs()->children().size() );
+	vector<const PathMatcherDataPlug *> setPlugs; setPlugs.reserve( inPlugs()->children().size() );
 	for( const auto &p : ScenePlug::Range( *inPlugs() ) )
 	{
-		inputSets.push_back( p->setPlug()->getValue() );
+		setPlugs.push_back( p->setPlug() );
 	}
+	const vector<ConstPathMatcherDataPtr> inputSets = PathMatcherDataPlug::getValues( setPlugs );
 
 	ScenePlug::GlobalScope s( context );
 	Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
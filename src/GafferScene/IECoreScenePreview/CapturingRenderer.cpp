@@ -37,7 +37,9 @@
 #include "GafferScene/Private/IECoreScenePreview/CapturingRenderer.h"
 
 #include "IECore/MessageHandler.h"
+#include "IECore/ObjectVector.h"
 #include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
 
 #include "fmt/format.h"
 
@@ -52,7 +54,7 @@ using namespace IECoreScenePreview;
 IECoreScenePreview::Renderer::TypeDescription<CapturingRenderer> CapturingRenderer::g_typeDescription( "Capturing" );
 
 CapturingRenderer::CapturingRenderer( RenderType type, const std::string &fileName, const IECore::MessageHandlerPtr &messageHandler )
-	:	m_messageHandler( messageHandler ), m_renderType( type ), m_rendering( false )
+	:	m_messageHandler( messageHandler ), m_renderType( type ), m_rendering( false ), m_captureInstances( false )
 {
 }
 
@@ -101,6 +103,12 @@ void CapturingRenderer::option( const IECore::InternedString &name, const IECore
 {
 	/// \todo Implement
 	checkPaused();
+
+	if( name == "cr:instances" )
+	{
+		auto *data = runTimeCast<const BoolData>( value );
+		m_captureInstances = data && data->readable();
+	}
 }
 
 void CapturingRenderer::output( const IECore::InternedString &name, const IECoreScene::Output *output )
@@ -177,6 +185,55 @@ Renderer::ObjectInterfacePtr CapturingRenderer::object( const std::string &name,
 	return result;
 }
 
+bool CapturingRenderer::supportsInstances() const
+{
+	return m_captureInstances;
+}
+
+Renderer::ObjectInterfacePtr CapturingRenderer::instances( const std::string &name, const InstanceArray &instances )
+{
+	if( !m_captureInstances )
+	{
+		return Renderer::instances( name, instances );
+	}
+
+	CompoundObjectPtr capturedInstances = new CompoundObject;
+
+	StringVectorDataPtr prototypeNames = new StringVectorData;
+	ObjectVectorPtr prototypes = new ObjectVector;
+	ObjectVectorPtr prototypeAttributes = new ObjectVector;
+	for( const auto &prototype : instances.prototypes )
+	{
+		prototypeNames->writable().push_back( prototype.name );
+		prototypes->members().push_back( prototype.samples.size() ? prototype.samples[0]->copy() : nullptr );
+		prototypeAttributes->members().push_back( prototype.attributes ? prototype.attributes->copy() : nullptr );
+	}
+
+	capturedInstances->members()["prototypeNames"] = prototypeNames;
+	capturedInstances->members()["prototypes"] = prototypes;
+	capturedInstances->members()["prototypeAttributes"] = prototypeAttributes;
+	capturedInstances->members()["prototypeIndices"] = new IntVectorData( *instances.prototypeIndices );
+	if( instances.ids )
+	{
+		capturedInstances->members()["ids"] = new Int64VectorData( *instances.ids );
+	}
+	capturedInstances->members()["transforms"] = new M44fVectorData( *instances.transforms );
+	capturedInstances->members()["transformTimes"] = new FloatVectorData( instances.transformTimes );
+	CompoundDataPtr attributes = new CompoundData;
+	for( const auto &[attributeName, data] : instances.attributes )
+	{
+		attributes->writable()[attributeName] = data->copy();
+	}
+	capturedInstances->members()["attributes"] = attributes;
+
+	ObjectInterfacePtr result = this->object( name, vector<const Object *>(), {}, nullptr );
+	if( result )
+	{
+		static_cast<CapturedObject *>( result.get() )->m_capturedInstances = capturedInstances;
+	}
+	return result;
+}
+
 void CapturingRenderer::render()
 {
 	IECore::MessageHandler::Scope s( m_messageHandler.get() );
@@ -324,6 +381,11 @@ uint32_t CapturingRenderer::CapturedObject::id() const
 	return m_id;
 }
 
+const IECore::CompoundObject *CapturingRenderer::CapturedObject::capturedInstances() const
+{
+	return m_capturedInstances.get();
+}
+
 void CapturingRenderer::CapturedObject::transform( const Imath::M44f &transform )
 {
 	m_renderer->checkPaused();
@@ -52,6 +52,7 @@
 
 #include "fmt/format.h"
 
+#include "tbb/enumerable_thread_specific.h"
 #include "tbb/parallel_for.h"
 
 using namespace IECoreScene;
@@ -772,6 +773,36 @@ struct TessellationTempBuffers
 	std::vector<int> collapseIndices;
 };
 
+// Everything a thread needs to tessellate a face. We keep one of these per thread for the duration of
+// `tessellateMesh()`, so that the same storage is reused across both passes, rather than being
+// reallocated for every range of faces that TBB hands out.
+struct TessellationScratch
+{
+	OSDB::Surface<float> vertexSurface;
+	TessellationTempBuffers buffers;
+
+	// Returns the coordinates for `tessPattern`. The pattern depends only on the parameterization of
+	// the face ( since the rate and options are the same for the whole mesh ), so consecutive faces
+	// with matching parameterizations, which is nearly all of them on a typical mesh, can share the
+	// same coordinates.
+	const std::vector<Imath::V2f> &coords( const OSDB::Tessellation &tessPattern )
+	{
+		const OSDB::Parameterization parameterization = tessPattern.GetParameterization();
+		if( parameterization.GetType() != m_coordsType || parameterization.GetFaceSize() != m_coordsFaceSize )
+		{
+			m_coords.resize( tessPattern.GetNumCoords() );
+			tessPattern.GetCoords( (float*)m_coords.data() );
+			m_coordsType = parameterization.GetType();
+			m_coordsFaceSize = parameterization.GetFaceSize();
+		}
+		return m_coords;
+	}
+
+	std::vector<Imath::V2f> m_coords;
+	OSDB::Parameterization::Type m_coordsType = OSDB::Parameterization::QUAD;
+	int m_coordsFaceSize = 0;
+};
+
 
 // Produce all the tessellated results for one primitive for one face.
 //
@@ -1413,11 +1444,16 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 	// pass where we collect the keys for each type of irregular face in the mesh, and then did a parrallel
 	// loop over those keys. OpenSubdiv is not set up to let us do that though, and this is much less of
 	// an issue on reasonable quad meshes than it is on spheres.
+	//
+	// Faces vary hugely in cost, so we let TBB split the work as finely as it needs to balance the load,
+	// with per-thread scratch storage keeping the cost of each range low.
+	tbb::enumerable_thread_specific<TessellationScratch> threadScratch;
+
 	tbb::parallel_for(
 		tbb::blocked_range<int>( 0, numFaces ),
 		[&]( tbb::blocked_range<int> &range )
 		{
-			OSDB::Surface<float> faceSurface;
+			OSDB::Surface<float> &faceSurface = threadScratch.local().vertexSurface;
 
 			for( int faceIndex = range.begin(); faceIndex != range.end(); ++faceIndex )
 			{
@@ -1456,7 +1492,7 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 				}
 			}
 		},
-		tbb::static_partitioner(),
+		tbb::auto_partitioner(),
 		taskGroupContext
 	);
 
@@ -1516,10 +1552,8 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		tbb::blocked_range<int>( 0, numFaces ),
 		[&]( tbb::blocked_range<int> &range )
 		{
-			OSDB::Surface<float> vertexSurface;
-			std::vector<Imath::V2f> tessCoords;
-
-			TessellationTempBuffers tessellationTempBuffers;
+			TessellationScratch &scratch = threadScratch.local();
+			OSDB::Surface<float> &vertexSurface = scratch.vertexSurface;
 
 			for( int faceIndex = range.begin(); faceIndex != range.end(); ++faceIndex )
 			{
@@ -1538,8 +1572,7 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 				//
 				OSDB::Tessellation tessPattern( vertexSurface.GetParameterization(), tessUniformRate, tessOptions );
 
-				tessCoords.resize( tessPattern.GetNumCoords() );
-				tessPattern.GetCoords( (float*)tessCoords.data() );
+				const std::vector<Imath::V2f> &tessCoords = scratch.coords( tessPattern );
 
 				tessellateVariables(
 					meshSurfaceFactory, tessPattern,
@@ -1549,7 +1582,7 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 					vertexTopology, vertexSurface, posPrimvarSetup, outNormals,
 					vertexPrimvarSetups, uniformPrimvarSetups,
 					faceVaryingTopologies, faceVaryingPrimvarSetups,
-					tessellationTempBuffers, canceller
+					scratch.buffers, canceller
 				);
 
 			}
@@ -44,13 +44,21 @@
 #include "IECore/DataAlgo.h"
 #include "IECore/TypeTraits.h"
 
+#include <algorithm>
+#include <array>
 #include <unordered_map>
 #include <numeric>
+#include <variant>
 
 #include "fmt/format.h"
 
 #include "tbb/parallel_for.h"
 
+#if defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define PRIMITIVEALGO_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
 using namespace IECoreScene;
 using namespace IECore;
 using namespace IECoreScenePreview;
@@ -161,6 +169,157 @@ void dataResize( Data *data, size_t size )
 	);
 }
 
+// Transform kernels
+// =================
+//
+// We have a scalar kernel for each type of transform, and vectorised
+// equivalents which are chosen at runtime if the CPU supports them. The
+// vectorised kernels perform the same sequence of multiplies and adds as
+// Imath, without fused multiply-add, so that they give identical results.
+
+void transformPointsScalar( const Imath::V3f *source, Imath::V3f *dest, size_t numElements, const Imath::M44f &matrix )
+{
+	for( size_t i = 0; i < numElements; i++ )
+	{
+		*(dest++) = *(source++) * matrix;
+	}
+}
+
+void transformVectorsScalar( const Imath::V3f *source, Imath::V3f *dest, size_t numElements, const Imath::M44f &matrix )
+{
+	for( size_t i = 0; i < numElements; i++ )
+	{
+		matrix.multDirMatrix( *(source++), *(dest++) );
+	}
+}
+
+#ifdef PRIMITIVEALGO_HAVE_AVX2
+
+// Loads 8 consecutive V3fs and deinterleaves them into separate
+// x, y and z registers.
+__attribute__(( target( "avx2" ) )) inline void loadV3f8( const Imath::V3f *source, __m256 &x, __m256 &y, __m256 &z )
+{
+	const float *f = source->getValue();
+	__m256 m03 = _mm256_castps128_ps256( _mm_loadu_ps( f ) );
+	__m256 m14 = _mm256_castps128_ps256( _mm_loadu_ps( f + 4 ) );
+	__m256 m25 = _mm256_castps128_ps256( _mm_loadu_ps( f + 8 ) );
+	m03 = _mm256_insertf128_ps( m03, _mm_loadu_ps( f + 12 ), 1 );
+	m14 = _mm256_insertf128_ps( m14, _mm_loadu_ps( f + 16 ), 1 );
+	m25 = _mm256_insertf128_ps( m25, _mm_loadu_ps( f + 20 ), 1 );
+
+	const __m256 xy = _mm256_shuffle_ps( m14, m25, _MM_SHUFFLE( 2, 1, 3, 2 ) );
+	const __m256 yz = _mm256_shuffle_ps( m03, m14, _MM_SHUFFLE( 1, 0, 2, 1 ) );
+	x = _mm256_shuffle_ps( m03, xy, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+	y = _mm256_shuffle_ps( yz, xy, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+	z = _mm256_shuffle_ps( yz, m25, _MM_SHUFFLE( 3, 0, 3, 1 ) );
+}
+
+// Inverse of `loadV3f8()`.
+__attribute__(( target( "avx2" ) )) inline void storeV3f8( Imath::V3f *dest, __m256 x, __m256 y, __m256 z )
+{
+	const __m256 rxy = _mm256_shuffle_ps( x, y, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+	const __m256 ryz = _mm256_shuffle_ps( y, z, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+	const __m256 rzx = _mm256_shuffle_ps( z, x, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+
+	const __m256 r03 = _mm256_shuffle_ps( rxy, rzx, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+	const __m256 r14 = _mm256_shuffle_ps( ryz, rxy, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+	const __m256 r25 = _mm256_shuffle_ps( rzx, ryz, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+
+	float *f = dest->getValue();
+	_mm_storeu_ps( f, _mm256_castps256_ps128( r03 ) );
+	_mm_storeu_ps( f + 4, _mm256_castps256_ps128( r14 ) );
+	_mm_storeu_ps( f + 8, _mm256_castps256_ps128( r25 ) );
+	_mm_storeu_ps( f + 12, _mm256_extractf128_ps( r03, 1 ) );
+	_mm_storeu_ps( f + 16, _mm256_extractf128_ps( r14, 1 ) );
+	_mm_storeu_ps( f + 20, _mm256_extractf128_ps( r25, 1 ) );
+}
+
+// Computes one column of `v * m`, matching the order of operations in Imath.
+template<bool Point>
+__attribute__(( target( "avx2" ) )) inline __m256 transformColumn( __m256 x, __m256 y, __m256 z, const __m256 m[4][4], int column )
+{
+	__m256 r = _mm256_add_ps(
+		_mm256_add_ps( _mm256_mul_ps( x, m[0][column] ), _mm256_mul_ps( y, m[1][column] ) ),
+		_mm256_mul_ps( z, m[2][column] )
+	);
+	if constexpr( Point )
+	{
+		r = _mm256_add_ps( r, m[3][column] );
+	}
+	return r;
+}
+
+template<bool Point>
+__attribute__(( target( "avx2" ) )) void transformAVX2( const Imath::V3f *source, Imath::V3f *dest, size_t numElements, const Imath::M44f &matrix )
+{
+	// Imath divides points by `w`. For affine matrices `w` is always 1, so
+	// we can skip the divide without changing the result.
+	const bool projective = Point && (
+		matrix[0][3] != 0.0f || matrix[1][3] != 0.0f || matrix[2][3] != 0.0f || matrix[3][3] != 1.0f
+	);
+
+	__m256 m[4][4];
+	for( int i = 0; i < 4; ++i )
+	{
+		for( int j = 0; j < 4; ++j )
+		{
+			m[i][j] = _mm256_set1_ps( matrix[i][j] );
+		}
+	}
+
+	size_t i = 0;
+	for( ; i + 8 <= numElements; i += 8 )
+	{
+		__m256 x, y, z;
+		loadV3f8( source + i, x, y, z );
+
+		__m256 a = transformColumn<Point>( x, y, z, m, 0 );
+		__m256 b = transformColumn<Point>( x, y, z, m, 1 );
+		__m256 c = transformColumn<Point>( x, y, z, m, 2 );
+		if( projective )
+		{
+			const __m256 w = transformColumn<Point>( x, y, z, m, 3 );
+			a = _mm256_div_ps( a, w );
+			b = _mm256_div_ps( b, w );
+			c = _mm256_div_ps( c, w );
+		}
+
+		storeV3f8( dest + i, a, b, c );
+	}
+
+	if constexpr( Point )
+	{
+		transformPointsScalar( source + i, dest + i, numElements - i, matrix );
+	}
+	else
+	{
+		transformVectorsScalar( source + i, dest + i, numElements - i, matrix );
+	}
+}
+
+#endif // PRIMITIVEALGO_HAVE_AVX2
+
+struct TransformKernels
+{
+	using Function = void (*)( const Imath::V3f *, Imath::V3f *, size_t, const Imath::M44f & );
+	Function points;
+	Function vectors;
+};
+
+const TransformKernels &transformKernels()
+{
+	static const TransformKernels g_kernels = [] () -> TransformKernels {
+#ifdef PRIMITIVEALGO_HAVE_AVX2
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return { transformAVX2<true>, transformAVX2<false> };
+		}
+#endif
+		return { transformPointsScalar, transformVectorsScalar };
+	}();
+	return g_kernels;
+}
+
 inline void transformPrimVarValue(
 	const Imath::V3f *source, Imath::V3f *dest, int numElements,
 	const Imath::M44f &matrix, const Imath::M44f &normalMatrix, GeometricData::Interpretation interpretation
@@ -168,24 +327,15 @@ inline void transformPrimVarValue(
 {
 	if( interpretation == GeometricData::Point )
 	{
-		for( int i = 0; i < numElements; i++ )
-		{
-			*(dest++) = *(source++) * matrix;
-		}
+		transformKernels().points( source, dest, numElements, matrix );
 	}
 	else if( interpretation == GeometricData::Vector )
 	{
-		for( int i = 0; i < numElements; i++ )
-		{
-			matrix.multDirMatrix( *(source++), *(dest++) );
-		}
+		transformKernels().vectors( source, dest, numElements, matrix );
 	}
 	else if( interpretation == GeometricData::Normal )
 	{
-		for( int i = 0; i < numElements; i++ )
-		{
-			normalMatrix.multDirMatrix( *(source++), *(dest++) );
-		}
+		transformKernels().vectors( source, dest, numElements, normalMatrix );
 	}
 	else
 	{
@@ -197,7 +347,6 @@ inline void transformPrimVarValue(
 
 }
 
-
 inline void copyElements( const Data *sourceData, size_t sourceIndex, Data *destData, size_t destIndex, size_t num, const Imath::M44f &matrix, const Imath::M44f &normalMatrix )
 {
 	IECore::dispatch( destData,
@@ -255,10 +404,7 @@ inline void copyElements( const Data *sourceData, size_t sourceIndex, Data *dest
 				}
 				else
 				{
-					for( size_t i = 0; i < num; i++ )
-					{
-						typedDest[ destIndex + i ] = typedSource[ sourceIndex + i ];
-					}
+					std::copy( typedSource.begin() + sourceIndex, typedSource.begin() + sourceIndex + num, typedDest.begin() + destIndex );
 				}
 			}
 			else
@@ -345,10 +491,20 @@ void copyIndices(
 	if( interpolationMatches( primTypeId, sourceInterp, destInterp ) )
 	{
 		// If the interpolation hasn't changed, we don't need to anything special, just translate
-		// each index.
-		for( size_t j = 0; j < numIndices; j++ )
+		// each index. We write separate loops for the indexed and unindexed cases
+		// so that the compiler can vectorise them.
+		if( sourceIndices )
 		{
-			*(destIndices++) = translateIndex( j );
+			const int *source = sourceIndices->data();
+			const int offset = dataStart;
+			for( size_t j = 0; j < numIndices; j++ )
+			{
+				destIndices[j] = source[j] + offset;
+			}
+		}
+		else
+		{
+			std::iota( destIndices, destIndices + numIndices, (int)dataStart );
 		}
 	}
 	else if( sourceInterp == PrimitiveVariable::Constant )
@@ -447,9 +603,35 @@ class MergePrimitivesMeshResult
 public:
 	using PrimitiveType = IECoreScene::MeshPrimitive;
 
+	// The information we need from each source mesh in order to allocate the
+	// result, gathered up front so that the mesh itself doesn't need to be held.
+	struct Topology
+	{
+		std::string interpolation;
+		IECore::InternedString interpolateBoundary;
+		IECore::InternedString faceVaryingLinearInterpolation;
+		IECore::InternedString triangleSubdivisionRule;
+		int numCorners;
+		int numCreases;
+		int numCreaseIds;
+	};
+
+	static Topology topology( const MeshPrimitive *mesh )
+	{
+		return {
+			mesh->interpolation(),
+			mesh->getInterpolateBoundary(),
+			mesh->getFaceVaryingLinearInterpolation(),
+			mesh->getTriangleSubdivisionRule(),
+			(int)mesh->cornerIds()->readable().size(),
+			(int)mesh->creaseLengths()->readable().size(),
+			(int)mesh->creaseIds()->readable().size()
+		};
+	}
+
 	// Initialize, and allocate storage for the topology
 	MergePrimitivesMeshResult(
-		const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives,
+		const std::vector< Topology > &topologies,
 		const std::vector< int > &totalInterpolation
 	)
 	{
@@ -459,7 +641,7 @@ public:
 		// Need to hold onto this until we pass it to the result in finalize
 		m_numVertices = totalInterpolation[ PrimitiveVariable::Vertex ];
 
-		setMeshGlobals( result.get(), primitives );
+		setMeshGlobals( result.get(), topologies );
 
 		m_resultVerticesPerFaceData = new IntVectorData;
 		m_resultVertexIdsData = new IntVectorData;
@@ -471,26 +653,24 @@ public:
 		int totalAccumCreases = 0;
 		int totalAccumCreaseIds = 0;
 
-		m_countCorners.reserve( primitives.size() );
-		m_countCreases.reserve( primitives.size() );
-		m_countCreaseIds.reserve( primitives.size() );
-		m_accumCorners.reserve( primitives.size() );
-		m_accumCreases.reserve( primitives.size() );
-		m_accumCreaseIds.reserve( primitives.size() );
+		m_countCorners.reserve( topologies.size() );
+		m_countCreases.reserve( topologies.size() );
+		m_countCreaseIds.reserve( topologies.size() );
+		m_accumCorners.reserve( topologies.size() );
+		m_accumCreases.reserve( topologies.size() );
+		m_accumCreaseIds.reserve( topologies.size() );
 
-		for( const auto & [prim, matrix] : primitives )
+		for( const Topology &topology : topologies )
 		{
-			const MeshPrimitive *mesh = static_cast< const MeshPrimitive * >( prim );
-
-			m_countCorners.push_back( mesh->cornerIds()->readable().size() );
+			m_countCorners.push_back( topology.numCorners );
 			m_accumCorners.push_back( totalAccumCorners );
 			totalAccumCorners += m_countCorners.back();
 
-			m_countCreases.push_back( mesh->creaseLengths()->readable().size() );
+			m_countCreases.push_back( topology.numCreases );
 			m_accumCreases.push_back( totalAccumCreases );
 			totalAccumCreases += m_countCreases.back();
 
-			m_countCreaseIds.push_back( mesh->creaseIds()->readable().size() );
+			m_countCreaseIds.push_back( topology.numCreaseIds );
 			m_accumCreaseIds.push_back( totalAccumCreaseIds );
 			totalAccumCreaseIds += m_countCreaseIds.back();
 		}
@@ -636,27 +816,25 @@ private:
 
 	static void setMeshGlobals(
 		MeshPrimitive *result,
-		const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives
+		const std::vector< Topology > &topologies
 	)
 	{
-		const MeshPrimitive *firstMesh = static_cast< const MeshPrimitive * >( primitives[0].first );
-		std::string meshInterpolation = firstMesh->interpolation();
-		IECore::InternedString interpolateBound = firstMesh->getInterpolateBoundary();
-		IECore::InternedString faceVaryingLI = firstMesh->getFaceVaryingLinearInterpolation();
-		IECore::InternedString triangleSub = firstMesh->getTriangleSubdivisionRule();
+		std::string meshInterpolation = topologies[0].interpolation;
+		IECore::InternedString interpolateBound = topologies[0].interpolateBoundary;
+		IECore::InternedString faceVaryingLI = topologies[0].faceVaryingLinearInterpolation;
+		IECore::InternedString triangleSub = topologies[0].triangleSubdivisionRule;
 
-		for( const auto & [prim, matrix] : primitives )
+		for( const Topology &mesh : topologies )
 		{
-			const MeshPrimitive *mesh = static_cast< const MeshPrimitive * >( prim );
 			if(
 				meshInterpolation != "" &&
-				mesh->interpolation() != meshInterpolation
+				mesh.interpolation != meshInterpolation
 			)
 			{
 				msg( Msg::Warning, "mergePrimitives",
 					fmt::format(
 						"Ignoring mismatch between mesh interpolations {} and {} and defaulting to linear",
-						meshInterpolation, mesh->interpolation()
+						meshInterpolation, mesh.interpolation
 					)
 				);
 				meshInterpolation = "";
@@ -664,13 +842,13 @@ private:
 
 			if(
 				interpolateBound != "" &&
-				mesh->getInterpolateBoundary() != interpolateBound
+				mesh.interpolateBoundary != interpolateBound
 			)
 			{
 				msg( Msg::Warning, "mergePrimitives",
 					fmt::format(
 						"Ignoring mismatch between mesh interpolate bound {} and {} and defaulting to edgeAndCorner",
-						interpolateBound.string(), mesh->getInterpolateBoundary().string()
+						interpolateBound.string(), mesh.interpolateBoundary.string()
 					)
 				);
 				interpolateBound = "";
@@ -678,13 +856,13 @@ private:
 
 			if(
 				faceVaryingLI != "" &&
-				mesh->getFaceVaryingLinearInterpolation() != faceVaryingLI
+				mesh.faceVaryingLinearInterpolation != faceVaryingLI
 			)
 			{
 				msg( Msg::Warning, "mergePrimitives",
 					fmt::format(
 						"Ignoring mismatch between mesh face varying linear interpolation {} and {} and defaulting to cornersPlus1",
-						faceVaryingLI.string(), mesh->getFaceVaryingLinearInterpolation().string()
+						faceVaryingLI.string(), mesh.faceVaryingLinearInterpolation.string()
 					)
 				);
 				faceVaryingLI = "";
@@ -692,13 +870,13 @@ private:
 
 			if(
 				triangleSub != "" &&
-				mesh->getTriangleSubdivisionRule() != triangleSub
+				mesh.triangleSubdivisionRule != triangleSub
 			)
 			{
 				msg( Msg::Warning, "mergePrimitives",
 					fmt::format(
 						"Ignoring mismatch between mesh triangle subdivision rule {} and {} and defaulting to catmullClark",
-						triangleSub.string(), mesh->getTriangleSubdivisionRule().string()
+						triangleSub.string(), mesh.triangleSubdivisionRule.string()
 					)
 				);
 				triangleSub = "";
@@ -754,9 +932,20 @@ class MergePrimitivesCurvesResult
 public:
 	using PrimitiveType = IECoreScene::CurvesPrimitive;
 
+	struct Topology
+	{
+		CubicBasisf basis;
+		bool periodic;
+	};
+
+	static Topology topology( const CurvesPrimitive *curves )
+	{
+		return { curves->basis(), curves->periodic() };
+	}
+
 	// Initialize, and allocate storage for the topology
 	MergePrimitivesCurvesResult(
-		const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives,
+		const std::vector< Topology > &topologies,
 		const std::vector< int > &totalInterpolation
 	)
 	{
@@ -765,7 +954,7 @@ public:
 		m_resultVerticesPerCurveData = new IntVectorData;
 		m_resultVerticesPerCurveData->writable().resize( totalInterpolation[ PrimitiveVariable::Uniform ] );
 
-		setCurvesGlobals( result.get(), primitives );
+		setCurvesGlobals( result.get(), topologies );
 	}
 
 	// This must be called once for each source primitive
@@ -835,26 +1024,24 @@ private:
 
 	static void setCurvesGlobals(
 		CurvesPrimitive *result,
-		const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives
+		const std::vector< Topology > &topologies
 	)
 	{
-		const CurvesPrimitive *firstCurves = static_cast< const CurvesPrimitive * >( primitives[0].first );
-		CubicBasisf basis = firstCurves->basis();
-		bool periodic = firstCurves->periodic();
+		CubicBasisf basis = topologies[0].basis;
+		bool periodic = topologies[0].periodic;
 
 		static const CubicBasisf invalidBasis( Imath::M44f( 0.0f ), 0 );
 
-		for( const auto & [prim, matrix] : primitives )
+		for( const Topology &curves : topologies )
 		{
-			const CurvesPrimitive *curves = static_cast< const CurvesPrimitive * >( prim );
-			if( curves->periodic() != periodic )
+			if( curves.periodic != periodic )
 			{
 				throw IECore::Exception( "Cannot merge periodic and non-periodic curves" );
 			}
 
 			if(
 				basis != invalidBasis &&
-				curves->basis() != basis
+				curves.basis != basis
 			)
 			{
 				msg( Msg::Warning, "mergePrimitives",
@@ -883,20 +1070,33 @@ class MergePrimitivesPointsResult
 public:
 	using PrimitiveType = IECoreScene::PointsPrimitive;
 
+	struct Topology
+	{
+		std::string type;
+		bool hasType;
+	};
+
+	static Topology topology( const PointsPrimitive *points )
+	{
+		const StringData *typeData = points->variableData<StringData>( pointTypeName );
+		return { typeData ? typeData->readable() : defaultPointType, (bool)typeData };
+	}
+
 	MergePrimitivesPointsResult(
-		const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives,
+		const std::vector< Topology > &topologies,
 		const std::vector< int > &totalInterpolation
 	)
 	{
 		result = new IECoreScene::PointsPrimitive( totalInterpolation[ PrimitiveVariable::Vertex ] );
 
 		bool hasType = false;
-		std::string type = pointsType( primitives[0].first, hasType );
+		std::string type = topologies[0].type;
 
-		for( const auto & [prim, matrix] : primitives )
+		for( const Topology &points : topologies )
 		{
+			hasType |= points.hasType;
 
-			const std::string &curType = pointsType( prim, hasType );
+			const std::string &curType = points.type;
 			if( curType != type )
 			{
 				msg( Msg::Warning, "mergePrimitives",
@@ -942,36 +1142,196 @@ public:
 
 	IECoreScene::PointsPrimitivePtr result;
 
-private:
+};
+
+// There isn't a MaxInterpolation enum, but we don't expect this list to change, and can double check
+// the current maximum
+const int numInterpolations = 6;
+
+// The information we need about each primitive variable of a source primitive in order to
+// allocate the merged result.
+struct VariableSummary
+{
+	IECore::InternedString name;
+	PrimitiveVariable::Interpolation interpolation;
+	IECore::TypeId dataTypeId;
+	// The type of the merged data, with Constant variables promoted to vectors. InvalidTypeId
+	// if the variable can't be promoted.
+	IECore::TypeId vectorTypeId;
+	GeometricData::Interpretation interpretation;
+	size_t size;
+	bool indexed;
+};
 
-	const std::string &pointsType( const IECoreScene::Primitive* points, bool &hasType )
+// The type specific topology globals of a source primitive. The alternative held also
+// identifies which kind of result the source can be merged into.
+using TopologySummary = std::variant<
+	std::monostate,
+	MergePrimitivesMeshResult::Topology,
+	MergePrimitivesCurvesResult::Topology,
+	MergePrimitivesPointsResult::Topology
+>;
+
+TopologySummary topologySummary( const Primitive *prim )
+{
+	if( auto mesh = IECore::runTimeCast<const MeshPrimitive>( prim ) )
 	{
-		const StringData *typeData = points->variableData<StringData>( pointTypeName );
-		if( typeData )
+		return MergePrimitivesMeshResult::topology( mesh );
+	}
+	else if( auto curves = IECore::runTimeCast<const CurvesPrimitive>( prim ) )
+	{
+		return MergePrimitivesCurvesResult::topology( curves );
+	}
+	else if( auto points = IECore::runTimeCast<const PointsPrimitive>( prim ) )
+	{
+		return MergePrimitivesPointsResult::topology( points );
+	}
+
+	throw IECore::Exception( fmt::format(
+		"Unsupported Primitive type for merging: {}", prim->typeName()
+	) );
+}
+
+// The information we need about each source primitive in order to allocate the merged result.
+// Gathering this up front means that we don't need to hold all of the sources at once.
+struct PrimitiveSummary
+{
+	bool valid = false;
+	IECore::TypeId typeId = IECore::InvalidTypeId;
+	std::array<int, numInterpolations> variableSizes;
+	std::vector<VariableSummary> variables;
+	TopologySummary topology;
+
+	const VariableSummary *variable( const IECore::InternedString &name ) const
+	{
+		for( const auto &v : variables )
 		{
-			hasType = true;
-			return typeData->readable();
+			if( v.name == name )
+			{
+				return &v;
+			}
 		}
-		return defaultPointType;
+		return nullptr;
 	}
-
 };
 
+// Summarises each source in parallel, returning the summaries for the sources that weren't
+// skipped, and their indices in `sourceIndices`. We release each source as soon as we're done
+// with it, so if the sources are being computed on demand, we never hold more than a few at a
+// time. The result type is also determined here, so that no source needs to be fetched
+// serially up front.
+std::vector<PrimitiveSummary> summarisePrimitives(
+	size_t numSources, const PrimitiveAlgo::PrimitiveSource &source,
+	std::vector<size_t> &sourceIndices, const IECore::Canceller *canceller
+)
+{
+	assert( PrimitiveVariable::Constant < numInterpolations );
+	assert( PrimitiveVariable::Uniform < numInterpolations );
+	assert( PrimitiveVariable::Vertex < numInterpolations );
+	assert( PrimitiveVariable::Varying < numInterpolations );
+	assert( PrimitiveVariable::FaceVarying < numInterpolations );
+
+	std::vector<PrimitiveSummary> summaries( numSources );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, numSources ),
+		[&]( tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); i++ )
+			{
+				Canceller::check( canceller );
+				const IECoreScene::ConstPrimitivePtr prim = source( i ).first;
+				if( !prim )
+				{
+					continue;
+				}
+
+				PrimitiveSummary &summary = summaries[i];
+				summary.valid = true;
+				summary.typeId = prim->typeId();
+				summary.topology = topologySummary( prim.get() );
+				for( int interpolation = 0; interpolation < numInterpolations; interpolation++ )
+				{
+					summary.variableSizes[interpolation] = prim->variableSize( (PrimitiveVariable::Interpolation)interpolation );
+				}
+
+				summary.variables.reserve( prim->variables.size() );
+				for( const auto &[name, var] : prim->variables )
+				{
+					IECore::TypeId vectorTypeId = var.data->typeId();
+					if( var.interpolation == PrimitiveVariable::Constant )
+					{
+						vectorTypeId = vectorDataTypeFromDataType( var.data.get() );
+					}
+
+					summary.variables.push_back( {
+						name, var.interpolation, var.data->typeId(), vectorTypeId,
+						IECore::getGeometricInterpretation( var.data.get() ),
+						vectorTypeId != IECore::InvalidTypeId ? IECore::size( var.data.get() ) : 0,
+						(bool)var.indices
+					} );
+				}
+			}
+		},
+		tbb::auto_partitioner(),
+		taskGroupContext
+	);
+
+	// Compact the summaries to remove any sources that were skipped, and check that
+	// all the rest can be merged into the same type of result as the first.
+
+	sourceIndices.reserve( numSources );
+	for( size_t i = 0; i < numSources; i++ )
+	{
+		if( !summaries[i].valid )
+		{
+			continue;
+		}
+
+		const size_t j = sourceIndices.size();
+		if( j && summaries[i].topology.index() != summaries[0].topology.index() )
+		{
+			throw IECore::Exception( fmt::format(
+				"Primitive type mismatch: Cannot merge {} with {}",
+				IECore::RunTimeTyped::typeNameFromTypeId( summaries[i].typeId ),
+				IECore::RunTimeTyped::typeNameFromTypeId( summaries[0].typeId )
+			) );
+		}
+
+		if( j != i )
+		{
+			summaries[j] = std::move( summaries[i] );
+		}
+		sourceIndices.push_back( i );
+	}
+
+	summaries.resize( sourceIndices.size() );
+	return summaries;
+}
+
 template<class ResultStruct>
 IECoreScene::PrimitivePtr mergePrimitivesInternal(
-	const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives,
-	const IECore::Canceller *canceller
+	const PrimitiveAlgo::PrimitiveSource &source, const std::vector<size_t> &sourceIndices,
+	const std::vector<PrimitiveSummary> &summaries, const IECore::Canceller *canceller
 )
 {
-	if( primitives.size() == 1 )
+	using PrimitiveType = typename ResultStruct::PrimitiveType;
+	using Topology = typename ResultStruct::Topology;
+
+	IECoreScene::TypeId resultTypeId = (IECoreScene::TypeId)PrimitiveType::staticTypeId();
+
+	std::vector<Topology> topologies;
+	topologies.reserve( summaries.size() );
+	for( const PrimitiveSummary &summary : summaries )
 	{
-		// If we have a single input, we just need to transform it
-		IECoreScene::PrimitivePtr result = primitives[0].first->copy();
-		PrimitiveAlgo::transformPrimitive( *result, primitives[0].second, canceller );
-		return result;
+		topologies.push_back( std::get<Topology>( summary.topology ) );
 	}
 
-	IECoreScene::TypeId resultTypeId = (IECoreScene::TypeId)ResultStruct::PrimitiveType::staticTypeId();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	const size_t numPrimitives = sourceIndices.size();
 
 	// Data we need to store for each primvar we output
 	struct PrimVarInfo
@@ -1003,44 +1363,23 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 
 	std::unordered_map< IECore::InternedString, PrimVarInfo > varInfos;
 
-	for( const auto & [prim, matrix] : primitives )
-	{
-		if( !prim )
-		{
-			throw IECore::Exception( "Cannot merge null Primitive" );
-		}
-
-		// We already have a primitive, so the types must match
-		if( !IECore::runTimeCast< const typename ResultStruct::PrimitiveType >( prim ) )
-		{
-			throw IECore::Exception( fmt::format(
-				"Primitive type mismatch: Cannot merge {} with {}",
-				prim->typeName(), ResultStruct::PrimitiveType::staticTypeName()
-			) );
-		}
-	}
-
 	//
 	// Before we can even start counting the sizes of things, we need to gather information about what
 	// kinds of primitives and primvars we're dealing with.
 	//
 
-	for( const auto & [prim, matrix] : primitives )
+	for( const PrimitiveSummary &summary : summaries )
 	{
 		// Process all the primvars for this primitive, adding new entries to the varInfo list, or
 		// checking that existing entries match correctly
-		for( const auto &[name, var] : prim->variables )
+		for( const VariableSummary &var : summary.variables )
 		{
-			GeometricData::Interpretation interpretation = IECore::getGeometricInterpretation( var.data.get() );
-
-			IECore::TypeId varTypeId = var.data->typeId();
+			const IECore::InternedString &name = var.name;
+			GeometricData::Interpretation interpretation = var.interpretation;
 
-			if( var.interpolation == PrimitiveVariable::Constant )
-			{
-				varTypeId = vectorDataTypeFromDataType( var.data.get() );
-			}
+			IECore::TypeId varTypeId = var.vectorTypeId;
 
-			PrimVarInfo &varInfo = varInfos.try_emplace( name, var.interpolation, varTypeId, interpretation, primitives.size() ).first->second;
+			PrimVarInfo &varInfo = varInfos.try_emplace( name, var.interpolation, varTypeId, interpretation, numPrimitives ).first->second;
 
 			if( varInfo.interpolation == PrimitiveVariable::Invalid )
 			{
@@ -1052,7 +1391,7 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 				msg( Msg::Warning, "mergePrimitives",
 					fmt::format(
 						"Discarding variable \"{}\" - Cannot promote Constant primitive variable of type \"{}\".",
-						std::string( name ), var.data->typeName()
+						std::string( name ), IECore::RunTimeTyped::typeNameFromTypeId( var.dataTypeId )
 					)
 				);
 				varInfo.interpolation = PrimitiveVariable::Invalid;
@@ -1066,7 +1405,7 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 						"Discarding variable \"{}\" - types don't match: \"{}\" and \"{}\"",
 						name,
 						IECore::RunTimeTyped::typeNameFromTypeId( varInfo.typeId ),
-						IECore::RunTimeTyped::typeNameFromTypeId( var.data->typeId() )
+						IECore::RunTimeTyped::typeNameFromTypeId( var.dataTypeId )
 					)
 				);
 				varInfo.interpolation = PrimitiveVariable::Invalid;
@@ -1121,12 +1460,12 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 		// We also need to count the amount of data for this primvar contributed by each primitive.
 
 		bool incomplete = false;
-		for( unsigned int i = 0; i < primitives.size(); i++ )
+		for( unsigned int i = 0; i < numPrimitives; i++ )
 		{
 
-			auto it = primitives[i].first->variables.find( name );
+			const VariableSummary *var = summaries[i].variable( name );
 
-			if( it == primitives[i].first->variables.end() )
+			if( !var )
 			{
 				// This primitive doesn't have this primvar, we'll just write one data element
 				// that will be left uninitialized.
@@ -1142,11 +1481,11 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 				continue;
 			}
 
-			varInfo.numData[i] = IECore::size( it->second.data.get() );
+			varInfo.numData[i] = var->size;
 
 			// Only if everything is simple and matches can we skip outputting indices ( though this
 			// is hopefully the most common case )
-			if( it->second.indices || !interpolationMatches( resultTypeId, it->second.interpolation, varInfo.interpolation ) )
+			if( var->indexed || !interpolationMatches( resultTypeId, var->interpolation, varInfo.interpolation ) )
 			{
 				varInfo.indexed = true;
 			}
@@ -1170,15 +1509,6 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	// all variables to collect which interpolations are used ).
 	//
 
-	// There isn't a MaxInterpolation enum, but we don't expect this list to change, and can double check
-	// the current maximum
-	const int numInterpolations = 6;
-	assert( PrimitiveVariable::Constant < numInterpolations );
-	assert( PrimitiveVariable::Uniform < numInterpolations );
-	assert( PrimitiveVariable::Vertex < numInterpolations );
-	assert( PrimitiveVariable::Varying < numInterpolations );
-	assert( PrimitiveVariable::FaceVarying < numInterpolations );
-
 	std::vector< std::vector<int> > countInterpolation( numInterpolations );
 	std::vector< int > totalInterpolation( numInterpolations );
 	std::vector< std::vector<int> > accumInterpolation( numInterpolations );
@@ -1186,12 +1516,12 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	for( int interpolation = 0; interpolation < numInterpolations; interpolation++ )
 	{
 		int accum = 0;
-		countInterpolation[interpolation].reserve( primitives.size() );
-		accumInterpolation[interpolation].reserve( primitives.size() );
-		for( unsigned int i = 0; i < primitives.size(); i++ )
+		countInterpolation[interpolation].reserve( numPrimitives );
+		accumInterpolation[interpolation].reserve( numPrimitives );
+		for( unsigned int i = 0; i < numPrimitives; i++ )
 		{
-			countInterpolation[interpolation].push_back( primitives[i].first->variableSize( ((PrimitiveVariable::Interpolation)interpolation) ) );
-			accumInterpolation[interpolation][i] = accum;
+			countInterpolation[interpolation].push_back( summaries[i].variableSizes[interpolation] );
+			accumInterpolation[interpolation].push_back( accum );
 			accum += countInterpolation[interpolation].back();
 		}
 		totalInterpolation[interpolation] = accum;
@@ -1201,7 +1531,7 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	// Allocate the result, together with any topology information needed
 	//
 
-	ResultStruct result( primitives, totalInterpolation );
+	ResultStruct result( topologies, totalInterpolation );
 
 	//
 	// Allocate storage for the primitives variables
@@ -1252,17 +1582,23 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	// also is completely unnecessary ). There's probably not much point threading this further until we fix
 	// that.
 
-	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	// Sources are fetched again here rather than being held since the summary pass, so that
+	// each one can be released as soon as it has been copied.
 
 	tbb::parallel_for(
-		tbb::blocked_range<size_t>( 0, primitives.size() ),
+		tbb::blocked_range<size_t>( 0, numPrimitives ),
 		[&]( tbb::blocked_range<size_t> &range )
 		{
 			for( size_t i = range.begin(); i != range.end(); i++ )
 			{
-				const Primitive &sourcePrim = *primitives[i].first;
+				Canceller::check( canceller );
+				const auto &[sourcePrimPtr, matrix] = source( sourceIndices[i] );
+				if( !sourcePrimPtr )
+				{
+					throw IECore::Exception( "Primitive source returned inconsistent results" );
+				}
 
-				const Imath::M44f &matrix = primitives[i].second;
+				const Primitive &sourcePrim = *sourcePrimPtr;
 				const Imath::M44f normalMatrix = normalTransform( matrix );
 
 				// Copy the data ( and indices ) for each prim var for this primitive into
@@ -1325,7 +1661,7 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 				// using a type specific function
 
 				result.copyFromSource(
-					static_cast< const typename ResultStruct::PrimitiveType * >( primitives[i].first ), i,
+					static_cast< const PrimitiveType * >( &sourcePrim ), i,
 					countInterpolation, accumInterpolation, canceller
 				);
 			}
@@ -1340,12 +1676,6 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	return result.result;
 }
 
-// Why isn't this a static in RunTimeTyped?
-bool isInstanceOf( IECore::TypeId type, IECore::TypeId baseType )
-{
-	return type == baseType || RunTimeTyped::inheritsFrom( type, baseType );
-}
-
 } // namespace
 
 
@@ -1418,28 +1748,56 @@ IECoreScene::PrimitivePtr PrimitiveAlgo::mergePrimitives(
 		throw IECore::Exception( "mergePrimitives requires at least one primitive" );
 	}
 
-	if( !primitives[0].first )
+	for( const auto &[prim, matrix] : primitives )
 	{
-		throw IECore::Exception( "Cannot merge null Primitive" );
+		if( !prim )
+		{
+			throw IECore::Exception( "Cannot merge null Primitive" );
+		}
 	}
 
-	IECore::TypeId resultTypeId = primitives[0].first->typeId();
-	if( isInstanceOf( resultTypeId, (IECore::TypeId)IECoreScene::MeshPrimitiveTypeId ) )
-	{
-		return mergePrimitivesInternal<MergePrimitivesMeshResult>( primitives, canceller );
-	}
-	else if( isInstanceOf( resultTypeId, (IECore::TypeId)IECoreScene::CurvesPrimitiveTypeId ) )
+	return mergePrimitives(
+		primitives.size(),
+		[&primitives] ( size_t i ) {
+			return std::make_pair( IECoreScene::ConstPrimitivePtr( primitives[i].first ), primitives[i].second );
+		},
+		canceller
+	);
+}
+
+IECoreScene::PrimitivePtr PrimitiveAlgo::mergePrimitives(
+	size_t numPrimitives, const PrimitiveSource &source,
+	const IECore::Canceller *canceller
+)
+{
+	std::vector<size_t> sourceIndices;
+	const std::vector<PrimitiveSummary> summaries = summarisePrimitives( numPrimitives, source, sourceIndices, canceller );
+
+	if( sourceIndices.empty() )
 	{
-		return mergePrimitivesInternal<MergePrimitivesCurvesResult>( primitives, canceller );
+		return nullptr;
 	}
-	else if( isInstanceOf( resultTypeId, (IECore::TypeId)IECoreScene::PointsPrimitiveTypeId ) )
+	else if( sourceIndices.size() == 1 )
 	{
-		return mergePrimitivesInternal<MergePrimitivesPointsResult>( primitives, canceller );
+		// If we have a single input, we just need to transform it
+		const auto &[prim, matrix] = source( sourceIndices[0] );
+		if( !prim )
+		{
+			throw IECore::Exception( "Primitive source returned inconsistent results" );
+		}
+		IECoreScene::PrimitivePtr result = prim->copy();
+		transformPrimitive( *result, matrix, canceller );
+		return result;
 	}
-	else
+
+	switch( summaries[0].topology.index() )
 	{
-		throw IECore::Exception( fmt::format(
-			"Unsupported Primitive type for merging: {}", primitives[0].first->typeId()
-		) );
+		case 1 :
+			return mergePrimitivesInternal<MergePrimitivesMeshResult>( source, sourceIndices, summaries, canceller );
+		case 2 :
+			return mergePrimitivesInternal<MergePrimitivesCurvesResult>( source, sourceIndices, summaries, canceller );
+		default :
+			assert( summaries[0].topology.index() == 3 );
+			return mergePrimitivesInternal<MergePrimitivesPointsResult>( source, sourceIndices, summaries, canceller );
 	}
 }
@@ -36,9 +36,17 @@
 
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 
+#include "IECore/DataAlgo.h"
 #include "IECore/Exception.h"
+#include "IECore/GeometricTypedData.h"
+#include "IECore/VectorTypedData.h"
+
+#include "tbb/parallel_for.h"
+
+#include <charconv>
 
 using namespace std;
+using namespace IECore;
 using namespace IECoreScenePreview;
 
 //////////////////////////////////////////////////////////////////////////
@@ -63,6 +71,91 @@ CreatorMap &creators()
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Default implementation of `Renderer::instances()`
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Extracts a single element from a per-instance attribute array.
+struct InstanceAttribute
+{
+
+	template<typename T>
+	DataPtr operator()( const TypedData<vector<T>> *data, size_t index )
+	{
+		return new TypedData<T>( data->readable()[index] );
+	}
+
+	template<typename T>
+	DataPtr operator()( const GeometricTypedData<vector<T>> *data, size_t index )
+	{
+		return new GeometricTypedData<T>( data->readable()[index], data->getInterpretation() );
+	}
+
+	DataPtr operator()( const Data *data, size_t index )
+	{
+		throw IECore::InvalidArgumentException( "Expected VectorTypedData" );
+	}
+
+};
+
+class InstancesInterface : public Renderer::ObjectInterface
+{
+
+	public :
+
+		InstancesInterface( size_t size )
+			:	objects( size )
+		{
+		}
+
+		void transform( const Imath::M44f &transform ) override
+		{
+			throw IECore::NotImplementedException( "Renderer::instances() : Transform edits are not supported" );
+		}
+
+		void transform( const std::vector<Imath::M44f> &samples, const std::vector<float> &times ) override
+		{
+			throw IECore::NotImplementedException( "Renderer::instances() : Transform edits are not supported" );
+		}
+
+		bool attributes( const Renderer::AttributesInterface *attributes ) override
+		{
+			return false;
+		}
+
+		void link( const IECore::InternedString &type, const Renderer::ConstObjectSetPtr &objects ) override
+		{
+			for( auto &o : this->objects )
+			{
+				if( o )
+				{
+					o->link( type, objects );
+				}
+			}
+		}
+
+		void assignID( uint32_t id ) override
+		{
+			for( auto &o : objects )
+			{
+				if( o )
+				{
+					o->assignID( id );
+				}
+			}
+		}
+
+		std::vector<Renderer::ObjectInterfacePtr> objects;
+
+};
+
+IE_CORE_DECLAREPTR( InstancesInterface )
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // Renderer
 //////////////////////////////////////////////////////////////////////////
@@ -82,6 +175,117 @@ Renderer::ObjectInterfacePtr Renderer::camera( const std::string &name,  const s
 	return camera( name, samples[0], attributes );
 }
 
+bool Renderer::supportsInstances() const
+{
+	return false;
+}
+
+Renderer::ObjectInterfacePtr Renderer::instances( const std::string &name, const InstanceArray &instances )
+{
+	const size_t numInstances = instances.size();
+	const size_t numTransformSamples = std::max<size_t>( instances.transformTimes.size(), 1 );
+	const size_t numTransforms = instances.transforms ? instances.transforms->size() : 0;
+	if( numTransforms != numInstances * numTransformSamples )
+	{
+		throw IECore::Exception( "Renderer::instances() : Wrong number of transforms" );
+	}
+	if( instances.ids && instances.ids->size() != numInstances )
+	{
+		throw IECore::Exception( "Renderer::instances() : Wrong number of ids" );
+	}
+
+	const std::string prefix = name.empty() ? "" : name + "/";
+	InstancesInterfacePtr result = new InstancesInterface( numInstances );
+
+	// Limit parallelism, since many renderers don't scale well when
+	// creating objects from many threads at once.
+	const size_t grainSize = std::max<size_t>( 1, numInstances / 32 );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, numInstances, grainSize ),
+		[&] ( const tbb::blocked_range<size_t> &range )
+		{
+			std::string instanceName;
+			std::vector<Imath::M44f> transformSamples( numTransformSamples );
+			AttributesInterfacePtr instanceAttributes;
+
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				const int prototypeIndex = (*instances.prototypeIndices)[i];
+				if( prototypeIndex < 0 )
+				{
+					continue;
+				}
+
+				const InstanceArray::Prototype &prototype = instances.prototypes.at( prototypeIndex );
+				if( prototype.samples.empty() )
+				{
+					continue;
+				}
+
+				const AttributesInterface *attributes = prototype.rendererAttributes;
+				if( instances.attributes.size() || !attributes )
+				{
+					CompoundObjectPtr a = new CompoundObject;
+					if( prototype.attributes )
+					{
+						// Referencing the prototype's members without copying them
+						// is safe, because we only add members and never modify them.
+						a->members() = prototype.attributes->members();
+					}
+					for( const auto &[attributeName, data] : instances.attributes )
+					{
+						a->members()[attributeName] = dispatch( data.get(), InstanceAttribute(), i );
+					}
+					instanceAttributes = this->attributes( a.get() );
+					attributes = instanceAttributes.get();
+				}
+
+				const int64_t id = instances.ids ? (*instances.ids)[i] : i;
+				instanceName = prefix;
+				instanceName += prototype.name;
+				instanceName += '/';
+				const size_t idStart = instanceName.size();
+				instanceName.resize( idStart + std::numeric_limits<int64_t>::digits10 + 2 );
+				instanceName.resize( std::to_chars( &instanceName[idStart], instanceName.data() + instanceName.size(), id ).ptr - instanceName.data() );
+
+				ObjectInterfacePtr objectInterface;
+				if( prototype.sampleTimes.size() )
+				{
+					objectInterface = object( instanceName, prototype.samples, prototype.sampleTimes, attributes );
+				}
+				else
+				{
+					objectInterface = object( instanceName, prototype.samples[0], attributes );
+				}
+
+				if( !objectInterface )
+				{
+					continue;
+				}
+
+				if( numTransformSamples == 1 )
+				{
+					objectInterface->transform( (*instances.transforms)[i] );
+				}
+				else
+				{
+					for( size_t s = 0; s < numTransformSamples; ++s )
+					{
+						transformSamples[s] = (*instances.transforms)[s * numInstances + i];
+					}
+					objectInterface->transform( transformSamples, instances.transformTimes );
+				}
+
+				result->objects[i] = objectInterface;
+			}
+		},
+		taskGroupContext
+	);
+
+	return result;
+}
+
 IECore::DataPtr Renderer::command( const IECore::InternedString name, const IECore::CompoundDataMap &parameters )
 {
 	throw IECore::NotImplementedException( "Renderer::command" );
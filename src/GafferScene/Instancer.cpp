@@ -730,6 +730,12 @@ class Instancer::EngineData : public Data
 			h.append( (uint64_t)pointIndex );
 		}
 
+		// The data used to create the attributes, indexed by point.
+		const CompoundDataMap &instanceAttributeArrays() const
+		{
+			return m_attributeArrays;
+		}
+
 		void instanceAttributes( size_t pointIndex, CompoundObject &result ) const
 		{
 			CompoundObject::ObjectMap &writableResult = result.members();
@@ -871,19 +877,21 @@ class Instancer::EngineData : public Data
 
 		using AttributeCreator = std::function<DataPtr ( size_t )>;
 
+		// The creators reference the data directly rather than taking a copy, so
+		// the data must be kept alive in `m_attributeArrays`.
 		struct MakeAttributeCreator
 		{
 
 			template<typename T>
 			AttributeCreator operator()( const TypedData<vector<T>> *data )
 			{
-				return std::bind( &createAttribute<T>, data->readable(), std::placeholders::_1 );
+				return std::bind( &createAttribute<T>, &data->readable(), std::placeholders::_1 );
 			}
 
 			template<typename T>
 			AttributeCreator operator()( const GeometricTypedData<vector<T>> *data )
 			{
-				return std::bind( &createGeometricAttribute<T>, data->readable(), data->getInterpretation(), std::placeholders::_1 );
+				return std::bind( &createGeometricAttribute<T>, &data->readable(), data->getInterpretation(), std::placeholders::_1 );
 			}
 
 			AttributeCreator operator()( const Data *data )
@@ -894,15 +902,15 @@ class Instancer::EngineData : public Data
 			private :
 
 				template<typename T>
-				static DataPtr createAttribute( const vector<T> &values, size_t index )
+				static DataPtr createAttribute( const vector<T> *values, size_t index )
 				{
-					return new TypedData<T>( values[index] );
+					return new TypedData<T>( (*values)[index] );
 				}
 
 				template<typename T>
-				static DataPtr createGeometricAttribute( const vector<T> &values, GeometricData::Interpretation interpretation, size_t index )
+				static DataPtr createGeometricAttribute( const vector<T> *values, GeometricData::Interpretation interpretation, size_t index )
 				{
-					return new GeometricTypedData<T>( values[index], interpretation );
+					return new GeometricTypedData<T>( (*values)[index], interpretation );
 				}
 
 		};
@@ -930,6 +938,7 @@ class Instancer::EngineData : public Data
 				DataPtr d = primVar.second.expandedData();
 				AttributeCreator attributeCreator = dispatch( d.get(), MakeAttributeCreator() );
 				m_attributeCreators[attributePrefix + primVar.first] = attributeCreator;
+				m_attributeArrays[attributePrefix + primVar.first] = d;
 				m_attributesHash.append( primVar.first );
 				d->hash( m_attributesHash );
 			}
@@ -1095,6 +1104,7 @@ class Instancer::EngineData : public Data
 		IdsToPointIndices m_idsToPointIndices;
 
 		boost::container::flat_map<InternedString, AttributeCreator> m_attributeCreators;
+		CompoundDataMap m_attributeArrays;
 		MurmurHash m_attributesHash;
 
 		const std::vector< PrototypeContextVariable > m_prototypeContextVariables;
@@ -3036,6 +3046,11 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 	task_group_context taskGroupContext( task_group_context::isolated );
 	const ThreadState &threadState = ThreadState::current();
 
+	// Output the instances as a single array if the renderer supports it natively.
+	// Otherwise we stream them individually, which avoids building large
+	// per-instance arrays only for `Renderer::instances()` to expand them again.
+	const bool useInstanceArray = !engines[0]->hasContextVariables() && renderer->supportsInstances();
+
 	// fixedPrototypes is used when the prototypes don't depend on context
 	std::vector<ConstPrototypePtr> fixedPrototypes;
 	if( !engines[0]->hasContextVariables() )
@@ -3053,8 +3068,10 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 					fixedPrototypes[i] = new Prototype(
 						prototypesPlug, engines[0]->prototypeRoot( i ), sampleTimes, outerCapsuleHash, renderOpts,
 						threadScope.context(), renderer,
-						// If we don't have instance attributes, we can prepare renderer attributes ahead of time
-						!hasAttributes
+						// If we don't have instance attributes, we can prepare renderer attributes
+						// ahead of time. Renderers with native instancing always need them, since
+						// they apply per-instance attributes on top.
+						useInstanceArray || !hasAttributes
 					);
 
 				}
@@ -3087,7 +3104,84 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 	);
 
 	// ============================================================================
-	// Output the instances
+	// Output the instances as an array, if the renderer supports it
+	// ============================================================================
+
+	if( useInstanceArray )
+	{
+		IECoreScenePreview::Renderer::InstanceArray instanceArray;
+		instanceArray.prototypes.resize( fixedPrototypes.size() );
+		const std::vector<InternedString> &prototypeNames = engines[0]->prototypeNames()->readable();
+		for( size_t i = 0; i < fixedPrototypes.size(); ++i )
+		{
+			const Prototype *proto = fixedPrototypes[i].get();
+			IECoreScenePreview::Renderer::InstanceArray::Prototype &arrayPrototype = instanceArray.prototypes[i];
+			arrayPrototype.name = prototypeNames[i].string();
+			if( proto->m_objectSampleTimes.size() )
+			{
+				arrayPrototype.samples = proto->m_objectPointers;
+				arrayPrototype.sampleTimes = proto->m_objectSampleTimes;
+			}
+			else if( proto->m_object.size() )
+			{
+				arrayPrototype.samples.push_back( proto->m_object[0].get() );
+			}
+			arrayPrototype.attributes = proto->m_attributes.get();
+			arrayPrototype.rendererAttributes = proto->m_rendererAttributes.get();
+		}
+
+		const size_t numPoints = engines[0]->numPoints();
+		vector<int> prototypeIndices( numPoints );
+		vector<int64_t> ids( numPoints );
+		vector<M44f> transforms( numPoints * sampleTimes.size() );
+
+		tbb::parallel_for( tbb::blocked_range<size_t>( 0, numPoints ),
+			[&]( const tbb::blocked_range<size_t> &r )
+			{
+				for( size_t pointIndex = r.begin(); pointIndex != r.end(); ++pointIndex )
+				{
+					const int64_t instanceId = engines[0]->instanceId( pointIndex );
+					ids[pointIndex] = instanceId;
+
+					int protoIndex = engines[0]->prototypeIndex( pointIndex );
+					if( protoIndex != -1 && !fixedPrototypes[protoIndex]->m_object.size() )
+					{
+						// No object to render. This could happen if the protype didn't meet the
+						// RenderOptions::purposeIncluded test.
+						protoIndex = -1;
+					}
+					prototypeIndices[pointIndex] = protoIndex;
+					if( protoIndex == -1 )
+					{
+						continue;
+					}
+
+					const Prototype *proto = fixedPrototypes[protoIndex].get();
+					for( size_t i = 0; i < engines.size(); ++i )
+					{
+						const size_t curPointIndex = i == 0 ? pointIndex : engines[i]->pointIndex( instanceId );
+						transforms[i * numPoints + pointIndex] = proto->m_transforms[i] * engines[i]->instanceTransform( curPointIndex );
+					}
+				}
+			},
+			taskGroupContext
+		);
+
+		instanceArray.prototypeIndices = &prototypeIndices;
+		instanceArray.ids = &ids;
+		instanceArray.transforms = &transforms;
+		if( sampleTimes.size() > 1 )
+		{
+			instanceArray.transformTimes = sampleTimes;
+		}
+		instanceArray.attributes = engines[0]->instanceAttributeArrays();
+
+		renderer->instances( "", instanceArray );
+		return;
+	}
+
+	// ============================================================================
+	// Otherwise output the instances individually
 	// ============================================================================
 
 	// We've found problems with performance when running too many iterations in parallel, which appear
@@ -57,12 +57,28 @@ MergeCurves::MergeCurves( const std::string &name )
 	:	MergeObjects( name, "/mergedCurves" )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
+	addChild( new BoolPlug( "streaming", Gaffer::Plug::In, false ) );
 }
 
 MergeCurves::~MergeCurves()
 {
 }
 
+Gaffer::BoolPlug *MergeCurves::streamingPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::BoolPlug *MergeCurves::streamingPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+bool MergeCurves::useStreamedMerge( const Gaffer::Context *context ) const
+{
+	return streamingPlug()->getValue();
+}
+
 IECore::ConstObjectPtr MergeCurves::computeMergedObject( const std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > &sources, const Gaffer::Context *context ) const
 {
 	std::vector< std::pair< const IECoreScene::Primitive *, Imath::M44f > > curves;
@@ -86,3 +102,26 @@ IECore::ConstObjectPtr MergeCurves::computeMergedObject( const std::vector< std:
 
 	return IECoreScenePreview::PrimitiveAlgo::mergePrimitives( curves, context->canceller() );
 }
+
+IECore::ConstObjectPtr MergeCurves::computeStreamedMergedObject( size_t numSources, const SourceFunction &source, const Gaffer::Context *context ) const
+{
+	IECoreScene::ConstPrimitivePtr result = IECoreScenePreview::PrimitiveAlgo::mergePrimitives(
+		numSources,
+		[&source] ( size_t i ) {
+			const auto &[object, transform] = source( i );
+			// Just skip anything that's not a curve
+			return std::make_pair(
+				IECoreScene::ConstPrimitivePtr( IECore::runTimeCast< const IECoreScene::CurvesPrimitive >( object.get() ) ),
+				transform
+			);
+		},
+		context->canceller()
+	);
+
+	if( !result )
+	{
+		return IECore::NullObject::defaultNullObject();
+	}
+
+	return result;
+}
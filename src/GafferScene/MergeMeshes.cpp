@@ -57,12 +57,28 @@ MergeMeshes::MergeMeshes( const std::string &name )
 	:	MergeObjects( name, "/mergedMesh" )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
+	addChild( new BoolPlug( "streaming", Gaffer::Plug::In, false ) );
 }
 
 MergeMeshes::~MergeMeshes()
 {
 }
 
+Gaffer::BoolPlug *MergeMeshes::streamingPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::BoolPlug *MergeMeshes::streamingPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+bool MergeMeshes::useStreamedMerge( const Gaffer::Context *context ) const
+{
+	return streamingPlug()->getValue();
+}
+
 IECore::ConstObjectPtr MergeMeshes::computeMergedObject( const std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > &sources, const Gaffer::Context *context ) const
 {
 	std::vector< std::pair< const IECoreScene::Primitive *, Imath::M44f > > meshes;
@@ -86,3 +102,26 @@ IECore::ConstObjectPtr MergeMeshes::computeMergedObject( const std::vector< std:
 
 	return IECoreScenePreview::PrimitiveAlgo::mergePrimitives( meshes, context->canceller() );
 }
+
+IECore::ConstObjectPtr MergeMeshes::computeStreamedMergedObject( size_t numSources, const SourceFunction &source, const Gaffer::Context *context ) const
+{
+	IECoreScene::ConstPrimitivePtr result = IECoreScenePreview::PrimitiveAlgo::mergePrimitives(
+		numSources,
+		[&source] ( size_t i ) {
+			const auto &[object, transform] = source( i );
+			// Just skip anything that's not a mesh
+			return std::make_pair(
+				IECoreScene::ConstPrimitivePtr( IECore::runTimeCast< const IECoreScene::MeshPrimitive >( object.get() ) ),
+				transform
+			);
+		},
+		context->canceller()
+	);
+
+	if( !result )
+	{
+		return IECore::NullObject::defaultNullObject();
+	}
+
+	return result;
+}
@@ -1023,12 +1023,38 @@ void MergeObjects::compute( Gaffer::ValuePlug *output, const Gaffer::Context *co
 			throw IECore::Exception( "__processedObject should only be evaluated from computeObject, which checks for a matching tree location first" );
 		}
 
-		// Prepare a vector of pairs of objects and transforms, to be merged.
-		std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > sources( sourcePaths->size() );
-
 		const ScenePlug *effectiveSource = effectiveSourcePlug();
 
 		const ThreadState &threadState = ThreadState::current();
+
+		// Note : `useStreamedMerge()` isn't accounted for in the hash, because it only
+		// changes how the result is computed, not what the result is.
+		if( useStreamedMerge( context ) )
+		{
+			const SourceFunction source = [&] ( size_t i ) {
+				ScenePlug::PathScope pathScope( threadState, &((*sourcePaths)[i]) );
+				ScenePlug::ScenePath matchingPrefix;
+				M44f toDest( 0.0f );
+
+				ConstObjectPtr object = effectiveSource->objectPlug()->getValue();
+				return std::make_pair(
+					object,
+					relativeTransform(
+						(*sourcePaths)[i], path, effectiveSource, inPlug(), pathScope,
+						matchingPrefix, toDest
+					)
+				);
+			};
+
+			static_cast<Gaffer::ObjectPlug *>( output )->setValue(
+				computeStreamedMergedObject( sourcePaths->size(), source, context )
+			);
+			return;
+		}
+
+		// Prepare a vector of pairs of objects and transforms, to be merged.
+		std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > sources( sourcePaths->size() );
+
 		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 
 		tbb::parallel_for(
@@ -1613,3 +1639,29 @@ bool MergeObjects::affectsMergedObject( const Gaffer::Plug *input ) const
 void MergeObjects::hashMergedObject( const ScenePath &path, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 }
+
+bool MergeObjects::useStreamedMerge( const Gaffer::Context *context ) const
+{
+	return false;
+}
+
+IECore::ConstObjectPtr MergeObjects::computeStreamedMergedObject( size_t numSources, const SourceFunction &source, const Gaffer::Context *context ) const
+{
+	std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > sources( numSources );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, numSources ),
+		[&] ( const tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				sources[i] = source( i );
+			}
+		},
+		tbb::auto_partitioner(),
+		taskGroupContext
+	);
+
+	return computeMergedObject( sources, context );
+}
@@ -57,12 +57,28 @@ MergePoints::MergePoints( const std::string &name )
 	:	MergeObjects( name, "/mergedPoints" )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
+	addChild( new BoolPlug( "streaming", Gaffer::Plug::In, false ) );
 }
 
 MergePoints::~MergePoints()
 {
 }
 
+Gaffer::BoolPlug *MergePoints::streamingPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::BoolPlug *MergePoints::streamingPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+bool MergePoints::useStreamedMerge( const Gaffer::Context *context ) const
+{
+	return streamingPlug()->getValue();
+}
+
 IECore::ConstObjectPtr MergePoints::computeMergedObject( const std::vector< std::pair< IECore::ConstObjectPtr, Imath::M44f > > &sources, const Gaffer::Context *context ) const
 {
 	std::vector< std::pair< const IECoreScene::Primitive *, Imath::M44f > > points;
@@ -86,3 +102,26 @@ IECore::ConstObjectPtr MergePoints::computeMergedObject( const std::vector< std:
 
 	return IECoreScenePreview::PrimitiveAlgo::mergePrimitives( points, context->canceller() );
 }
+
+IECore::ConstObjectPtr MergePoints::computeStreamedMergedObject( size_t numSources, const SourceFunction &source, const Gaffer::Context *context ) const
+{
+	IECoreScene::ConstPrimitivePtr result = IECoreScenePreview::PrimitiveAlgo::mergePrimitives(
+		numSources,
+		[&source] ( size_t i ) {
+			const auto &[object, transform] = source( i );
+			// Just skip anything that's not points
+			return std::make_pair(
+				IECoreScene::ConstPrimitivePtr( IECore::runTimeCast< const IECoreScene::PointsPrimitive >( object.get() ) ),
+				transform
+			);
+		},
+		context->canceller()
+	);
+
+	if( !result )
+	{
+		return IECore::NullObject::defaultNullObject();
+	}
+
+	return result;
+}
@@ -888,32 +888,31 @@ void MergeScenes::hashSet( const IECore::InternedString &setName, const Gaffer::
 
 IECore::ConstPathMatcherDataPtr MergeScenes::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstPathMatcherDataPtr result;
-	PathMatcherDataPtr merged;
+	vector<const PathMatcherDataPlug *> setPlugs;
 	visit(
 		connectedInputs(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->setPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new PathMatcherData();
-					result = merged;
-					[[fallthrough]];
-				case InputType::Other :
-					ConstPathMatcherDataPtr paths = scene->setPlug()->getValue();
-					merged->writable().addPaths( paths->readable() );
-			}
+			setPlugs.push_back( scene->setPlug() );
 			return true;
 		}
 	);
 
-	return result;
+	// Evaluate all the input sets in one batch, so that any which
+	// aren't cached are computed in parallel.
+	const vector<ConstPathMatcherDataPtr> inputSets = PathMatcherDataPlug::getValues( setPlugs );
+	if( inputSets.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inputSets.front();
+	}
+
+	PathMatcherDataPtr merged = new PathMatcherData();
+	for( const auto &paths : inputSets )
+	{
+		merged->writable().addPaths( paths->readable() );
+	}
+
+	return merged;
 }
 
 MergeScenes::VisitOrder MergeScenes::visitOrder( Mode mode, VisitOrder replaceOrder ) const
@@ -49,8 +49,11 @@
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Switch.h"
 
+#include "IECore/MessageHandler.h"
 #include "IECore/ObjectPool.h"
 
+#include "fmt/format.h"
+
 #include <filesystem>
 #include <memory>
 
@@ -350,12 +353,26 @@ void Render::executeInternal( bool flushCaches ) const
 		// and `lightLinks` before we call `render()`.
 		GafferScene::Private::RendererAlgo::RenderSets renderSets( adaptedInPlug() );
 		GafferScene::Private::RendererAlgo::LightLinks lightLinks;
+		GafferScene::Private::RendererAlgo::ObjectDeduplicator objectDeduplicator;
 
 		GafferScene::Private::RendererAlgo::outputCameras( adaptedInPlug(), renderOptions, renderSets, renderer.get() );
 		GafferScene::Private::RendererAlgo::outputLights( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
 		GafferScene::Private::RendererAlgo::outputLightFilters( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
 		lightLinks.outputLightFilterLinks( adaptedInPlug() );
-		GafferScene::Private::RendererAlgo::outputObjects( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
+		GafferScene::Private::RendererAlgo::outputObjects( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get(), ScenePlug::ScenePath(), &objectDeduplicator );
+
+		const auto statistics = objectDeduplicator.statistics();
+		if( statistics.duplicateObjects )
+		{
+			IECore::msg(
+				IECore::Msg::Info, "Render",
+				fmt::format(
+					"Shared {} unique objects between {} locations, deduplicating {:.1f}MB of object data",
+					statistics.uniqueObjects, statistics.uniqueObjects + statistics.duplicateObjects,
+					float( statistics.duplicateMemory ) / ( 1024.0f * 1024.0f )
+				)
+			);
+		}
 	}
 
 	if( renderScope.sceneTranslationOnly() )
@@ -426,8 +426,14 @@ class RenderController::SceneGraph
 			// the sets have changed, but we also need to do an
 			// update if the attributes have changed, because in
 			// that case we may have overwritten the sets attribute.
+			// When sets change, we only update locations whose
+			// membership changed, because for small edits to large
+			// sets, updating every location would be very expensive.
 
-			if( ( changedGlobals & RenderSetsGlobalComponent ) || ( m_changedComponents & AttributesComponent ) )
+			if(
+				( ( changedGlobals & RenderSetsGlobalComponent ) && ( controller->m_changedRenderSetPaths.match( path ) & ( PathMatcher::ExactMatch | PathMatcher::AncestorMatch ) ) ) ||
+				( m_changedComponents & AttributesComponent )
+			)
 			{
 				if( updateRenderSets( path, controller->m_renderSets ) )
 				{
@@ -487,7 +493,7 @@ class RenderController::SceneGraph
 				m_objectHash = MurmurHash();
 			}
 
-			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
+			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get(), &controller->m_objectDeduplicator ) )
 			{
 				m_changedComponents |= ObjectComponent;
 			}
@@ -511,7 +517,7 @@ class RenderController::SceneGraph
 						{
 							// Failed to apply attributes - must replace entire object.
 							m_objectHash = MurmurHash();
-							if( updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
+							if( updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get(), &controller->m_objectDeduplicator ) )
 							{
 								m_changedComponents |= ObjectComponent;
 								controller->m_failedAttributeEdits++;
@@ -662,7 +668,7 @@ class RenderController::SceneGraph
 		{
 			m_children.clear();
 			clearObject();
-			m_attributesHash = m_lightLinksHash = m_transformHash = m_childNamesHash = IECore::MurmurHash();
+			m_attributesHash = m_lightLinksHash = m_transformHash = m_childNamesHash = m_subtreeHash = IECore::MurmurHash();
 			m_cleared = true;
 			m_descendantsVisible = false;
 			m_drawMode = VisibleSet::Visibility::None;
@@ -678,6 +684,55 @@ class RenderController::SceneGraph
 			return m_cleared;
 		}
 
+		// Stores the `ScenePlug::subtreeHash()` for which this location
+		// and all its descendants are known to be up to date. Should be
+		// reset to the default before an update is started, so that a
+		// cancelled update can't be mistaken for a complete one.
+		void setSubtreeHash( const IECore::MurmurHash &subtreeHash )
+		{
+			m_subtreeHash = subtreeHash;
+		}
+
+		// Returns true if nothing can have changed within this subtree
+		// since `setSubtreeHash()` was last called, in which case the
+		// update for the entire subtree may be skipped. This requires
+		// the subtree hash to be unchanged, and also that nothing the
+		// subtree inherits from outside has changed.
+		bool subtreeUnchanged( const ScenePlug::ScenePath &path, unsigned changedGlobals, const RenderController *controller ) const
+		{
+			if( m_cleared || m_subtreeHash == IECore::MurmurHash() || m_changedComponents != NoComponent )
+			{
+				return false;
+			}
+
+			if( m_dirtyComponents & VisibleSetComponent )
+			{
+				return false;
+			}
+
+			if( m_parent && ( m_parent->m_changedComponents & ( AttributesComponent | TransformComponent ) ) )
+			{
+				return false;
+			}
+
+			if( changedGlobals & ~RenderSetsGlobalComponent )
+			{
+				return false;
+			}
+
+			if( ( changedGlobals & RenderSetsGlobalComponent ) && controller->m_changedRenderSetPaths.match( path ) )
+			{
+				return false;
+			}
+
+			if( controller->m_lightLinks && controller->m_lightLinks->lightLinksDirty() )
+			{
+				return false;
+			}
+
+			return controller->m_scene->subtreeHash( path ) == m_subtreeHash;
+		}
+
 	private :
 
 		SceneGraph( const InternedString &name, const SceneGraph *parent )
@@ -803,7 +858,7 @@ class RenderController::SceneGraph
 		}
 
 		// Returns true if the object changed.
-		bool updateObject( const ObjectPlug *objectPlug, Type type, IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const ScenePlug *scene, LightLinks *lightLinks )
+		bool updateObject( const ObjectPlug *objectPlug, Type type, IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const ScenePlug *scene, LightLinks *lightLinks, ObjectDeduplicator *objectDeduplicator )
 		{
 			const bool hadObjectInterface = static_cast<bool>( m_objectInterface );
 			if( type == NoType || m_drawMode != VisibleSet::Visibility::Visible || !m_purposeIncluded )
@@ -873,7 +928,7 @@ class RenderController::SceneGraph
 			}
 
 			vector<ConstObjectPtr> samples;
-			if( !Private::RendererAlgo::objectSamples( objectPlug, m_deformationTimes, samples, &m_objectHash ) )
+			if( !objectDeduplicator->objectSamples( objectPlug, m_deformationTimes, samples, &m_objectHash ) )
 			{
 				return false;
 			}
@@ -1161,6 +1216,8 @@ class RenderController::SceneGraph
 		bool m_descendantsVisible;
 		VisibleSet::Visibility::DrawMode m_drawMode;
 
+		IECore::MurmurHash m_subtreeHash;
+
 		// Tracks work which needs to be done on
 		// the next call to `update()`.
 		unsigned m_dirtyComponents;
@@ -1240,6 +1297,18 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 
 			ScenePlug::PathScope pathScope( m_threadState, &m_scenePath );
 
+			// Skip the whole subtree if we can prove nothing in it has changed.
+
+			const bool useSubtreeHashes = this->useSubtreeHashes();
+			if( useSubtreeHashes )
+			{
+				if( m_sceneGraph->subtreeUnchanged( m_scenePath, m_changedGlobalComponents, m_controller ) )
+				{
+					return nullptr;
+				}
+				m_sceneGraph->setSubtreeHash( IECore::MurmurHash() );
+			}
+
 			// Update the scene graph at this location.
 
 			const bool changesMade = m_sceneGraph->update(
@@ -1283,6 +1352,10 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			if( pathsToUpdateMatch & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch ) )
 			{
 				m_sceneGraph->allChildrenUpdated();
+				if( useSubtreeHashes && !m_sceneGraph->cleared() )
+				{
+					m_sceneGraph->setSubtreeHash( scene()->subtreeHash( m_scenePath ) );
+				}
 			}
 
 			return nullptr;
@@ -1295,6 +1368,19 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			return m_controller->m_scene.get();
 		}
 
+		// Subtree hashes cover every descendant, so we only use them when
+		// the whole scene is expanded. Otherwise computing them could visit
+		// far more locations than we render. They also only account for the
+		// current frame, so can't be used when motion blur is enabled.
+		bool useSubtreeHashes() const
+		{
+			return
+				m_controller->m_minimumExpansionDepth == numeric_limits<size_t>::max() &&
+				!m_controller->m_renderOptions.transformBlur &&
+				!m_controller->m_renderOptions.deformationBlur
+			;
+		}
+
 		/// \todo Fast path for when sets were not dirtied.
 		unsigned sceneGraphMatch() const
 		{
@@ -1667,10 +1753,25 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 		if( m_dirtyGlobalComponents & SetsGlobalComponent )
 		{
-			if( m_renderSets.update( m_scene.get() ) & Private::RendererAlgo::RenderSets::AttributesChanged )
+			const unsigned changedRenderSets = m_renderSets.update( m_scene.get(), &m_changedRenderSetPaths );
+			if( changedRenderSets & Private::RendererAlgo::RenderSets::AttributesChanged )
 			{
 				m_changedGlobalComponents |= RenderSetsGlobalComponent;
 			}
+			if(
+				changedRenderSets & (
+					Private::RendererAlgo::RenderSets::CamerasSetChanged |
+					Private::RendererAlgo::RenderSets::LightsSetChanged |
+					Private::RendererAlgo::RenderSets::LightFiltersSetChanged
+				)
+			)
+			{
+				// Membership determines which scene graph each location belongs
+				// to. We don't need to do anything special to account for that
+				// in `SceneGraph::update()`, but it does prevent us from skipping
+				// unchanged subtrees.
+				m_changedGlobalComponents |= RenderSetMembershipGlobalComponent;
+			}
 			// Light linking expressions might refer to any set, so we
 			// must assume that linking needs to be recalculated.
 			if( m_lightLinks )
@@ -1712,6 +1813,10 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			}
 		}
 
+		// Duplicates are only shared within a single update, so that we
+		// don't keep objects alive after the renderer has converted them.
+		m_objectDeduplicator.clear();
+
 		if( m_changedGlobalComponents & CameraOptionsGlobalComponent )
 		{
 			updateDefaultCamera();
@@ -1722,6 +1827,7 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			// Only clear `m_changedGlobalComponents` when we
 			// know our entire scene has been updated successfully.
 			m_changedGlobalComponents = NoGlobalComponent;
+			m_changedRenderSetPaths.clear();
 			m_updateRequired = false;
 			if( m_failedAttributeEdits )
 			{
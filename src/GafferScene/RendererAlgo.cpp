@@ -69,7 +69,9 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <memory>
 
 using namespace std;
 using namespace Imath;
@@ -327,9 +329,11 @@ bool transformSamples( const M44fPlug *transformPlug, const std::vector<float> &
 	return true;
 }
 
-bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, std::vector<IECore::ConstObjectPtr> &samples, IECore::MurmurHash *hash )
+namespace
+{
+
+IECore::MurmurHash objectSampleHashes( const ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, std::vector<IECore::MurmurHash> &sampleHashes )
 {
-	std::vector< IECore::MurmurHash > sampleHashes;
 	if( !sampleTimes.size() )
 	{
 		sampleHashes.push_back( objectPlug->hash() );
@@ -359,27 +363,21 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 		}
 	}
 
-	IECore::MurmurHash combinedHash;
-	if( hash )
+	if( sampleHashes.size() == 1 )
 	{
-		if( sampleHashes.size() == 1 )
-		{
-			combinedHash = sampleHashes[0];
-		}
-		else
-		{
-			for( const IECore::MurmurHash &h : sampleHashes )
-			{
-				combinedHash.append( h );
-			}
-		}
+		return sampleHashes[0];
+	}
 
-		if( combinedHash == *hash )
-		{
-			return false;
-		}
+	IECore::MurmurHash combinedHash;
+	for( const IECore::MurmurHash &h : sampleHashes )
+	{
+		combinedHash.append( h );
 	}
+	return combinedHash;
+}
 
+void objectSamplesFromHashes( const ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, const std::vector<IECore::MurmurHash> &sampleHashes, std::vector<IECore::ConstObjectPtr> &samples )
+{
 	samples.clear();
 
 	if( sampleHashes.size() == 1 )
@@ -410,16 +408,70 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 	}
 	else
 	{
-		// Motion case
+		// Motion case. We evaluate the first sample on its own so that we
+		// can stop early for objects that can't be interpolated. If we need
+		// the remaining samples, we evaluate them as a single batch, so that
+		// any that are not cached are computed in parallel rather than one
+		// after another. Each distinct hash is evaluated only once, and the
+		// hashes are passed through so they aren't computed again.
 		const Context *frameContext = Context::current();
-		Context::EditableScope timeContext( frameContext );
+
+		std::vector<ConstObjectPtr> sampleObjects( sampleTimes.size() );
+		{
+			Context::EditableScope timeContext( frameContext );
+			timeContext.setFrame( sampleTimes[0] );
+			sampleObjects[0] = objectPlug->getValue( &sampleHashes[0] );
+		}
+
+		if( runTimeCast<const Primitive>( sampleObjects[0].get() ) || runTimeCast<const Camera>( sampleObjects[0].get() ) )
+		{
+			// Index of the first sample with the same hash as each sample.
+			std::vector<size_t> firstWithHash( sampleTimes.size() );
+			std::vector<size_t> batchIndices;
+			std::vector<ContextPtr> contexts;
+			std::vector<const Context *> contextPointers;
+			std::vector<IECore::MurmurHash> batchHashes;
+			for( size_t i = 0; i < sampleTimes.size(); i++ )
+			{
+				firstWithHash[i] = std::find( sampleHashes.begin(), sampleHashes.begin() + i, sampleHashes[i] ) - sampleHashes.begin();
+				if( firstWithHash[i] != i )
+				{
+					continue;
+				}
+				if( i )
+				{
+					contexts.push_back( new Context( *frameContext ) );
+					contexts.back()->setFrame( sampleTimes[i] );
+					contextPointers.push_back( contexts.back().get() );
+					batchHashes.push_back( sampleHashes[i] );
+					batchIndices.push_back( i );
+				}
+			}
+
+			if( batchIndices.size() )
+			{
+				std::vector<ConstObjectPtr> batchSamples = ObjectPlug::getValues(
+					std::vector<const ObjectPlug *>( batchIndices.size(), objectPlug ), contextPointers, batchHashes
+				);
+				for( size_t i = 0; i < batchIndices.size(); ++i )
+				{
+					sampleObjects[batchIndices[i]] = std::move( batchSamples[i] );
+				}
+			}
+
+			for( size_t i = 1; i < sampleTimes.size(); i++ )
+			{
+				if( firstWithHash[i] != i )
+				{
+					sampleObjects[i] = sampleObjects[firstWithHash[i]];
+				}
+			}
+		}
 
 		samples.reserve( sampleTimes.size() );
 		for( size_t i = 0; i < sampleTimes.size(); i++ )
 		{
-			timeContext.setFrame( sampleTimes[i] );
-
-			ConstObjectPtr object = objectPlug->getValue( &sampleHashes[i] );
+			const ConstObjectPtr &object = sampleObjects[i];
 
 			if(
 				runTimeCast<const Primitive>( object.get() ) ||
@@ -452,12 +504,8 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 				// until the render is restarted. It seems quite unlikely a user will ever actually do this
 				// ( in any normal operation, when you change something, you change it for a frame or more
 				// at a time )
-				if( hash )
-				{
-					*hash = combinedHash;
-				}
-
-				return objectSamples( objectPlug, tempTimes, samples );
+				objectSamples( objectPlug, tempTimes, samples );
+				return;
 			}
 			else
 			{
@@ -467,6 +515,90 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 			}
 		}
 	}
+}
+
+} // namespace
+
+bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, std::vector<IECore::ConstObjectPtr> &samples, IECore::MurmurHash *hash )
+{
+	std::vector<IECore::MurmurHash> sampleHashes;
+	const IECore::MurmurHash combinedHash = objectSampleHashes( objectPlug, sampleTimes, sampleHashes );
+	if( hash && combinedHash == *hash )
+	{
+		return false;
+	}
+
+	objectSamplesFromHashes( objectPlug, sampleTimes, sampleHashes, samples );
+
+	if( hash )
+	{
+		*hash = combinedHash;
+	}
+
+	return true;
+}
+
+ObjectDeduplicator::ObjectDeduplicator()
+	:	m_uniqueObjects( 0 ), m_duplicateObjects( 0 ), m_duplicateMemory( 0 )
+{
+}
+
+bool ObjectDeduplicator::objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &sampleTimes, std::vector<IECore::ConstObjectPtr> &samples, IECore::MurmurHash *hash )
+{
+	std::vector<IECore::MurmurHash> sampleHashes;
+	const IECore::MurmurHash combinedHash = objectSampleHashes( objectPlug, sampleTimes, sampleHashes );
+	if( hash && combinedHash == *hash )
+	{
+		return false;
+	}
+
+	bool found = false;
+	{
+		EntryMap::const_accessor readAccessor;
+		if( m_entries.find( readAccessor, combinedHash ) && readAccessor->second.samples.size() )
+		{
+			samples = readAccessor->second.samples;
+			m_duplicateObjects++;
+			m_duplicateMemory += readAccessor->second.memoryUsage;
+			found = true;
+		}
+	}
+
+	if( !found )
+	{
+		// We must not hold an accessor while computing, because the compute
+		// may use TBB tasks, and a task stolen by this thread might try to
+		// access the same entry.
+		objectSamplesFromHashes( objectPlug, sampleTimes, sampleHashes, samples );
+
+		EntryMap::accessor writeAccessor;
+		if( m_entries.insert( writeAccessor, combinedHash ) )
+		{
+			// First sighting. We don't know if the object will be shared,
+			// so we don't retain the samples.
+			m_uniqueObjects++;
+		}
+		else
+		{
+			Entry &entry = writeAccessor->second;
+			if( entry.samples.empty() )
+			{
+				entry.samples = samples;
+				for( const auto &sample : samples )
+				{
+					entry.memoryUsage += sample->memoryUsage();
+				}
+			}
+			else
+			{
+				// Another thread retained samples while we were computing.
+				// Use them so that all duplicates share the same objects.
+				samples = entry.samples;
+			}
+			m_duplicateObjects++;
+			m_duplicateMemory += entry.memoryUsage;
+		}
+	}
 
 	if( hash )
 	{
@@ -476,6 +608,20 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 	return true;
 }
 
+void ObjectDeduplicator::clear()
+{
+	m_entries.clear();
+}
+
+ObjectDeduplicator::Statistics ObjectDeduplicator::statistics() const
+{
+	Statistics result;
+	result.uniqueObjects = m_uniqueObjects;
+	result.duplicateObjects = m_duplicateObjects;
+	result.duplicateMemory = m_duplicateMemory;
+	return result;
+}
+
 } // namespace RendererAlgo
 
 } // namespace Private
@@ -512,13 +658,13 @@ namespace RendererAlgo
 struct RenderSets::Updater
 {
 
-	Updater( const ScenePlug *scene, const ThreadState &threadState, RenderSets &renderSets, unsigned changed )
-		:	changed( changed ), m_scene( scene ), m_threadState( threadState ), m_renderSets( renderSets )
+	Updater( const ScenePlug *scene, const ThreadState &threadState, RenderSets &renderSets, unsigned changed, bool computeChangedPaths )
+		:	changed( changed ), soloLightsEmptinessChanged( false ), m_scene( scene ), m_threadState( threadState ), m_renderSets( renderSets ), m_computeChangedPaths( computeChangedPaths )
 	{
 	}
 
 	Updater( const Updater &updater, tbb::split )
-		:	changed( NothingChanged ), m_scene( updater.m_scene ), m_threadState( updater.m_threadState ), m_renderSets( updater.m_renderSets )
+		:	changed( NothingChanged ), soloLightsEmptinessChanged( false ), m_scene( updater.m_scene ), m_threadState( updater.m_threadState ), m_renderSets( updater.m_renderSets ), m_computeChangedPaths( updater.m_computeChangedPaths )
 	{
 	}
 
@@ -570,7 +716,21 @@ struct RenderSets::Updater
 			{
 				bool wasEmpty = s->set.isEmpty();
 
-				s->set = m_scene->setPlug()->getValue( &hash )->readable();
+				ConstPathMatcherDataPtr setData = m_scene->setPlug()->getValue( &hash );
+				if( m_computeChangedPaths && potentialChange == AttributesChanged )
+				{
+					const SetAlgo::SetDelta delta = SetAlgo::setDelta( s->set, setData->readable() );
+					changedPaths.addPaths( delta.added );
+					changedPaths.addPaths( delta.removed );
+					if( s == &m_renderSets.m_soloLightsSet && wasEmpty != setData->readable().isEmpty() )
+					{
+						// Soloing affects the muting of all lights, not
+						// just those in the delta.
+						soloLightsEmptinessChanged = true;
+					}
+				}
+
+				s->set = setData->readable();
 				s->hash = hash;
 				if( !( wasEmpty && s->set.isEmpty() ) )
 				{
@@ -583,15 +743,20 @@ struct RenderSets::Updater
 	void join( Updater &rhs )
 	{
 		changed |= rhs.changed;
+		soloLightsEmptinessChanged = soloLightsEmptinessChanged || rhs.soloLightsEmptinessChanged;
+		changedPaths.addPaths( rhs.changedPaths );
 	}
 
 	unsigned changed;
+	bool soloLightsEmptinessChanged;
+	IECore::PathMatcher changedPaths;
 
 	private :
 
 		const ScenePlug *m_scene;
 		const ThreadState &m_threadState;
 		RenderSets &m_renderSets;
+		const bool m_computeChangedPaths;
 
 };
 
@@ -608,7 +773,7 @@ RenderSets::RenderSets( const ScenePlug *scene )
 	update( scene );
 }
 
-unsigned RenderSets::update( const ScenePlug *scene )
+unsigned RenderSets::update( const ScenePlug *scene, IECore::PathMatcher *changedPaths )
 {
 	unsigned changed = NothingChanged;
 
@@ -633,6 +798,10 @@ unsigned RenderSets::update( const ScenePlug *scene )
 	{
 		if( std::find( setNames.begin(), setNames.end(), it->first ) == setNames.end() )
 		{
+			if( changedPaths )
+			{
+				changedPaths->addPaths( it->second.set );
+			}
 			it = m_sets.erase( it );
 			changed |= AttributesChanged;
 		}
@@ -644,7 +813,7 @@ unsigned RenderSets::update( const ScenePlug *scene )
 
 	// Update all the sets we want in parallel.
 
-	Updater updater( scene, ThreadState::current(), *this, changed );
+	Updater updater( scene, ThreadState::current(), *this, changed, changedPaths );
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 	parallel_reduce(
 		tbb::blocked_range<size_t>( 0, m_sets.size() + 4 ),
@@ -654,6 +823,15 @@ unsigned RenderSets::update( const ScenePlug *scene )
 		taskGroupContext
 	);
 
+	if( changedPaths )
+	{
+		changedPaths->addPaths( updater.changedPaths );
+		if( updater.soloLightsEmptinessChanged )
+		{
+			changedPaths->addPaths( m_lightsSet.set );
+		}
+	}
+
 	return updater.changed;
 }
 
@@ -1482,8 +1660,8 @@ struct LightFiltersOutput : public LocationOutput
 struct ObjectOutput : public LocationOutput
 {
 
-	ObjectOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks )
+	ObjectOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const GafferScene::Private::RendererAlgo::LightLinks *lightLinks, GafferScene::Private::RendererAlgo::ObjectDeduplicator *objectDeduplicator, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks ), m_objectDeduplicator( objectDeduplicator )
 	{
 	}
 
@@ -1508,7 +1686,7 @@ struct ObjectOutput : public LocationOutput
 		deformationMotionTimes( sampleTimes );
 
 		vector<ConstObjectPtr> samples;
-		GafferScene::Private::RendererAlgo::objectSamples( scene->objectPlug(), sampleTimes, samples );
+		m_objectDeduplicator->objectSamples( scene->objectPlug(), sampleTimes, samples );
 		if( !samples.size() )
 		{
 			return true;
@@ -1555,6 +1733,7 @@ struct ObjectOutput : public LocationOutput
 	const PathMatcher &m_lightSet;
 	const PathMatcher &m_lightFiltersSet;
 	const GafferScene::Private::RendererAlgo::LightLinks *m_lightLinks;
+	GafferScene::Private::RendererAlgo::ObjectDeduplicator *m_objectDeduplicator;
 
 };
 
@@ -1786,7 +1965,7 @@ void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions,
 
 	const ScenePlug::ScenePath root;
 	CameraOutput output( renderer, renderOptions, renderSets, root, scene );
-	SceneAlgo::parallelProcessLocations( scene, output );
+	SceneAlgo::parallelProcessLocationsBatched( scene, output );
 
 	if( !cameraOption || cameraOption->readable().empty() )
 	{
@@ -1803,20 +1982,27 @@ void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOpti
 {
 	const ScenePlug::ScenePath root;
 	LightFiltersOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
-	SceneAlgo::parallelProcessLocations( scene, output );
+	SceneAlgo::parallelProcessLocationsBatched( scene, output );
 }
 
 void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer )
 {
 	const ScenePlug::ScenePath root;
 	LightOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
-	SceneAlgo::parallelProcessLocations( scene, output );
+	SceneAlgo::parallelProcessLocationsBatched( scene, output );
 }
 
-void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root )
+void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root, ObjectDeduplicator *objectDeduplicator )
 {
-	ObjectOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
-	SceneAlgo::parallelProcessLocations( scene, output, root );
+	std::unique_ptr<ObjectDeduplicator> localObjectDeduplicator;
+	if( !objectDeduplicator )
+	{
+		localObjectDeduplicator = std::make_unique<ObjectDeduplicator>();
+		objectDeduplicator = localObjectDeduplicator.get();
+	}
+
+	ObjectOutput output( renderer, renderOptions, renderSets, lightLinks, objectDeduplicator, root, scene );
+	SceneAlgo::parallelProcessLocationsBatched( scene, output, root );
 }
 
 } // namespace RendererAlgo
@@ -37,6 +37,7 @@
 #include "GafferScene/SceneAlgo.h"
 
 #include "GafferScene/AttributeTweaks.h"
+#include "GafferScene/BoundingVolumeHierarchy.h"
 #include "GafferScene/CameraTweaks.h"
 #include "GafferScene/CopyAttributes.h"
 #include "GafferScene/CopyOptions.h"
@@ -261,6 +262,21 @@ IECore::PathMatcher GafferScene::SceneAlgo::findAllWithAttribute( const ScenePlu
 	);
 }
 
+IECore::PathMatcher GafferScene::SceneAlgo::findIntersecting( const ScenePlug *scene, const Imath::Box3f &bound, const ScenePlug::ScenePath &root )
+{
+	return BoundingVolumeHierarchy::acquire( scene, root )->intersecting( bound );
+}
+
+IECore::PathMatcher GafferScene::SceneAlgo::findIntersecting( const ScenePlug *scene, const std::vector<Imath::Plane3f> &frustum, const ScenePlug::ScenePath &root )
+{
+	return BoundingVolumeHierarchy::acquire( scene, root )->intersecting( frustum );
+}
+
+IECore::PathMatcher GafferScene::SceneAlgo::findIntersecting( const ScenePlug *scene, const Imath::Line3f &ray, const ScenePlug::ScenePath &root )
+{
+	return BoundingVolumeHierarchy::acquire( scene, root )->intersecting( ray );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Globals
 //////////////////////////////////////////////////////////////////////////
@@ -276,6 +276,20 @@ IECore::ConstObjectPtr SceneElementProcessor::computeObject( const ScenePath &pa
 	}
 }
 
+void SceneElementProcessor::hashSubtree( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	if( filterValue( context ) & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::DescendantMatch ) )
+	{
+		FilteredSceneProcessor::hashSubtree( path, context, parent, h );
+	}
+	else
+	{
+		// Nothing is processed at or below this location,
+		// so the whole subtree is passed through.
+		h = inPlug()->subtreeHash( path );
+	}
+}
+
 bool SceneElementProcessor::processesBound() const
 {
 	return false;
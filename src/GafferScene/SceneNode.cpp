@@ -133,6 +133,17 @@ void SceneNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 			{
 				outputs.push_back( scenePlug->childBoundsPlug() );
 			}
+
+			if(
+				input == scenePlug->boundPlug() ||
+				input == scenePlug->transformPlug() ||
+				input == scenePlug->attributesPlug() ||
+				input == scenePlug->objectPlug() ||
+				input == scenePlug->childNamesPlug()
+			)
+			{
+				outputs.push_back( scenePlug->subtreeHashPlug() );
+			}
 		}
 	}
 }
@@ -223,6 +234,11 @@ void SceneNode::hash( const ValuePlug *output, const Context *context, IECore::M
 		{
 			hashChildBounds( context, scenePlug, h );
 		}
+		else if( output == scenePlug->subtreeHashPlug() )
+		{
+			const ScenePath &scenePath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+			hashSubtree( scenePath, context, scenePlug, h );
+		}
 	}
 	else
 	{
@@ -270,6 +286,59 @@ void SceneNode::hashSet( const IECore::InternedString &setName, const Gaffer::Co
 	ComputeNode::hash( parent->setPlug(), context, h );
 }
 
+void SceneNode::hashSubtree( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	ComputeNode::hash( parent->subtreeHashPlug(), context, h );
+
+	parent->boundPlug()->hash( h );
+	parent->transformPlug()->hash( h );
+	parent->attributesPlug()->hash( h );
+	parent->objectPlug()->hash( h );
+
+	ConstInternedStringVectorDataPtr childNamesData = parent->childNamesPlug()->getValue();
+	const vector<InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
+	{
+		return;
+	}
+
+	const ThreadState &threadState = ThreadState::current();
+	using SizeRange = blocked_range<size_t>;
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	const IECore::MurmurHash reduction = parallel_deterministic_reduce(
+		SizeRange( 0, childNames.size() ),
+		IECore::MurmurHash(),
+		[&] ( const SizeRange &range, const MurmurHash &hash ) {
+
+			ScenePlug::PathScope pathScope( threadState );
+			ScenePath childPath = path;
+			childPath.push_back( InternedString() ); // room for the child name
+
+			MurmurHash result = hash;
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				childPath.back() = childNames[i];
+				pathScope.setPath( &childPath );
+				result.append( childNames[i] );
+				parent->subtreeHashPlug()->hash( result );
+			}
+			return result;
+
+		},
+		[] ( const MurmurHash &x, const MurmurHash &y ) {
+
+			MurmurHash result = x;
+			result.append( y );
+			return result;
+		},
+		simple_partitioner(),
+		taskGroupContext
+	);
+
+	h.append( reduction );
+}
+
 void SceneNode::compute( ValuePlug *output, const Context *context ) const
 {
 	ScenePlug *scenePlug = output->parent<ScenePlug>();
@@ -363,6 +432,11 @@ void SceneNode::compute( ValuePlug *output, const Context *context ) const
 			{
 				static_cast<AtomicBox3fPlug *>( output )->setValue( computeChildBounds( context, scenePlug ) );
 			}
+			else if( output == scenePlug->subtreeHashPlug() )
+			{
+				// Only the hash is meaningful.
+				output->setToDefault();
+			}
 		}
 		else
 		{
@@ -416,7 +490,7 @@ Gaffer::ValuePlug::CachePolicy SceneNode::hashCachePolicy( const Gaffer::ValuePl
 {
 	if( auto parent = output->parent<ScenePlug>() )
 	{
-		if( output == parent->childBoundsPlug() )
+		if( output == parent->childBoundsPlug() || output == parent->subtreeHashPlug() )
 		{
 			return ValuePlug::CachePolicy::TaskCollaboration;
 		}
@@ -495,19 +569,55 @@ void SceneNode::plugInputChanged( Gaffer::Plug *plug )
 	}
 
 	auto scene = plug->parent<ScenePlug>();
-	if( !scene || plug != scene->childNamesPlug() )
+	if( !scene )
 	{
 		return;
 	}
 
-	ScenePlug *sourceScene = nullptr;
-	if( Plug *source = plug->getInput() )
+	if( plug == scene->childNamesPlug() )
 	{
-		sourceScene = source->parent<ScenePlug>();
+		ScenePlug *sourceScene = nullptr;
+		if( Plug *source = plug->getInput() )
+		{
+			sourceScene = source->parent<ScenePlug>();
+		}
+
+		scene->existsPlug()->setInput( sourceScene ? sourceScene->existsPlug() : nullptr );
+		scene->sortedChildNamesPlug()->setInput( sourceScene ? sourceScene->sortedChildNamesPlug() : nullptr );
 	}
 
-	scene->existsPlug()->setInput( sourceScene ? sourceScene->existsPlug() : nullptr );
-	scene->sortedChildNamesPlug()->setInput( sourceScene ? sourceScene->sortedChildNamesPlug() : nullptr );
+	// Likewise, if all the per-location plugs are passed through from the
+	// same input, then so is the subtree hash.
+
+	if(
+		plug == scene->boundPlug() ||
+		plug == scene->transformPlug() ||
+		plug == scene->attributesPlug() ||
+		plug == scene->objectPlug() ||
+		plug == scene->childNamesPlug()
+	)
+	{
+		ScenePlug *sourceScene = nullptr;
+		if( Plug *source = scene->childNamesPlug()->getInput() )
+		{
+			sourceScene = source->parent<ScenePlug>();
+		}
+
+		if(
+			sourceScene &&
+			scene->boundPlug()->getInput() == sourceScene->boundPlug() &&
+			scene->transformPlug()->getInput() == sourceScene->transformPlug() &&
+			scene->attributesPlug()->getInput() == sourceScene->attributesPlug() &&
+			scene->objectPlug()->getInput() == sourceScene->objectPlug()
+		)
+		{
+			scene->subtreeHashPlug()->setInput( sourceScene->subtreeHashPlug() );
+		}
+		else
+		{
+			scene->subtreeHashPlug()->setInput( nullptr );
+		}
+	}
 }
 
 void SceneNode::hashExists( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
@@ -162,6 +162,17 @@ ScenePlug::ScenePlug( const std::string &name, Direction direction, unsigned fla
 		)
 	);
 
+	addChild(
+		new IntPlug(
+			"__subtreeHash",
+			direction,
+			0,
+			std::numeric_limits<int>::lowest(),
+			std::numeric_limits<int>::max(),
+			childFlags
+		)
+	);
+
 }
 
 ScenePlug::~ScenePlug()
@@ -174,7 +185,7 @@ bool ScenePlug::acceptsChild( const GraphComponent *potentialChild ) const
 	{
 		return false;
 	}
-	return children().size() != 11;
+	return children().size() != 12;
 }
 
 Gaffer::PlugPtr ScenePlug::createCounterpart( const std::string &name, Direction direction ) const
@@ -306,6 +317,16 @@ const Gaffer::InternedStringVectorDataPlug *ScenePlug::sortedChildNamesPlug() co
 	return getChild<InternedStringVectorDataPlug>( 10 );
 }
 
+Gaffer::IntPlug *ScenePlug::subtreeHashPlug()
+{
+	return getChild<IntPlug>( 11 );
+}
+
+const Gaffer::IntPlug *ScenePlug::subtreeHashPlug() const
+{
+	return getChild<IntPlug>( 11 );
+}
+
 ScenePlug::PathScope::PathScope( const Gaffer::Context *context )
 	:	EditableScope( context )
 {
@@ -577,6 +598,12 @@ IECore::MurmurHash ScenePlug::childBoundsHash( const ScenePath &scenePath ) cons
 	return childBoundsPlug()->hash();
 }
 
+IECore::MurmurHash ScenePlug::subtreeHash( const ScenePath &scenePath ) const
+{
+	PathScope scope( Context::current(), &scenePath );
+	return subtreeHashPlug()->hash();
+}
+
 void ScenePlug::stringToPath( const std::string &s, ScenePlug::ScenePath &path )
 {
 	path.clear();
@@ -0,0 +1,339 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/SceneSnapshot.h"
+
+#include "tbb/parallel_for.h"
+
+#include "fmt/format.h"
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace Gaffer;
+using namespace GafferScene;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal tree
+//////////////////////////////////////////////////////////////////////////
+
+// The number of descendants of each location isn't known until it has been
+// fully evaluated, so we first build a temporary tree in parallel, and then
+// flatten it into the final columns. The flattening is also parallel, since
+// once all subtree sizes are known, every location's index can be computed
+// up front.
+struct SceneSnapshot::Location
+{
+	InternedString name;
+	Box3f bound;
+	M44f transform;
+	ConstCompoundObjectPtr attributes;
+	ConstObjectPtr object;
+	std::vector<Location> children;
+	size_t subtreeSize = 1;
+};
+
+namespace
+{
+
+// Mirrors `SceneAlgo::parallelProcessLocations()`. Templated only so that
+// we can operate on the private `SceneSnapshot::Location` type.
+template<typename LocationType>
+void buildWalk( const ScenePlug *scene, const ThreadState &threadState, const ScenePlug::ScenePath &path, unsigned components, LocationType &location, tbb::task_group_context &taskGroupContext )
+{
+	ScenePlug::PathScope pathScope( threadState, &path );
+
+	if( components & SceneSnapshot::Bound )
+	{
+		location.bound = scene->boundPlug()->getValue();
+	}
+	if( components & SceneSnapshot::Transform )
+	{
+		location.transform = scene->transformPlug()->getValue();
+	}
+	if( components & SceneSnapshot::Attributes )
+	{
+		location.attributes = scene->attributesPlug()->getValue();
+	}
+	if( components & SceneSnapshot::Object )
+	{
+		location.object = scene->objectPlug()->getValue();
+	}
+
+	ConstInternedStringVectorDataPtr childNamesData = scene->childNamesPlug()->getValue();
+	const vector<InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
+	{
+		return;
+	}
+
+	location.children.resize( childNames.size() );
+
+	using IndexRange = tbb::blocked_range<size_t>;
+	const IndexRange loopRange( 0, childNames.size() );
+
+	auto loopBody = [&] ( const IndexRange &range ) {
+		ScenePlug::ScenePath childPath = path;
+		childPath.push_back( InternedString() ); // Space for the child name
+		for( size_t i = range.begin(); i != range.end(); ++i )
+		{
+			childPath.back() = childNames[i];
+			location.children[i].name = childNames[i];
+			buildWalk( scene, threadState, childPath, components, location.children[i], taskGroupContext );
+		}
+	};
+
+	if( childNames.size() > 1 )
+	{
+		tbb::parallel_for( loopRange, loopBody, taskGroupContext );
+	}
+	else
+	{
+		loopBody( loopRange );
+	}
+
+	for( const auto &child : location.children )
+	{
+		location.subtreeSize += child.subtreeSize;
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// SceneSnapshot
+//////////////////////////////////////////////////////////////////////////
+
+SceneSnapshot::SceneSnapshot( const ScenePlug *scene, const ScenePlug::ScenePath &root, unsigned components )
+	:	m_components( components ), m_root( root )
+{
+	if( !scene->exists( root ) )
+	{
+		throw IECore::Exception( fmt::format( "Location \"{}\" does not exist", ScenePlug::pathToString( root ) ) );
+	}
+
+	Location rootLocation;
+	if( root.size() )
+	{
+		rootLocation.name = root.back();
+	}
+
+	{
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
+		buildWalk( scene, ThreadState::current(), root, components, rootLocation, taskGroupContext );
+	}
+
+	const size_t size = rootLocation.subtreeSize;
+	m_names.resize( size );
+	m_parents.resize( size );
+	m_subtreeEnds.resize( size );
+	if( components & Bound )
+	{
+		m_bounds.resize( size );
+	}
+	M44f rootParentTransform;
+	if( components & Transform )
+	{
+		m_transforms.resize( size );
+		m_fullTransforms.resize( size );
+		if( root.size() )
+		{
+			const ScenePlug::ScenePath rootParent( root.begin(), root.end() - 1 );
+			rootParentTransform = scene->fullTransform( rootParent );
+		}
+	}
+	if( components & Attributes )
+	{
+		m_attributes.resize( size );
+	}
+	if( components & Object )
+	{
+		m_objects.resize( size );
+	}
+
+	flatten( rootLocation, 0, npos, rootParentTransform );
+}
+
+SceneSnapshot::~SceneSnapshot()
+{
+}
+
+void SceneSnapshot::flatten( Location &location, size_t index, size_t parentIndex, const Imath::M44f &parentFullTransform )
+{
+	m_names[index] = location.name;
+	m_parents[index] = parentIndex;
+	m_subtreeEnds[index] = index + location.subtreeSize;
+
+	if( m_components & Bound )
+	{
+		m_bounds[index] = location.bound;
+	}
+	if( m_components & Transform )
+	{
+		m_transforms[index] = location.transform;
+		m_fullTransforms[index] = location.transform * parentFullTransform;
+	}
+	if( m_components & Attributes )
+	{
+		m_attributes[index] = std::move( location.attributes );
+	}
+	if( m_components & Object )
+	{
+		m_objects[index] = std::move( location.object );
+	}
+
+	if( location.children.empty() )
+	{
+		return;
+	}
+
+	// Compute the start index of each child subtree, so that the children can
+	// be flattened independently.
+
+	vector<size_t> childIndices;
+	childIndices.reserve( location.children.size() );
+	size_t childIndex = index + 1;
+	for( const auto &child : location.children )
+	{
+		childIndices.push_back( childIndex );
+		childIndex += child.subtreeSize;
+	}
+
+	const M44f &fullTransform = ( m_components & Transform ) ? m_fullTransforms[index] : parentFullTransform;
+
+	auto flattenChildren = [&] ( const tbb::blocked_range<size_t> &range ) {
+		for( size_t i = range.begin(); i != range.end(); ++i )
+		{
+			flatten( location.children[i], childIndices[i], index, fullTransform );
+		}
+	};
+
+	if( location.children.size() > 1 )
+	{
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for( tbb::blocked_range<size_t>( 0, location.children.size() ), flattenChildren, taskGroupContext );
+	}
+	else
+	{
+		flattenChildren( tbb::blocked_range<size_t>( 0, location.children.size() ) );
+	}
+
+	// Free memory as we go, so that the peak usage is not the sum of
+	// the tree and the columns.
+	location.children.clear();
+	location.children.shrink_to_fit();
+}
+
+unsigned SceneSnapshot::components() const
+{
+	return m_components;
+}
+
+const ScenePlug::ScenePath &SceneSnapshot::root() const
+{
+	return m_root;
+}
+
+size_t SceneSnapshot::size() const
+{
+	return m_names.size();
+}
+
+const IECore::InternedString &SceneSnapshot::name( size_t index ) const
+{
+	return m_names[index];
+}
+
+size_t SceneSnapshot::parent( size_t index ) const
+{
+	return m_parents[index];
+}
+
+size_t SceneSnapshot::subtreeEnd( size_t index ) const
+{
+	return m_subtreeEnds[index];
+}
+
+void SceneSnapshot::path( size_t index, ScenePlug::ScenePath &path ) const
+{
+	size_t depth = 0;
+	for( size_t i = index; i != 0; i = m_parents[i] )
+	{
+		depth++;
+	}
+
+	path.resize( m_root.size() + depth );
+	std::copy( m_root.begin(), m_root.end(), path.begin() );
+	for( size_t i = index; i != 0; i = m_parents[i] )
+	{
+		path[m_root.size() + --depth] = m_names[i];
+	}
+}
+
+ScenePlug::ScenePath SceneSnapshot::path( size_t index ) const
+{
+	ScenePlug::ScenePath result;
+	path( index, result );
+	return result;
+}
+
+size_t SceneSnapshot::find( const ScenePlug::ScenePath &path ) const
+{
+	if( path.size() < m_root.size() || !std::equal( m_root.begin(), m_root.end(), path.begin() ) )
+	{
+		return npos;
+	}
+
+	// Descend one level at a time, skipping over the subtrees of
+	// non-matching siblings.
+	size_t index = 0;
+	for( auto it = path.begin() + m_root.size(); it != path.end(); ++it )
+	{
+		const size_t end = m_subtreeEnds[index];
+		size_t child = index + 1;
+		while( child < end && m_names[child] != *it )
+		{
+			child = m_subtreeEnds[child];
+		}
+		if( child >= end )
+		{
+			return npos;
+		}
+		index = child;
+	}
+
+	return index;
+}
@@ -44,9 +44,18 @@
 
 #include "IECoreScene/SceneInterface.h"
 
-#include "tbb/mutex.h"
+#include "IECore/MessageHandler.h"
 
+#include "tbb/concurrent_queue.h"
+#include "tbb/task_arena.h"
+
+#include "fmt/format.h"
+
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 
 using namespace std;
@@ -58,128 +67,331 @@ using namespace GafferScene;
 namespace
 {
 
-struct LocationWriter
+// Writing a scene is split into two stages which run concurrently :
+//
+// 1. Evaluation. `LocationEvaluator` is used with `parallelProcessLocationsBatched()`
+//    to compute the data for each location in parallel, pushing a `LocationPayload`
+//    into a bounded queue for each one.
+// 2. Output. A single `PipelineWriter` thread drains the queue and writes each
+//    payload to the output SceneInterface.
+//
+// This overlaps computation with I/O, and means that the compute threads never
+// contend on a lock around the (non-threadsafe) SceneInterface.
+
+// Output state for a single location. Created by the evaluation thread, but
+// thereafter owned exclusively by the writer thread, so that SceneInterfaces
+// are only ever created and released on the writer thread.
+struct OutputLocation
 {
+	OutputLocation *parent = nullptr;
+	SceneInterfacePtr output;
+	unordered_map<IECore::InternedString, SceneInterfacePtr> childOutputs;
+	// Number of children that have not yet been written in full.
+	size_t pendingChildren = 0;
+};
 
-	LocationWriter( SceneInterface *rootOutput, const CompoundData *sets, float time, tbb::mutex &mutex )
-		: m_parent( nullptr ), m_rootOutput( rootOutput ), m_sets( sets ), m_time( time ), m_mutex( mutex )
-	{
-	}
+struct LocationPayload
+{
+	std::unique_ptr<OutputLocation> location;
+	OutputLocation *parent = nullptr;
+	IECore::InternedString name;
+	ConstCompoundObjectPtr attributes;
+	ConstCompoundObjectPtr globals;
+	ConstObjectPtr object;
+	Imath::Box3f bound;
+	IECore::M44dDataPtr transform;
+	SceneInterface::NameList sets;
+	ConstInternedStringVectorDataPtr childNames;
+};
 
-	// Called by `parallelProcessLocations()` to create child functors for each location.
-	LocationWriter( const LocationWriter &parent )
-		: m_parent( &parent ), m_rootOutput( parent.m_rootOutput ), m_sets( parent.m_sets ), m_time( parent.m_time ), m_mutex( parent.m_mutex )
-	{
-	}
+using LocationPayloadPtr = std::unique_ptr<LocationPayload>;
 
-	~LocationWriter()
-	{
-		// Some implementations of SceneInterface may perform writing when we release
-		// the SceneInterfaces, so we need to hold the lock while freeing them.
-		tbb::mutex::scoped_lock scopedLock( m_mutex );
-		m_childOutputs.clear();
-	}
+// Interval between progress messages output while writing.
+const std::chrono::seconds g_reportInterval( 10 );
 
-	bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &scenePath )
-	{
-		// First read all the scene data for this location. We don't need the lock
-		// for this so we can read multiple locations in parallel.
+class PipelineWriter
+{
 
-		ConstCompoundObjectPtr attributes = scene->attributesPlug()->getValue();
+	public :
 
-		ConstCompoundObjectPtr globals;
+		PipelineWriter( SceneInterface *rootOutput, float time )
+			:	m_rootOutput( rootOutput ), m_time( time ), m_messageHandler( IECore::MessageHandler::currentHandler() ),
+				m_numLocations( 0 ), m_failed( false )
+		{
+			// Bound the queue so that evaluation can't race arbitrarily far
+			// ahead of output, keeping the memory used by in-flight payloads
+			// under control.
+			m_queue.set_capacity( std::max( 64, 16 * tbb::this_task_arena::max_concurrency() ) );
+			m_thread = std::thread( &PipelineWriter::run, this );
+		}
 
-		ConstObjectPtr object = scene->objectPlug()->getValue();
-		Imath::Box3f bound = scene->boundPlug()->getValue();
+		~PipelineWriter()
+		{
+			if( m_thread.joinable() )
+			{
+				m_queue.push( nullptr );
+				m_thread.join();
+			}
+		}
 
-		IECore::M44dDataPtr transformData;
+		// Called concurrently by the evaluation threads. Payloads for a parent
+		// location are always pushed before those of its children.
+		void push( LocationPayloadPtr &&payload )
+		{
+			m_queue.push( payload.release() );
+		}
 
-		if( scenePath.empty() )
+		// True if writing has failed, in which case there is no point in
+		// evaluating any more locations.
+		bool failed() const
 		{
-			globals = scene->globals();
+			return m_failed;
 		}
-		else
+
+		// Waits for all pushed payloads to be written, rethrowing any
+		// exception thrown by the writer thread.
+		void finish()
 		{
-			Imath::M44f t = scene->transformPlug()->getValue();
-			transformData = new IECore::M44dData( Imath::M44d (
-				t[0][0], t[0][1], t[0][2], t[0][3],
-				t[1][0], t[1][1], t[1][2], t[1][3],
-				t[2][0], t[2][1], t[2][2], t[2][3],
-				t[3][0], t[3][1], t[3][2], t[3][3]
-			) );
+			m_queue.push( nullptr );
+			m_thread.join();
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
 		}
 
-		SceneInterface::NameList locationSets;
-		if( m_sets )
+	private :
+
+		void run()
 		{
-			const CompoundDataMap &setsMap = m_sets->readable();
-			locationSets.reserve( setsMap.size() );
+			IECore::MessageHandler::Scope messageScope( m_messageHandler.get() );
 
-			for( const auto &[name, data] : setsMap )
+			const auto startTime = std::chrono::steady_clock::now();
+			auto lastReportTime = startTime;
+
+			// Locations that have been written, but which still have children
+			// pending. We own them on behalf of the evaluation threads.
+			std::unordered_map<OutputLocation *, std::unique_ptr<OutputLocation>> liveLocations;
+
+			LocationPayload *rawPayload;
+			while( true )
 			{
-				auto pathMatcher = static_cast<const PathMatcherData *>( data.get() );
-				if( pathMatcher->readable().match( scenePath ) & IECore::PathMatcher::ExactMatch )
+				m_queue.pop( rawPayload );
+				if( !rawPayload )
 				{
-					locationSets.push_back( name );
+					break;
+				}
+
+				LocationPayloadPtr payload( rawPayload );
+				if( m_failed )
+				{
+					// Discard remaining payloads so that evaluation threads
+					// don't block on a full queue.
+					continue;
+				}
+
+				try
+				{
+					OutputLocation *location = payload->location.get();
+					liveLocations[location] = std::move( payload->location );
+					write( *payload, location );
+					if( !location->pendingChildren )
+					{
+						complete( location, liveLocations );
+					}
+				}
+				catch( ... )
+				{
+					m_exception = std::current_exception();
+					m_failed = true;
+					continue;
+				}
+
+				m_numLocations++;
+				const auto now = std::chrono::steady_clock::now();
+				if( now - lastReportTime > g_reportInterval )
+				{
+					const double seconds = std::chrono::duration<double>( now - startTime ).count();
+					IECore::msg(
+						IECore::Msg::Info, "SceneWriter",
+						fmt::format( "Written {} locations ({:.0f} locations per second)", m_numLocations, m_numLocations / seconds )
+					);
+					lastReportTime = now;
 				}
 			}
+
+			// Release any remaining SceneInterfaces on this thread, as some
+			// implementations perform writing at destruction.
+			liveLocations.clear();
+
+			const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+			IECore::msg(
+				IECore::Msg::Debug, "SceneWriter",
+				fmt::format( "Wrote {} locations in {:.2f}s", m_numLocations, seconds )
+			);
 		}
 
-		ConstInternedStringVectorDataPtr childNames = scene->childNamesPlug()->getValue();
+		void write( const LocationPayload &payload, OutputLocation *location )
+		{
+			location->parent = payload.parent;
+			if( payload.parent )
+			{
+				location->output = payload.parent->childOutputs.at( payload.name );
+			}
+			else
+			{
+				location->output = m_rootOutput;
+			}
+
+			SceneInterface *output = location->output.get();
+
+			if( payload.object->typeId() != IECore::NullObjectTypeId && payload.parent )
+			{
+				output->writeObject( payload.object.get(), m_time );
+			}
+
+			output->writeBound( Imath::Box3d( Imath::V3f( payload.bound.min ), Imath::V3f( payload.bound.max ) ), m_time );
+
+			if( payload.transform )
+			{
+				output->writeTransform( payload.transform.get(), m_time );
+			}
 
-		// Now write the scene data to the output SceneInterface. We require
-		// a lock for this as SceneInterface writing is not thread-safe.
+			for( const auto &[name, value] : payload.attributes->members() )
+			{
+				output->writeAttribute( name, value.get(), m_time );
+			}
 
-		tbb::mutex::scoped_lock scopedLock( m_mutex );
+			if( payload.globals && !payload.globals->members().empty() )
+			{
+				output->writeAttribute( "gaffer:globals", payload.globals.get(), m_time );
+			}
 
-		SceneInterface *output = m_parent ? m_parent->m_childOutputs.at( scenePath.back() ).get() : m_rootOutput;
+			if( !payload.sets.empty() )
+			{
+				output->writeTags( payload.sets );
+			}
 
-		if( object->typeId() != IECore::NullObjectTypeId && scenePath.size() > 0 )
+			const vector<InternedString> &childNames = payload.childNames->readable();
+			for( const auto &childName : childNames )
+			{
+				// Children may be evaluated in any order. Pre-create SceneInterface
+				// children here so that they are created in the correct order.
+				location->childOutputs[childName] = output->child( childName, SceneInterface::CreateIfMissing );
+			}
+			location->pendingChildren = childNames.size();
+		}
+
+		// Called when `location` and all its descendants have been written.
+		// Releases the SceneInterfaces, mirroring the order in which they would
+		// be released by a depth-first traversal.
+		void complete( OutputLocation *location, std::unordered_map<OutputLocation *, std::unique_ptr<OutputLocation>> &liveLocations )
 		{
-			output->writeObject( object.get(), m_time );
+			while( location )
+			{
+				OutputLocation *parent = location->parent;
+				liveLocations.erase( location );
+				if( !parent || --parent->pendingChildren )
+				{
+					break;
+				}
+				location = parent;
+			}
 		}
 
-		output->writeBound( Imath::Box3d( Imath::V3f( bound.min ), Imath::V3f( bound.max ) ), m_time );
+		SceneInterfacePtr m_rootOutput;
+		const float m_time;
+		IECore::MessageHandlerPtr m_messageHandler;
 
-		if( transformData )
+		tbb::concurrent_bounded_queue<LocationPayload *> m_queue;
+		std::thread m_thread;
+
+		size_t m_numLocations;
+		std::atomic_bool m_failed;
+		std::exception_ptr m_exception;
+
+};
+
+struct LocationEvaluator
+{
+
+	LocationEvaluator( PipelineWriter &writer, const CompoundData *sets )
+		: m_writer( writer ), m_sets( sets ), m_location( nullptr )
+	{
+	}
+
+	// Called by `parallelProcessLocationsBatched()` to create child functors for each location.
+	LocationEvaluator( const LocationEvaluator &parent )
+		: m_writer( parent.m_writer ), m_sets( parent.m_sets ), m_location( parent.m_location )
+	{
+	}
+
+	bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &scenePath )
+	{
+		if( m_writer.failed() )
 		{
-			output->writeTransform( transformData.get(), m_time );
+			return false;
 		}
 
-		for( CompoundObject::ObjectMap::const_iterator it = attributes->members().begin(), eIt = attributes->members().end(); it != eIt; it++ )
+		LocationPayloadPtr payload = std::make_unique<LocationPayload>();
+		payload->parent = m_location;
+		if( !scenePath.empty() )
 		{
-			output->writeAttribute( it->first, it->second.get(), m_time );
+			payload->name = scenePath.back();
 		}
 
-		if( globals && !globals->members().empty() )
+		payload->attributes = scene->attributesPlug()->getValue();
+		payload->object = scene->objectPlug()->getValue();
+		payload->bound = scene->boundPlug()->getValue();
+
+		if( scenePath.empty() )
 		{
-			output->writeAttribute( "gaffer:globals", globals.get(), m_time );
+			payload->globals = scene->globals();
 		}
-
-		if( !locationSets.empty() )
+		else
 		{
-			output->writeTags( locationSets );
+			Imath::M44f t = scene->transformPlug()->getValue();
+			payload->transform = new IECore::M44dData( Imath::M44d (
+				t[0][0], t[0][1], t[0][2], t[0][3],
+				t[1][0], t[1][1], t[1][2], t[1][3],
+				t[2][0], t[2][1], t[2][2], t[2][3],
+				t[3][0], t[3][1], t[3][2], t[3][3]
+			) );
 		}
 
-		for( const auto &childName : childNames->readable() )
+		if( m_sets )
 		{
-			// `SceneAlgo::parallelProcessLocations()` may visit children in any
-			// order. Pre-create SceneInterface children here so that they are
-			// created in the correct order.
-			m_childOutputs[childName] = output->child( childName, SceneInterface::CreateIfMissing );
+			const CompoundDataMap &setsMap = m_sets->readable();
+			payload->sets.reserve( setsMap.size() );
+
+			for( const auto &[name, data] : setsMap )
+			{
+				auto pathMatcher = static_cast<const PathMatcherData *>( data.get() );
+				if( pathMatcher->readable().match( scenePath ) & IECore::PathMatcher::ExactMatch )
+				{
+					payload->sets.push_back( name );
+				}
+			}
 		}
 
+		payload->childNames = scene->childNamesPlug()->getValue();
+
+		// Our children refer to our OutputLocation as their parent. Ownership
+		// is transferred to the writer thread, which is guaranteed not to
+		// destroy it until all of our children have been written.
+		payload->location = std::make_unique<OutputLocation>();
+		m_location = payload->location.get();
+
+		m_writer.push( std::move( payload ) );
+
 		return true;
 	}
 
 	private :
 
-		const LocationWriter *m_parent;
-		SceneInterface *m_rootOutput;
-		unordered_map<IECore::InternedString, SceneInterfacePtr> m_childOutputs;
+		PipelineWriter &m_writer;
 		const CompoundData *m_sets;
-		float m_time;
-		tbb::mutex &m_mutex;
+		OutputLocation *m_location;
 
 };
 
@@ -265,7 +477,6 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 	}
 
 	SceneInterfacePtr output;
-	tbb::mutex mutex;
 	ContextPtr context = new Context( *Context::current() );
 	Context::Scope scopedContext( context.get() );
 
@@ -284,8 +495,10 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 			useSetsAPI = SceneReader::useSetsAPI( output.get() );
 		}
 
-		LocationWriter locationWriter( output.get(), !useSetsAPI ? sets.get() : nullptr, context->getTime(), mutex );
-		SceneAlgo::parallelProcessLocations( scene, locationWriter );
+		PipelineWriter writer( output.get(), context->getTime() );
+		LocationEvaluator locationEvaluator( writer, !useSetsAPI ? sets.get() : nullptr );
+		SceneAlgo::parallelProcessLocationsBatched( scene, locationEvaluator );
+		writer.finish();
 
 		if( useSetsAPI && sets )
 		{
@@ -525,6 +525,25 @@ bool affectsSetExpression( const Plug *scenePlugChild )
 	return false;
 }
 
+SetDelta setDelta( const IECore::PathMatcher &before, const IECore::PathMatcher &after )
+{
+	// PathMatcher copies are cheap, because nodes are shared until
+	// they are modified.
+	SetDelta result;
+	result.added = after;
+	result.added.removePaths( before );
+	result.removed = before;
+	result.removed.removePaths( after );
+	return result;
+}
+
+bool applySetDelta( IECore::PathMatcher &set, const SetDelta &delta )
+{
+	bool result = set.removePaths( delta.removed );
+	result |= set.addPaths( delta.added );
+	return result;
+}
+
 } // namespace SetAlgo
 
 } // namespace Gaffer
@@ -319,6 +319,12 @@ IECore::MurmurHash childBoundsHashWrapper( const ScenePlug &plug, const ScenePlu
 	return plug.childBoundsHash( scenePath );
 }
 
+IECore::MurmurHash subtreeHashWrapper( const ScenePlug &plug, const ScenePlug::ScenePath &scenePath )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return plug.subtreeHash( scenePath );
+}
+
 IECore::InternedStringVectorDataPtr stringToPathWrapper( const char *s )
 {
 	IECore::InternedStringVectorDataPtr p = new IECore::InternedStringVectorData;
@@ -427,6 +433,8 @@ void GafferSceneModule::bindCore()
 		// child bounds queries
 		.def( "childBounds", &childBoundsWrapper )
 		.def( "childBoundsHash", &childBoundsHashWrapper )
+		// subtree queries
+		.def( "subtreeHash", &subtreeHashWrapper )
 		// string utilities
 		.def( "stringToPath", &stringToPathWrapper )
 		.staticmethod( "stringToPath" )
@@ -38,6 +38,7 @@
 
 #include "FilterBinding.h"
 
+#include "GafferScene/BoundFilter.h"
 #include "GafferScene/Filter.h"
 #include "GafferScene/FilterPlug.h"
 #include "GafferScene/FilterProcessor.h"
@@ -110,4 +111,13 @@ void GafferSceneModule::bindFilter()
 	GafferBindings::DependencyNodeClass<UnionFilter>();
 	GafferBindings::DependencyNodeClass<SetFilter>();
 	GafferBindings::DependencyNodeClass<FilterResults>();
+
+	{
+		scope s = GafferBindings::DependencyNodeClass<BoundFilter>();
+
+		enum_<BoundFilter::Mode>( "Mode" )
+			.value( "Bound", BoundFilter::Bound )
+			.value( "Camera", BoundFilter::Camera )
+		;
+	}
 }
@@ -56,6 +56,7 @@
 #include "RenderControllerBinding.h"
 #include "SceneAlgoBinding.h"
 #include "ScenePathBinding.h"
+#include "SceneSnapshotBinding.h"
 #include "SetAlgoBinding.h"
 #include "ShaderBinding.h"
 #include "TransformBinding.h"
@@ -81,6 +82,7 @@ BOOST_PYTHON_MODULE( _GafferScene )
 	bindSetAlgo();
 	bindPrimitives();
 	bindScenePath();
+	bindSceneSnapshot();
 	bindShader();
 	bindRender();
 	bindRenderController();
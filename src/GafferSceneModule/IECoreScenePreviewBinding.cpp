@@ -337,6 +337,11 @@ CapturingRenderer::CapturedAttributesPtr capturedObjectCapturedAttributes( const
 	return const_cast<CapturingRenderer::CapturedAttributes *>( o.capturedAttributes() );
 }
 
+IECore::CompoundObjectPtr capturedObjectCapturedInstances( const CapturingRenderer::CapturedObject &o )
+{
+	return const_cast<IECore::CompoundObject *>( o.capturedInstances() );
+}
+
 list capturedObjectCapturedLinkTypes( const CapturingRenderer::CapturedObject &o )
 {
 	list l;
@@ -449,6 +454,7 @@ void GafferSceneModule::bindIECoreScenePreview()
 
 		.def( "object", &rendererObject1 )
 		.def( "object", &rendererObject2 )
+		.def( "supportsInstances", &Renderer::supportsInstances )
 
 		.def( "render", render )
 		.def( "pause", &Renderer::pause )
@@ -543,6 +549,7 @@ void GafferSceneModule::bindIECoreScenePreview()
 		.def( "numAttributeEdits", &CapturingRenderer::CapturedObject::numAttributeEdits )
 		.def( "numLinkEdits", &CapturingRenderer::CapturedObject::numLinkEdits )
 		.def( "id", &CapturingRenderer::CapturedObject::id )
+		.def( "capturedInstances", &capturedObjectCapturedInstances )
 	;
 
 	{
@@ -139,10 +139,10 @@ void outputLightsWrapper( const ScenePlug &scene, const GafferScene::Private::Re
 	GafferScene::Private::RendererAlgo::outputLights( &scene, renderOptions, renderSets, &lightLinks, &renderer );
 }
 
-void outputObjectsWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks &lightLinks, IECoreScenePreview::Renderer &renderer, const ScenePlug::ScenePath &root )
+void outputObjectsWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks &lightLinks, IECoreScenePreview::Renderer &renderer, const ScenePlug::ScenePath &root, GafferScene::Private::RendererAlgo::ObjectDeduplicator *objectDeduplicator )
 {
 	IECorePython::ScopedGILRelease gilRelease;
-	GafferScene::Private::RendererAlgo::outputObjects( &scene, renderOptions, renderSets, &lightLinks, &renderer, root );
+	GafferScene::Private::RendererAlgo::outputObjects( &scene, renderOptions, renderSets, &lightLinks, &renderer, root, objectDeduplicator );
 }
 
 } // namespace
@@ -203,9 +203,23 @@ void GafferSceneModule::bindRender()
 				.def( init<>() )
 			;
 
+			{
+				scope s = class_<GafferScene::Private::RendererAlgo::ObjectDeduplicator, boost::noncopyable>( "ObjectDeduplicator" )
+					.def( init<>() )
+					.def( "clear", &GafferScene::Private::RendererAlgo::ObjectDeduplicator::clear )
+					.def( "statistics", &GafferScene::Private::RendererAlgo::ObjectDeduplicator::statistics )
+				;
+
+				class_<GafferScene::Private::RendererAlgo::ObjectDeduplicator::Statistics>( "Statistics" )
+					.def_readonly( "uniqueObjects", &GafferScene::Private::RendererAlgo::ObjectDeduplicator::Statistics::uniqueObjects )
+					.def_readonly( "duplicateObjects", &GafferScene::Private::RendererAlgo::ObjectDeduplicator::Statistics::duplicateObjects )
+					.def_readonly( "duplicateMemory", &GafferScene::Private::RendererAlgo::ObjectDeduplicator::Statistics::duplicateMemory )
+				;
+			}
+
 			def( "outputCameras", &outputCamerasWrapper );
 			def( "outputLights", &outputLightsWrapper );
-			def( "outputObjects", &outputObjectsWrapper, ( arg( "scene" ), arg( "globals" ), arg( "renderSets" ), arg( "lightLinks" ), arg( "renderer" ), arg( "root" ) = "/" ) );
+			def( "outputObjects", &outputObjectsWrapper, ( arg( "scene" ), arg( "globals" ), arg( "renderSets" ), arg( "lightLinks" ), arg( "renderer" ), arg( "root" ) = "/", arg( "objectDeduplicator" ) = object() ) );
 		}
 	}
 
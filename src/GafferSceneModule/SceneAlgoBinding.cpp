@@ -149,6 +149,26 @@ IECore::PathMatcher findAllWithAttributeWrapper( const ScenePlug &scene, Interne
 	return SceneAlgo::findAllWithAttribute( &scene, name, value, root );
 }
 
+IECore::PathMatcher findIntersectingWrapper1( const ScenePlug &scene, const Imath::Box3f &bound, const ScenePlug::ScenePath &root )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return SceneAlgo::findIntersecting( &scene, bound, root );
+}
+
+IECore::PathMatcher findIntersectingWrapper2( const ScenePlug &scene, object pythonFrustum, const ScenePlug::ScenePath &root )
+{
+	std::vector<Imath::Plane3f> frustum;
+	boost::python::container_utils::extend_container( frustum, pythonFrustum );
+	IECorePython::ScopedGILRelease gilRelease;
+	return SceneAlgo::findIntersecting( &scene, frustum, root );
+}
+
+IECore::PathMatcher findIntersectingWrapper3( const ScenePlug &scene, const Imath::Line3f &ray, const ScenePlug::ScenePath &root )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return SceneAlgo::findIntersecting( &scene, ray, root );
+}
+
 Imath::V2f shutterWrapper( const IECore::CompoundObject &globals, const ScenePlug &scene )
 {
 	IECorePython::ScopedGILRelease r;
@@ -385,6 +405,10 @@ void bindSceneAlgo()
 
 	def( "findAll", &findAllWrapper, ( arg( "scene" ), arg( "predicate" ), arg( "root" ) = "/" ) );
 	def( "findAllWithAttribute", &findAllWithAttributeWrapper, ( arg( "scene" ), arg( "name" ), arg( "value" ) = object(), arg( "root" ) = "/" ) );
+	// Registered first so that it is tried last, since it accepts any Python object.
+	def( "findIntersecting", &findIntersectingWrapper2, ( arg( "scene" ), arg( "frustum" ), arg( "root" ) = "/" ) );
+	def( "findIntersecting", &findIntersectingWrapper1, ( arg( "scene" ), arg( "bound" ), arg( "root" ) = "/" ) );
+	def( "findIntersecting", &findIntersectingWrapper3, ( arg( "scene" ), arg( "ray" ), arg( "root" ) = "/" ) );
 
 	def( "shutter", &shutterWrapper );
 	def( "setExists", &setExistsWrapper );
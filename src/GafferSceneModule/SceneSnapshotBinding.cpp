@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "boost/python.hpp"
+
+#include "SceneSnapshotBinding.h"
+
+#include "GafferScene/SceneSnapshot.h"
+
+#include "IECorePython/RefCountedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
+
+using namespace boost::python;
+using namespace IECore;
+using namespace GafferScene;
+
+namespace
+{
+
+SceneSnapshotPtr constructor( const ScenePlug &scene, const ScenePlug::ScenePath &root, unsigned components )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return new SceneSnapshot( &scene, root, components );
+}
+
+void checkIndex( const SceneSnapshot &snapshot, size_t index )
+{
+	if( index >= snapshot.size() )
+	{
+		PyErr_SetString( PyExc_IndexError, "Index out of range" );
+		throw_error_already_set();
+	}
+}
+
+std::string nameWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	checkIndex( snapshot, index );
+	return snapshot.name( index ).string();
+}
+
+object parentWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	checkIndex( snapshot, index );
+	const size_t p = snapshot.parent( index );
+	return p == SceneSnapshot::npos ? object() : object( p );
+}
+
+size_t subtreeEndWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	checkIndex( snapshot, index );
+	return snapshot.subtreeEnd( index );
+}
+
+InternedStringVectorDataPtr pathWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	checkIndex( snapshot, index );
+	InternedStringVectorDataPtr result = new InternedStringVectorData;
+	snapshot.path( index, result->writable() );
+	return result;
+}
+
+object findWrapper( const SceneSnapshot &snapshot, const ScenePlug::ScenePath &path )
+{
+	const size_t i = snapshot.find( path );
+	return i == SceneSnapshot::npos ? object() : object( i );
+}
+
+template<typename T>
+const T &column( const SceneSnapshot &snapshot, const std::vector<T> &values, size_t index )
+{
+	checkIndex( snapshot, index );
+	if( values.empty() )
+	{
+		PyErr_SetString( PyExc_ValueError, "Component not present in snapshot" );
+		throw_error_already_set();
+	}
+	return values[index];
+}
+
+Imath::Box3f boundWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	return column( snapshot, snapshot.bounds(), index );
+}
+
+Imath::M44f transformWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	return column( snapshot, snapshot.transforms(), index );
+}
+
+Imath::M44f fullTransformWrapper( const SceneSnapshot &snapshot, size_t index )
+{
+	return column( snapshot, snapshot.fullTransforms(), index );
+}
+
+CompoundObjectPtr attributesWrapper( const SceneSnapshot &snapshot, size_t index, bool copy )
+{
+	ConstCompoundObjectPtr a = column( snapshot, snapshot.attributes(), index );
+	return copy ? a->copy() : boost::const_pointer_cast<CompoundObject>( a );
+}
+
+ObjectPtr objectWrapper( const SceneSnapshot &snapshot, size_t index, bool copy )
+{
+	ConstObjectPtr o = column( snapshot, snapshot.objects(), index );
+	return copy ? o->copy() : boost::const_pointer_cast<Object>( o );
+}
+
+InternedStringVectorDataPtr rootWrapper( const SceneSnapshot &snapshot )
+{
+	return new InternedStringVectorData( snapshot.root() );
+}
+
+} // namespace
+
+void GafferSceneModule::bindSceneSnapshot()
+{
+
+	scope s = IECorePython::RefCountedClass<SceneSnapshot, RefCounted>( "SceneSnapshot" )
+		.def( "__init__", make_constructor( &constructor, default_call_policies(),
+				(
+					arg( "scene" ),
+					arg( "root" ) = "/",
+					arg( "components" ) = (unsigned)SceneSnapshot::All
+				)
+			)
+		)
+		.def( "components", &SceneSnapshot::components )
+		.def( "root", &rootWrapper )
+		.def( "size", &SceneSnapshot::size )
+		.def( "__len__", &SceneSnapshot::size )
+		.def( "name", &nameWrapper )
+		.def( "parent", &parentWrapper )
+		.def( "subtreeEnd", &subtreeEndWrapper )
+		.def( "path", &pathWrapper )
+		.def( "find", &findWrapper )
+		.def( "bound", &boundWrapper )
+		.def( "transform", &transformWrapper )
+		.def( "fullTransform", &fullTransformWrapper )
+		.def( "attributes", &attributesWrapper, ( arg( "index" ), arg( "_copy" ) = true ) )
+		.def( "object", &objectWrapper, ( arg( "index" ), arg( "_copy" ) = true ) )
+	;
+
+	enum_<SceneSnapshot::Components>( "Components" )
+		.value( "None_", SceneSnapshot::None )
+		.value( "Bound", SceneSnapshot::Bound )
+		.value( "Transform", SceneSnapshot::Transform )
+		.value( "Attributes", SceneSnapshot::Attributes )
+		.value( "Object", SceneSnapshot::Object )
+		.value( "All", SceneSnapshot::All )
+	;
+
+}
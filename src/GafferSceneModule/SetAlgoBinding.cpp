@@ -65,6 +65,18 @@ void setExpressionHashWrapper2( const std::string &setExpression, const ScenePlu
 	SetAlgo::setExpressionHash( setExpression, scene, h );
 }
 
+SetAlgo::SetDelta setDeltaWrapper( const PathMatcher &before, const PathMatcher &after )
+{
+	IECorePython::ScopedGILRelease r;
+	return SetAlgo::setDelta( before, after );
+}
+
+bool applySetDeltaWrapper( PathMatcher &set, const SetAlgo::SetDelta &delta )
+{
+	IECorePython::ScopedGILRelease r;
+	return SetAlgo::applySetDelta( set, delta );
+}
+
 } // namespace
 
 namespace GafferSceneModule
@@ -96,6 +108,14 @@ void bindSetAlgo()
 
 	def( "affectsSetExpression", &SetAlgo::affectsSetExpression );
 
+	class_<SetAlgo::SetDelta>( "SetDelta" )
+		.def_readwrite( "added", &SetAlgo::SetDelta::added )
+		.def_readwrite( "removed", &SetAlgo::SetDelta::removed )
+	;
+
+	def( "setDelta", &setDeltaWrapper, ( arg( "before" ), arg( "after" ) ) );
+	def( "applySetDelta", &applySetDeltaWrapper, ( arg( "set" ), arg( "delta" ) ) );
+
 }
 
 } // namespace GafferSceneModule
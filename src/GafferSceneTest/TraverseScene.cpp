@@ -42,6 +42,8 @@
 
 #include "boost/bind/bind.hpp"
 
+#include "tbb/enumerable_thread_specific.h"
+
 using namespace std;
 using namespace boost::placeholders;
 using namespace IECore;
@@ -64,6 +66,43 @@ struct SceneEvaluateFunctor
 	}
 };
 
+struct BatchedEvaluateFunctor
+{
+
+	BatchedEvaluateFunctor( tbb::enumerable_thread_specific<PathMatcher> &visited, size_t depth )
+		:	m_visited( visited ), m_depth( depth )
+	{
+	}
+
+	BatchedEvaluateFunctor( const BatchedEvaluateFunctor &parent )
+		:	m_visited( parent.m_visited ), m_depth( parent.m_depth + 1 )
+	{
+	}
+
+	bool operator()( const GafferScene::ScenePlug *scene, const GafferScene::ScenePlug::ScenePath &path )
+	{
+		const auto &contextPath = Context::current()->get<ScenePlug::ScenePath>( ScenePlug::scenePathContextName );
+		if( contextPath != path )
+		{
+			throw IECore::Exception( "Context path \"" + ScenePlug::pathToString( contextPath ) + "\" does not match \"" + ScenePlug::pathToString( path ) + "\"" );
+		}
+		if( path.size() != m_depth )
+		{
+			throw IECore::Exception( "Functor depth does not match \"" + ScenePlug::pathToString( path ) + "\"" );
+		}
+
+		SceneEvaluateFunctor()( scene, path );
+		m_visited.local().addPath( path );
+		return true;
+	}
+
+	private :
+
+		tbb::enumerable_thread_specific<PathMatcher> &m_visited;
+		const size_t m_depth;
+
+};
+
 void traverseOnDirty( const Gaffer::Plug *dirtiedPlug, ConstScenePlugPtr scene )
 {
 	if( dirtiedPlug == scene.get() )
@@ -92,6 +131,20 @@ void GafferSceneTest::traverseScene( const GafferScene::ScenePlug *scenePlug )
 	SceneAlgo::parallelTraverse( scenePlug, f );
 }
 
+IECore::PathMatcher GafferSceneTest::traverseSceneBatched( const GafferScene::ScenePlug *scenePlug, const GafferScene::ScenePlug::ScenePath &root )
+{
+	tbb::enumerable_thread_specific<PathMatcher> visited;
+	BatchedEvaluateFunctor f( visited, root.size() );
+	SceneAlgo::parallelProcessLocationsBatched( scenePlug, f, root );
+
+	PathMatcher result;
+	for( const auto &v : visited )
+	{
+		result.addPaths( v );
+	}
+	return result;
+}
+
 Signals::Connection GafferSceneTest::connectTraverseSceneToPlugDirtiedSignal( const GafferScene::ConstScenePlugPtr &scene )
 {
 	const Node *node = scene->node();
@@ -58,6 +58,12 @@ static void traverseSceneWrapper( const GafferScene::ScenePlug *scenePlug )
 	traverseScene( scenePlug );
 }
 
+static IECore::PathMatcher traverseSceneBatchedWrapper( const GafferScene::ScenePlug *scenePlug, const GafferScene::ScenePlug::ScenePath &root )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return traverseSceneBatched( scenePlug, root );
+}
+
 BOOST_PYTHON_MODULE( _GafferSceneTest )
 {
 
@@ -73,6 +79,7 @@ BOOST_PYTHON_MODULE( _GafferSceneTest )
 	GafferBindings::NodeClass<TestLightFilter>();
 
 	def( "traverseScene", &traverseSceneWrapper );
+	def( "traverseSceneBatched", &traverseSceneBatchedWrapper, ( arg( "scene" ), arg( "root" ) = "/" ) );
 	def( "connectTraverseSceneToPlugDirtiedSignal", &connectTraverseSceneToPlugDirtiedSignal );
 	def( "connectTraverseSceneToContextChangedSignal", &connectTraverseSceneToContextChangedSignal );
 	def( "connectTraverseSceneToPreDispatchSignal", &connectTraverseSceneToPreDispatchSignal );
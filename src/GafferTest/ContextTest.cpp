@@ -324,6 +324,97 @@ void GafferTest::testContextCopyPerformance( int numEntries, int entrySize )
 
 }
 
+void GafferTest::testEditableScopePerformance( int numEntries, int entrySize )
+{
+	// Simulates the typical access pattern for a scene traversal, where
+	// a ContextProcessor modifies a variable and then a PathScope sets the
+	// location, with the hash being required for each.
+
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < numEntries; i++ )
+	{
+		baseContext->set( InternedString( i ), std::string( entrySize, 'x') );
+	}
+
+	Context::Scope baseScope( baseContext.get() );
+	const ThreadState &threadState = ThreadState::current();
+
+	const InternedString processorVarName = "processorVar";
+	const InternedString pathVarName = "pathVar";
+
+	tbb::parallel_for( tbb::blocked_range<int>( 0, 10000000 ), [&threadState, &processorVarName, &pathVarName]( const tbb::blocked_range<int> &r )
+		{
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				Context::EditableScope processorScope( threadState );
+				processorScope.set( processorVarName, &i );
+				processorScope.context()->hash();
+
+				Context::EditableScope pathScope( processorScope.context() );
+				pathScope.set( pathVarName, &i );
+				pathScope.context()->hash();
+			}
+		}
+	);
+}
+
+void GafferTest::testContextHashMaintenance()
+{
+	// Contexts maintain their hash incrementally as variables are
+	// edited. Check that after a random sequence of edits, the hash
+	// matches that of a context built from scratch.
+
+	std::default_random_engine randomEngine( 42 );
+	std::uniform_int_distribution<int> operationDistribution( 0, 3 );
+	std::uniform_int_distribution<int> nameDistribution( 0, 19 );
+
+	const std::vector<InternedString> names = { "a", "b", "c", "ui:d", "e" };
+	std::vector<int> values( 1000 );
+
+	ContextPtr context = new Context();
+	for( int i = 0; i < 1000; ++i )
+	{
+		const InternedString name = names[nameDistribution( randomEngine ) % names.size()];
+		values[i] = nameDistribution( randomEngine );
+		switch( operationDistribution( randomEngine ) )
+		{
+			case 0 :
+				context->set( name, values[i] );
+				break;
+			case 1 :
+				context->set( name, std::string( values[i], 'x' ) );
+				break;
+			case 2 :
+				context->remove( name );
+				break;
+			case 3 :
+			{
+				ContextPtr edited;
+				{
+					Context::EditableScope scope( context.get() );
+					scope.set( name, &values[i] );
+					scope.remove( names[0] );
+					edited = new Context( *scope.context() );
+				}
+				context = edited;
+				break;
+			}
+		}
+
+		ContextPtr rebuilt = new Context();
+		rebuilt->remove( "frame" );
+		rebuilt->remove( "framesPerSecond" );
+		std::vector<InternedString> contextNames;
+		context->names( contextNames );
+		for( const auto &n : contextNames )
+		{
+			rebuilt->set( n, context->getAsData( n ).get() );
+		}
+
+		GAFFERTEST_ASSERT( context->hash() == rebuilt->hash() );
+	}
+}
+
 void GafferTest::testCopyEditableScope()
 {
 	ContextPtr copy;
@@ -106,6 +106,8 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "countContextHash32Collisions", &countContextHash32CollisionsWrapper );
 	def( "testContextHashPerformance", &testContextHashPerformance );
 	def( "testContextCopyPerformance", &testContextCopyPerformance );
+	def( "testEditableScopePerformance", &testEditableScopePerformance );
+	def( "testContextHashMaintenance", &testContextHashMaintenance );
 	def( "testCopyEditableScope", &testCopyEditableScope );
 	def( "testContextHashValidation", &testContextHashValidation );
 	def( "testComputeNodeThreading", &testComputeNodeThreading );
@@ -800,6 +800,54 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheEvictionPolicy
+{
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		for( auto evictionPolicy : { Cache::EvictionPolicy::LRU, Cache::EvictionPolicy::CostAware } )
+		{
+			Cache cache(
+				[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+					cost = 1;
+					return key;
+				},
+				10
+			);
+			cache.setEvictionPolicy( evictionPolicy );
+			GAFFERTEST_ASSERT( cache.getEvictionPolicy() == evictionPolicy );
+
+			// Add an item that is expensive to recompute, followed
+			// by enough cheap items to force evictions.
+
+			cache.set( -1, -1, 1, /* recomputeCost = */ 1000 );
+			for( int i = 0; i < 20; ++i )
+			{
+				cache.set( i, i, 1 );
+			}
+
+			GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 10 );
+			GAFFERTEST_ASSERTEQUAL( cache.evictions(), 11 );
+
+			// With the LRU policy, the expensive item is evicted
+			// first, because it is the least recently used. With
+			// the CostAware policy it survives at the expense of the
+			// cheap items.
+
+			GAFFERTEST_ASSERTEQUAL( cache.cached( -1 ), evictionPolicy == Cache::EvictionPolicy::CostAware );
+		}
+	}
+
+};
+
+void testLRUCacheEvictionPolicy( const std::string &policy )
+{
+	DispatchTest<TestLRUCacheEvictionPolicy>()( policy );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -815,4 +863,5 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "testLRUCacheEvictionPolicy", &testLRUCacheEvictionPolicy );
 }
@@ -44,10 +44,12 @@
 #include "Gaffer/TypedObjectPlug.h"
 #include "Gaffer/ValuePlug.h"
 
-#include "tbb/parallel_for.h"
-
 #include "IECorePython/ScopedGILRelease.h"
 
+#include "boost/python/suite/indexing/container_utils.hpp"
+
+#include "tbb/parallel_for.h"
+
 
 using namespace boost::python;
 using namespace Gaffer;
@@ -120,6 +122,30 @@ void parallelGetValueWithVar( const T *plug, int iterations, const IECore::Inter
 	);
 }
 
+// Calls `hash()` on every plug in `plugs`, for `numFrames` different
+// frames, repeating `iterations` times. After the first iteration, all
+// hashes are expected to come from the hash cache, so this is useful for
+// measuring the cost of cache lookups.
+void repeatHash( object pythonPlugs, int numFrames, int iterations )
+{
+	std::vector<ValuePlugPtr> plugs;
+	boost::python::container_utils::extend_container( plugs, pythonPlugs );
+
+	IECorePython::ScopedGILRelease gilRelease;
+	Context::EditableScope scope( Context::current() );
+	for( int i = 0; i < iterations; i++ )
+	{
+		for( int f = 0; f < numFrames; ++f )
+		{
+			scope.setFrame( f );
+			for( const auto &plug : plugs )
+			{
+				plug->hash();
+			}
+		}
+	}
+}
+
 } // namespace
 
 void GafferTestModule::bindValuePlugTest()
@@ -144,4 +170,5 @@ void GafferTestModule::bindValuePlugTest()
 	def( "parallelGetValue", &parallelGetValueWithVar<StringPlug> );
 	def( "parallelGetValue", &parallelGetValueWithVar<ObjectPlug> );
 	def( "parallelGetValue", &parallelGetValueWithVar<PathMatcherDataPlug> );
+	def( "repeatHash", &repeatHash );
 }
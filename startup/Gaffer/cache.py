@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import os
 import psutil
 
 import Gaffer
@@ -44,3 +45,22 @@ import Gaffer
 Gaffer.ValuePlug.setCacheMemoryLimit(
 	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
 )
+
+# Choose the policy used to evict values from the cache when it is full.
+# The CostAware policy favours retaining values that were expensive to
+# compute.
+
+if os.environ.get( "GAFFER_CACHE_EVICTION_POLICY" ) :
+	Gaffer.ValuePlug.setCacheEvictionPolicy(
+		Gaffer.ValuePlug.CacheEvictionPolicy.names[os.environ["GAFFER_CACHE_EVICTION_POLICY"]]
+	)
+
+# Enable the persistent cache if a directory has been provided. This
+# allows expensive computes to be reused by other processes running on
+# the same machine, for instance consecutive frames of a dispatch.
+
+if os.environ.get( "GAFFER_PERSISTENT_CACHE_DIRECTORY" ) :
+	Gaffer.ValuePlug.setPersistentCacheSizeLimit(
+		int( os.environ.get( "GAFFER_PERSISTENT_CACHE_SIZE_LIMIT", 1024**3 * 10 ) )
+	)
+	Gaffer.ValuePlug.setPersistentCacheDirectory( os.environ["GAFFER_PERSISTENT_CACHE_DIRECTORY"] )
@@ -249,6 +249,9 @@ def __graphEditorCreated( graphEditor ) :
 		"performanceMonitor:perHashDuration",
 		"performanceMonitor:perComputeDuration",
 		"performanceMonitor:hashesPerCompute",
+		"performanceMonitor:collaborativeWaitCount",
+		"performanceMonitor:collaborativeIdleDuration",
+		"performanceMonitor:collaborativeWorkFraction",
 	}
 
 	annotationsGadget.setVisibleAnnotations( " ".join( visibleAnnotations ) )